@@ -0,0 +1,429 @@
+#include "BenchClient.h"
+#include <Network/SocketUtils.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <cstdio>
+#include <cstring>
+
+using namespace KanchoNet;
+
+BenchClient::BenchClient(const BenchOptions& options, uint32_t connectionCount, double rate)
+    : mOptions(options)
+    , mConnectionCount(connectionCount)
+    , mRate(rate)
+    , mEpollFd(-1)
+    , mMeasureStart(0)
+    , mMeasureEnd(0)
+{
+}
+
+BenchClient::~BenchClient()
+{
+    for (Connection& connection : mConnections)
+    {
+        if (!connection.mClosed)
+        {
+            close(connection.mSocket);
+        }
+    }
+
+    if (mEpollFd >= 0)
+    {
+        close(mEpollFd);
+    }
+}
+
+bool BenchClient::Connect()
+{
+    if (mOptions.mAcceptStorm)
+    {
+        return true;
+    }
+
+    mEpollFd = epoll_create1(0);
+    if (mEpollFd < 0)
+    {
+        fprintf(stderr, "epoll_create1 failed. Error: %d\n", errno);
+        return false;
+    }
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(mOptions.mPort);
+    if (inet_pton(AF_INET, mOptions.mHost.c_str(), &addr.sin_addr) != 1)
+    {
+        fprintf(stderr, "Invalid host: %s\n", mOptions.mHost.c_str());
+        return false;
+    }
+
+    mConnections.resize(mConnectionCount);
+    for (uint32_t i = 0; i < mConnectionCount; ++i)
+    {
+        Connection& connection = mConnections[i];
+        connection.mMessage.resize(mOptions.mMessageSize);
+
+        connection.mSocket = socket(AF_INET, SOCK_STREAM, 0);
+        if (connection.mSocket < 0 || connect(connection.mSocket, (sockaddr*)&addr, sizeof(addr)) < 0)
+        {
+            fprintf(stderr, "connect to %s:%u failed. Error: %d\n", mOptions.mHost.c_str(), mOptions.mPort, errno);
+            ++mResult.mErrors;
+            if (connection.mSocket >= 0)
+            {
+                close(connection.mSocket);
+            }
+            connection.mClosed = true;
+            return false;
+        }
+
+        SocketUtils::SetNoDelay(connection.mSocket, true);
+        SocketUtils::SetNonBlocking(connection.mSocket, true);
+
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.u32 = i;
+        epoll_ctl(mEpollFd, EPOLL_CTL_ADD, connection.mSocket, &ev);
+    }
+
+    return true;
+}
+
+void BenchClient::Run(int64_t measureStart, int64_t measureEnd, const std::atomic<bool>& stop)
+{
+    mMeasureStart = measureStart;
+    mMeasureEnd = measureEnd;
+
+    if (mOptions.mAcceptStorm)
+    {
+        RunAcceptStorm(stop);
+    }
+    else if (mRate > 0.0)
+    {
+        RunOpenLoop(stop);
+    }
+    else
+    {
+        RunClosedLoop(stop);
+    }
+}
+
+const BenchWorkerResult& BenchClient::GetResult()
+{
+    mResult.mLatency = HistogramSnapshot();
+    mLatency.CopyTo(mResult.mLatency);
+    return mResult;
+}
+
+void BenchClient::RunClosedLoop(const std::atomic<bool>& stop)
+{
+    // 연결마다 pipeline개를 먼저 보내고, 에코가 돌아올 때마다 하나씩 다시 전송
+    for (Connection& connection : mConnections)
+    {
+        for (uint32_t i = 0; i < mOptions.mPipeline; ++i)
+        {
+            QueueMessage(connection, NetworkMetrics::Now());
+        }
+        Flush(connection);
+    }
+
+    while (!stop.load(std::memory_order_relaxed))
+    {
+        Poll(10, true);
+    }
+}
+
+void BenchClient::RunOpenLoop(const std::atomic<bool>& stop)
+{
+    // 스레드 전송률을 연결들에 라운드 로빈으로 분배 (연결당 간격 = 연결 수 / 전송률)
+    const double interval = 1e9 / mRate;
+    double nextSend = static_cast<double>(NetworkMetrics::Now());
+    size_t cursor = 0;
+
+    while (!stop.load(std::memory_order_relaxed))
+    {
+        int64_t now = NetworkMetrics::Now();
+
+        // 밀린 전송이 있으면 예정 시각 그대로 모두 큐잉 (coordinated omission 방지)
+        while (nextSend <= static_cast<double>(now))
+        {
+            Connection& connection = mConnections[cursor];
+            cursor = (cursor + 1) % mConnections.size();
+
+            if (!connection.mClosed)
+            {
+                if (connection.mSendQueue.size() - connection.mSendOffset >= MAX_PENDING_SEND_BYTES)
+                {
+                    ++mResult.mSendsSkipped;
+                }
+                else
+                {
+                    QueueMessage(connection, static_cast<int64_t>(nextSend));
+                    Flush(connection);
+                }
+            }
+
+            nextSend += interval;
+        }
+
+        // 다음 전송까지 대기 (1ms 미만이면 바로 폴링)
+        int timeoutMs = static_cast<int>((nextSend - static_cast<double>(NetworkMetrics::Now())) / 1e6);
+        Poll(timeoutMs > 0 ? timeoutMs : 0, false);
+    }
+}
+
+void BenchClient::RunAcceptStorm(const std::atomic<bool>& stop)
+{
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(mOptions.mPort);
+    if (inet_pton(AF_INET, mOptions.mHost.c_str(), &addr.sin_addr) != 1)
+    {
+        fprintf(stderr, "Invalid host: %s\n", mOptions.mHost.c_str());
+        ++mResult.mErrors;
+        return;
+    }
+
+    const size_t size = mOptions.mMessageSize;
+    std::vector<uint8_t> message(size, 0);
+    std::vector<uint8_t> echo(size);
+
+    while (!stop.load(std::memory_order_relaxed))
+    {
+        const int64_t start = NetworkMetrics::Now();
+
+        SocketHandle sock = socket(AF_INET, SOCK_STREAM, 0);
+        if (sock < 0 || connect(sock, (sockaddr*)&addr, sizeof(addr)) < 0)
+        {
+            ++mResult.mErrors;
+            if (sock >= 0)
+            {
+                close(sock);
+            }
+
+            // 백로그/포트 고갈 시 바로 재시도하지 않음
+            usleep(1000);
+            continue;
+        }
+
+        SocketUtils::SetNoDelay(sock, true);
+
+        // 서버가 에코를 잃어도 멈추지 않도록 수신 제한 시간 설정
+        struct timeval timeout = { 2, 0 };
+        setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        memcpy(message.data(), &start, sizeof(start));
+        bool ok = send(sock, message.data(), size, MSG_NOSIGNAL) == static_cast<ssize_t>(size);
+
+        size_t received = 0;
+        while (ok && received < size)
+        {
+            ssize_t bytes = recv(sock, echo.data() + received, size - received, 0);
+            if (bytes <= 0)
+            {
+                ok = false;
+                break;
+            }
+            received += static_cast<size_t>(bytes);
+        }
+
+        close(sock);
+
+        if (!ok)
+        {
+            ++mResult.mErrors;
+            continue;
+        }
+
+        if (start >= mMeasureStart && start < mMeasureEnd)
+        {
+            ++mResult.mConnectionsCompleted;
+            ++mResult.mMessagesSent;
+            ++mResult.mMessagesReceived;
+            mResult.mBytesReceived += size;
+            mLatency.Record(static_cast<uint64_t>(NetworkMetrics::Now() - start));
+        }
+    }
+}
+
+void BenchClient::Poll(int timeoutMs, bool closedLoop)
+{
+    struct epoll_event events[128];
+    int count = epoll_wait(mEpollFd, events, 128, timeoutMs);
+
+    for (int i = 0; i < count; ++i)
+    {
+        Connection& connection = mConnections[events[i].data.u32];
+        if (connection.mClosed)
+        {
+            continue;
+        }
+
+        if (events[i].events & (EPOLLERR | EPOLLHUP))
+        {
+            ++mResult.mErrors;
+            CloseConnection(connection);
+            continue;
+        }
+
+        if (events[i].events & EPOLLIN)
+        {
+            Receive(connection, closedLoop);
+        }
+
+        if (!connection.mClosed && (events[i].events & EPOLLOUT))
+        {
+            Flush(connection);
+        }
+    }
+}
+
+void BenchClient::QueueMessage(Connection& connection, int64_t scheduledTime)
+{
+    if (scheduledTime >= mMeasureStart && scheduledTime < mMeasureEnd)
+    {
+        ++mResult.mMessagesSent;
+    }
+
+    // 모두 보낸 대기열은 앞에서부터 재사용
+    if (connection.mSendOffset == connection.mSendQueue.size())
+    {
+        connection.mSendQueue.clear();
+        connection.mSendOffset = 0;
+    }
+
+    size_t offset = connection.mSendQueue.size();
+    connection.mSendQueue.resize(offset + mOptions.mMessageSize, 'K');
+    memcpy(connection.mSendQueue.data() + offset, &scheduledTime, sizeof(scheduledTime));
+}
+
+void BenchClient::Flush(Connection& connection)
+{
+    while (connection.mSendOffset < connection.mSendQueue.size())
+    {
+        ssize_t sent = send(connection.mSocket,
+                            connection.mSendQueue.data() + connection.mSendOffset,
+                            connection.mSendQueue.size() - connection.mSendOffset,
+                            MSG_NOSIGNAL);
+        if (sent > 0)
+        {
+            connection.mSendOffset += static_cast<size_t>(sent);
+        }
+        else if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            UpdateInterest(connection, true);
+            return;
+        }
+        else if (sent < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else
+        {
+            ++mResult.mErrors;
+            CloseConnection(connection);
+            return;
+        }
+    }
+
+    connection.mSendQueue.clear();
+    connection.mSendOffset = 0;
+    UpdateInterest(connection, false);
+}
+
+void BenchClient::Receive(Connection& connection, bool closedLoop)
+{
+    static thread_local uint8_t buffer[64 * 1024];
+    const size_t messageSize = mOptions.mMessageSize;
+    size_t replies = 0;
+
+    while (true)
+    {
+        ssize_t bytesRead = recv(connection.mSocket, buffer, sizeof(buffer), 0);
+        if (bytesRead > 0)
+        {
+            // 에코는 보낸 순서대로 돌아오므로 고정 크기 단위로 메시지 복원
+            size_t offset = 0;
+            while (offset < static_cast<size_t>(bytesRead))
+            {
+                size_t copy = messageSize - connection.mReceived;
+                if (copy > static_cast<size_t>(bytesRead) - offset)
+                {
+                    copy = static_cast<size_t>(bytesRead) - offset;
+                }
+
+                memcpy(connection.mMessage.data() + connection.mReceived, buffer + offset, copy);
+                connection.mReceived += copy;
+                offset += copy;
+
+                if (connection.mReceived == messageSize)
+                {
+                    int64_t scheduledTime;
+                    memcpy(&scheduledTime, connection.mMessage.data(), sizeof(scheduledTime));
+                    connection.mReceived = 0;
+                    ++replies;
+
+                    if (scheduledTime >= mMeasureStart && scheduledTime < mMeasureEnd)
+                    {
+                        mLatency.Record(static_cast<uint64_t>(NetworkMetrics::Now() - scheduledTime));
+                        ++mResult.mMessagesReceived;
+                        mResult.mBytesReceived += messageSize;
+                    }
+                }
+            }
+        }
+        else if (bytesRead < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+        else if (bytesRead < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else
+        {
+            ++mResult.mErrors;
+            CloseConnection(connection);
+            return;
+        }
+    }
+
+    // closed-loop: 돌아온 수만큼 다시 전송
+    if (closedLoop && replies > 0)
+    {
+        int64_t now = NetworkMetrics::Now();
+        for (size_t i = 0; i < replies; ++i)
+        {
+            QueueMessage(connection, now);
+        }
+        Flush(connection);
+    }
+}
+
+void BenchClient::UpdateInterest(Connection& connection, bool wantWrite)
+{
+    if (connection.mWantWrite == wantWrite)
+    {
+        return;
+    }
+
+    struct epoll_event ev;
+    ev.events = wantWrite ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+    ev.data.u32 = static_cast<uint32_t>(&connection - mConnections.data());
+    epoll_ctl(mEpollFd, EPOLL_CTL_MOD, connection.mSocket, &ev);
+    connection.mWantWrite = wantWrite;
+}
+
+void BenchClient::CloseConnection(Connection& connection)
+{
+    if (connection.mClosed)
+    {
+        return;
+    }
+
+    close(connection.mSocket);
+    connection.mClosed = true;
+}
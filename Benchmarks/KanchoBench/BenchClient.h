@@ -0,0 +1,92 @@
+#pragma once
+
+#include "BenchOptions.h"
+#include <KanchoNet.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// 클라이언트 스레드별 결과
+struct BenchWorkerResult
+{
+    uint64_t mMessagesSent = 0;         // 측정 구간에 보낸 메시지 수
+    uint64_t mMessagesReceived = 0;     // 측정 구간에 받은 에코 수 (지연 기록 수)
+    uint64_t mBytesReceived = 0;
+    uint64_t mSendsSkipped = 0;         // open-loop에서 송신 대기열이 가득 차 건너뛴 전송 수
+    uint64_t mErrors = 0;               // 연결 실패/끊김 수
+    uint64_t mConnectionsCompleted = 0; // 연결 폭주에서 측정 구간에 연결~에코~종료를 마친 횟수
+    KanchoNet::HistogramSnapshot mLatency;  // 왕복 지연 (나노초)
+};
+
+// 부하 생성 클라이언트 스레드
+// 스레드마다 자신의 epoll 인스턴스로 맡은 연결들을 논블로킹 처리
+// 메시지 앞 8바이트에 송신 예정 시각(steady_clock 나노초)을 넣고, 에코가 돌아오면 그 차이를 지연으로 기록
+// open-loop에서는 실제 송신 시각이 아니라 예정 시각을 쓰므로 서버가 밀릴 때의 대기 시간도 지연에 포함됨
+class BenchClient
+{
+public:
+    // public 멤버변수
+    static constexpr size_t MAX_PENDING_SEND_BYTES = 1024 * 1024;  // 연결당 송신 대기열 한도 (open-loop)
+
+private:
+    // private 멤버변수
+    struct Connection
+    {
+        KanchoNet::SocketHandle mSocket = KanchoNet::INVALID_SOCKET_HANDLE;
+        std::vector<uint8_t> mSendQueue;    // 아직 커널에 넘기지 못한 바이트
+        size_t mSendOffset = 0;
+        std::vector<uint8_t> mMessage;      // 수신 중인 메시지 조립 버퍼
+        size_t mReceived = 0;
+        bool mWantWrite = false;
+        bool mClosed = false;
+    };
+
+    const BenchOptions& mOptions;
+    uint32_t mConnectionCount;
+    double mRate;                   // 이 스레드의 목표 전송률 (메시지/초, 0 = closed-loop)
+
+    int mEpollFd;
+    std::vector<Connection> mConnections;
+    KanchoNet::LatencyHistogram mLatency;
+    BenchWorkerResult mResult;
+
+    int64_t mMeasureStart;          // 이 시각 이후에 예정된 메시지만 기록
+    int64_t mMeasureEnd;
+
+public:
+    // 생성자, 파괴자
+    BenchClient(const BenchOptions& options, uint32_t connectionCount, double rate);
+    ~BenchClient();
+
+    BenchClient(const BenchClient&) = delete;
+    BenchClient& operator=(const BenchClient&) = delete;
+
+public:
+    // public 함수
+    // 연결 생성 (블로킹 connect 후 논블로킹 전환, 연결 폭주 모드에서는 Run에서 직접 연결)
+    bool Connect();
+
+    // 부하 실행 (stop이 true가 되면 반환)
+    void Run(int64_t measureStart, int64_t measureEnd, const std::atomic<bool>& stop);
+
+    // 결과 (Run 이후)
+    const BenchWorkerResult& GetResult();
+
+private:
+    // private 함수
+    void RunClosedLoop(const std::atomic<bool>& stop);
+    void RunOpenLoop(const std::atomic<bool>& stop);
+
+    // 연결 폭주: 블로킹 소켓으로 연결 -> 메시지 1회 왕복 -> 종료 반복 (지연 = 연결 시작 ~ 에코 수신)
+    void RunAcceptStorm(const std::atomic<bool>& stop);
+
+    // 이벤트 처리 (timeoutMs 동안 대기)
+    void Poll(int timeoutMs, bool closedLoop);
+
+    // 메시지 큐잉 (scheduledTime: 지연 기준 시각)
+    void QueueMessage(Connection& connection, int64_t scheduledTime);
+    void Flush(Connection& connection);
+    void Receive(Connection& connection, bool closedLoop);
+    void UpdateInterest(Connection& connection, bool wantWrite);
+    void CloseConnection(Connection& connection);
+};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <KanchoNet.h>
+#include <pthread.h>
+#include <time.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// 벤치마크용 에코 서버 (출력 없이 받은 데이터를 그대로 전송)
+template<typename TNetworkModel>
+class BenchEchoServer : public KanchoNet::NetworkEngine<TNetworkModel>
+{
+protected:
+    void OnReceive(KanchoNet::Session* session, const uint8_t* data, size_t size) override
+    {
+        this->Send(session, data, size);
+    }
+};
+
+// 프로세스 내 에코 서버 실행기 (모델 종류를 런타임에 선택하기 위한 공통 인터페이스)
+class IBenchServerRunner
+{
+public:
+    virtual ~IBenchServerRunner() = default;
+
+    virtual bool Start(const KanchoNet::EngineConfig& config, uint32_t ioThreads) = 0;
+    virtual void Stop() = 0;
+
+    // I/O 스레드들이 지금까지 사용한 CPU 시간 합 (초, 클라이언트 스레드 제외)
+    virtual double GetCpuSeconds() const = 0;
+
+    // 서버 메트릭 (EngineConfig::mEnableMetrics가 false면 모두 0)
+    virtual KanchoNet::MetricsSnapshot GetMetricsSnapshot() const = 0;
+};
+
+template<typename TNetworkModel>
+class BenchServerRunner : public IBenchServerRunner
+{
+public:
+    // public 멤버변수 (없음)
+
+private:
+    // private 멤버변수
+    BenchEchoServer<TNetworkModel> mServer;
+    std::vector<std::thread> mWorkers;
+    std::vector<clockid_t> mWorkerClocks;   // 스레드별 CPU 시간 시계
+    std::atomic<bool> mRunning;
+
+public:
+    // 생성자, 파괴자
+    BenchServerRunner()
+        : mRunning(false)
+    {
+    }
+
+    ~BenchServerRunner() override
+    {
+        Stop();
+    }
+
+public:
+    // public 함수
+    bool Start(const KanchoNet::EngineConfig& config, uint32_t ioThreads) override
+    {
+        if (!mServer.Initialize(config) || !mServer.Start())
+        {
+            return false;
+        }
+
+        mRunning.store(true);
+        for (uint32_t i = 0; i < ioThreads; ++i)
+        {
+            mWorkers.emplace_back([this]() {
+                while (mRunning.load(std::memory_order_relaxed))
+                {
+                    mServer.ProcessIO(10);
+                }
+            });
+
+            clockid_t clock;
+            if (pthread_getcpuclockid(mWorkers.back().native_handle(), &clock) == 0)
+            {
+                mWorkerClocks.push_back(clock);
+            }
+        }
+
+        return true;
+    }
+
+    void Stop() override
+    {
+        if (!mRunning.exchange(false))
+        {
+            return;
+        }
+
+        for (auto& worker : mWorkers)
+        {
+            worker.join();
+        }
+        mWorkers.clear();
+        mWorkerClocks.clear();
+
+        mServer.Stop();
+    }
+
+    double GetCpuSeconds() const override
+    {
+        double seconds = 0.0;
+        for (clockid_t clock : mWorkerClocks)
+        {
+            struct timespec ts;
+            if (clock_gettime(clock, &ts) == 0)
+            {
+                seconds += ts.tv_sec + ts.tv_nsec / 1e9;
+            }
+        }
+        return seconds;
+    }
+
+    KanchoNet::MetricsSnapshot GetMetricsSnapshot() const override
+    {
+        return mServer.GetMetricsSnapshot();
+    }
+};
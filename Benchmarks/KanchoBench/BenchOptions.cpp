@@ -0,0 +1,175 @@
+#include "BenchOptions.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+bool BenchOptions::Parse(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string key = argv[i];
+        std::string value;
+
+        if (key == "--help" || key == "-h")
+        {
+            PrintUsage(argv[0]);
+            return false;
+        }
+
+        if (key.compare(0, 2, "--") != 0)
+        {
+            fprintf(stderr, "Unknown argument: %s\n", key.c_str());
+            return false;
+        }
+
+        // --key=value 또는 --key value
+        size_t equal = key.find('=');
+        if (equal != std::string::npos)
+        {
+            value = key.substr(equal + 1);
+            key = key.substr(0, equal);
+        }
+        else if (key == "--send-chain")
+        {
+            mServerSendChain = true;
+            continue;
+        }
+        else if (key == "--epoll-oneshot")
+        {
+            mServerEpollOneShot = true;
+            continue;
+        }
+        else if (key == "--accept-storm")
+        {
+            mAcceptStorm = true;
+            continue;
+        }
+        else if (key == "--busy-poll")
+        {
+            mServerBusyPoll = true;
+            continue;
+        }
+        else if (i + 1 < argc)
+        {
+            value = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "Missing value for %s\n", key.c_str());
+            return false;
+        }
+
+        if (key == "--host")                mHost = value;
+        else if (key == "--port")           mPort = static_cast<uint16_t>(strtoul(value.c_str(), nullptr, 10));
+        else if (key == "--server")         mServerModel = value;
+        else if (key == "--server-threads") mServerThreads = static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10));
+        else if (key == "--send-chain")     mServerSendChain = (value == "1" || value == "true");
+        else if (key == "--task-workers")   mServerTaskWorkers = static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10));
+        else if (key == "--epoll-oneshot")  mServerEpollOneShot = (value == "1" || value == "true");
+        else if (key == "--busy-poll")      mServerBusyPoll = (value == "1" || value == "true");
+        else if (key == "--defer-accept")   mServerDeferAcceptSec = static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10));
+        else if (key == "--arena-mb")       mServerArenaMB = static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10));
+        else if (key == "--accept-storm")   mAcceptStorm = (value == "1" || value == "true");
+        else if (key == "--connections")    mConnections = static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10));
+        else if (key == "--threads")        mThreads = static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10));
+        else if (key == "--size")           mMessageSize = static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10));
+        else if (key == "--rate")           mRate = strtoull(value.c_str(), nullptr, 10);
+        else if (key == "--pipeline")       mPipeline = static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10));
+        else if (key == "--duration")       mDurationSec = strtod(value.c_str(), nullptr);
+        else if (key == "--warmup")         mWarmupSec = strtod(value.c_str(), nullptr);
+        else if (key == "--output")         mOutputPath = value;
+        else
+        {
+            fprintf(stderr, "Unknown option: %s\n", key.c_str());
+            return false;
+        }
+    }
+
+    // 기본 epoll 디스패치는 세션별 직렬화가 없어 여러 ProcessIO 스레드가 한 세션을 동시에 처리할 수 있음
+    // (수신/세션 속도 제한 버킷이 락 없이 겹침) 여러 스레드로 돌릴 때는 다중 대기 모드로 전환
+    if (mServerModel == "epoll" && mServerThreads > 1 && !mServerEpollOneShot)
+    {
+        fprintf(stderr, "--server-threads %u with --server epoll requires one-shot dispatch, enabling --epoll-oneshot\n", mServerThreads);
+        mServerEpollOneShot = true;
+    }
+
+    return Validate();
+}
+
+bool BenchOptions::Validate() const
+{
+    if (mServerModel != "none" && mServerModel != "epoll" && mServerModel != "io_uring")
+    {
+        fprintf(stderr, "--server must be one of: none, epoll, io_uring\n");
+        return false;
+    }
+
+    if (mConnections == 0 || mThreads == 0 || mServerThreads == 0)
+    {
+        fprintf(stderr, "--connections, --threads and --server-threads must be positive\n");
+        return false;
+    }
+
+    if (mMessageSize < 8 || mMessageSize > 1024 * 1024)
+    {
+        fprintf(stderr, "--size must be between 8 and 1048576 bytes\n");
+        return false;
+    }
+
+    if (mPipeline == 0)
+    {
+        fprintf(stderr, "--pipeline must be positive\n");
+        return false;
+    }
+
+    if (mServerEpollOneShot && mServerModel != "epoll")
+    {
+        fprintf(stderr, "--epoll-oneshot requires --server epoll\n");
+        return false;
+    }
+
+    if (mAcceptStorm && mRate > 0)
+    {
+        fprintf(stderr, "--accept-storm is closed-loop only, --rate cannot be used with it\n");
+        return false;
+    }
+
+    if (mDurationSec <= 0.0 || mWarmupSec < 0.0)
+    {
+        fprintf(stderr, "--duration must be positive and --warmup non-negative\n");
+        return false;
+    }
+
+    return true;
+}
+
+void BenchOptions::PrintUsage(const char* program)
+{
+    printf("Usage: %s [options]\n", program);
+    printf("\n");
+    printf("Target\n");
+    printf("  --host <addr>            server address (default 127.0.0.1)\n");
+    printf("  --port <port>            server port (default 9000)\n");
+    printf("  --server <model>         run an in-process echo server: none, epoll, io_uring (default none)\n");
+    printf("  --server-threads <n>     ProcessIO threads of the in-process server (default 4)\n");
+    printf("  --send-chain             in-process server uses segment send queue (mUseSendChain)\n");
+    printf("  --task-workers <n>       in-process server runs callbacks on n task workers (default 0 = I/O threads)\n");
+    printf("  --epoll-oneshot          in-process epoll server uses EPOLLEXCLUSIVE/EPOLLONESHOT dispatch (mEpollOneShot,\n");
+    printf("                           always on for --server epoll with --server-threads > 1)\n");
+    printf("  --defer-accept <sec>     in-process server listener uses TCP_DEFER_ACCEPT (mDeferAcceptSec, default 0 = off)\n");
+    printf("  --busy-poll              in-process server spins in ProcessIO (mBusyPoll, io_uring uses SQPOLL)\n");
+    printf("  --arena-mb <n>           in-process server allocates session buffers from a huge-page arena (mBufferArenaSize)\n");
+    printf("\n");
+    printf("Load\n");
+    printf("  --connections <n>        total connections (default 64)\n");
+    printf("  --threads <n>            client threads (default 4)\n");
+    printf("  --size <bytes>           message size, >= 8 (default 64)\n");
+    printf("  --rate <msg/s>           open-loop target rate for all connections, 0 = closed-loop (default 0)\n");
+    printf("  --pipeline <n>           closed-loop messages in flight per connection (default 1)\n");
+    printf("  --accept-storm           each thread loops connect -> one echo -> close instead of keeping connections\n");
+    printf("\n");
+    printf("Measurement\n");
+    printf("  --duration <sec>         measured duration (default 10)\n");
+    printf("  --warmup <sec>           warmup excluded from results (default 1)\n");
+    printf("  --output <path>          also write the JSON result to a file\n");
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// KanchoBench 실행 옵션
+struct BenchOptions
+{
+public:
+    // public 멤버변수
+    // 대상 서버
+    std::string mHost = "127.0.0.1";
+    uint16_t mPort = 9000;
+    std::string mServerModel = "none";      // 프로세스 내 에코 서버 모델 (none, epoll, io_uring)
+    uint32_t mServerThreads = 4;            // 프로세스 내 서버의 ProcessIO 스레드 수
+    bool mServerSendChain = false;          // 프로세스 내 서버의 EngineConfig::mUseSendChain
+    uint32_t mServerTaskWorkers = 0;        // 프로세스 내 서버의 EngineConfig::mTaskWorkerCount
+    bool mServerEpollOneShot = false;       // 프로세스 내 서버의 EngineConfig::mEpollOneShot (epoll 서버 스레드가 2개 이상이면 항상 켜짐)
+    uint32_t mServerDeferAcceptSec = 0;     // 프로세스 내 서버의 EngineConfig::mDeferAcceptSec
+    bool mServerBusyPoll = false;           // 프로세스 내 서버의 EngineConfig::mBusyPoll
+    uint32_t mServerArenaMB = 0;            // 프로세스 내 서버의 EngineConfig::mBufferArenaSize (MB, 0 = 사용 안 함)
+
+    // 부하
+    uint32_t mConnections = 64;             // 전체 연결 수
+    uint32_t mThreads = 4;                  // 클라이언트 스레드 수 (연결을 나눠 가짐)
+    uint32_t mMessageSize = 64;             // 메시지 크기 (바이트, 최소 8 = 송신 시각)
+    uint64_t mRate = 0;                     // 전체 목표 전송률 (메시지/초, 0 = closed-loop)
+    uint32_t mPipeline = 1;                 // closed-loop에서 연결당 동시에 보내둘 메시지 수
+    bool mAcceptStorm = false;              // 연결 폭주: 스레드마다 연결 -> 메시지 1회 왕복 -> 종료를 반복
+
+    // 측정
+    double mDurationSec = 10.0;             // 측정 시간
+    double mWarmupSec = 1.0;                // 워밍업 (결과에서 제외)
+    std::string mOutputPath;                // JSON 결과 파일 (비우면 stdout만)
+
+public:
+    // public 함수
+    // 명령행 파싱 (--key value 또는 --key=value), 실패 시 에러 메시지 출력 후 false
+    bool Parse(int argc, char* argv[]);
+
+    // 옵션 검증
+    bool Validate() const;
+
+    bool IsOpenLoop() const { return mRate > 0; }
+
+    static void PrintUsage(const char* program);
+};
@@ -0,0 +1,326 @@
+#include "BenchOptions.h"
+#include "BenchClient.h"
+#include "BenchEchoServer.h"
+#include <sys/resource.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace KanchoNet;
+
+// 전체 결과
+struct BenchSummary
+{
+    BenchWorkerResult mTotal;
+    double mMeasuredSec = 0.0;
+    double mCpuUserSec = 0.0;           // 측정 구간의 프로세스 CPU 시간 (클라이언트 + 프로세스 내 서버)
+    double mCpuSystemSec = 0.0;
+    double mServerCpuSec = 0.0;         // 측정 구간의 서버 I/O 스레드 CPU 시간
+    long mMaxRssKB = 0;
+    long mRssBeforeConnectKB = 0;       // 서버 시작/연결 전 상주 메모리
+    long mRssConnectedKB = 0;           // 모든 연결 수립 직후 상주 메모리
+    long mRssLoadedKB = 0;              // 측정 구간 종료 시점 상주 메모리 (버퍼가 실제로 사용된 상태)
+    MetricsSnapshot mServerMetrics;     // 측정 구간의 프로세스 내 서버 카운터 증가분 (연결 폭주 모드)
+};
+
+static std::unique_ptr<IBenchServerRunner> CreateServerRunner(const std::string& model)
+{
+    if (model == "epoll")
+    {
+        return std::make_unique<BenchServerRunner<EpollModel>>();
+    }
+
+#ifdef KANCHONET_HAS_LIBURING
+    if (model == "io_uring")
+    {
+        return std::make_unique<BenchServerRunner<IOUringModel>>();
+    }
+#endif
+
+    return nullptr;
+}
+
+// 현재 상주 메모리 (KB, 최대값이 아닌 현재값)
+static long ReadCurrentRssKB()
+{
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (!file)
+    {
+        return 0;
+    }
+
+    long pages = 0;
+    long resident = 0;
+    if (fscanf(file, "%ld %ld", &pages, &resident) != 2)
+    {
+        resident = 0;
+    }
+    fclose(file);
+
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static void GetProcessCpuSeconds(double& userSec, double& systemSec)
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    userSec = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6;
+    systemSec = usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+}
+
+// 두 스냅샷 사이의 카운터 증가분 (히스토그램은 사용하지 않음)
+static MetricsSnapshot DiffCounters(const MetricsSnapshot& begin, const MetricsSnapshot& end)
+{
+    MetricsSnapshot diff;
+    for (size_t i = 0; i < METRIC_COUNTER_COUNT; ++i)
+    {
+        diff.mCounters[i] = end.mCounters[i] - begin.mCounters[i];
+    }
+    return diff;
+}
+
+static double ToMicroseconds(uint64_t nanoseconds)
+{
+    return static_cast<double>(nanoseconds) / 1000.0;
+}
+
+static void WriteJson(FILE* out, const BenchOptions& options, const BenchSummary& summary)
+{
+    const BenchWorkerResult& total = summary.mTotal;
+    const HistogramSnapshot& latency = total.mLatency;
+    const double seconds = summary.mMeasuredSec;
+    const double messages = static_cast<double>(total.mMessagesReceived);
+    const double cpuSec = summary.mCpuUserSec + summary.mCpuSystemSec;
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"tool\": \"KanchoBench\",\n");
+    fprintf(out, "  \"mode\": \"%s\",\n", options.mAcceptStorm ? "accept_storm" : (options.IsOpenLoop() ? "open" : "closed"));
+    fprintf(out, "  \"server_model\": \"%s\",\n", options.mServerModel.c_str());
+    fprintf(out, "  \"server_threads\": %u,\n", options.mServerThreads);
+    fprintf(out, "  \"send_chain\": %s,\n", options.mServerSendChain ? "true" : "false");
+    fprintf(out, "  \"task_workers\": %u,\n", options.mServerTaskWorkers);
+    fprintf(out, "  \"epoll_oneshot\": %s,\n", options.mServerEpollOneShot ? "true" : "false");
+    fprintf(out, "  \"defer_accept_sec\": %u,\n", options.mServerDeferAcceptSec);
+    fprintf(out, "  \"busy_poll\": %s,\n", options.mServerBusyPoll ? "true" : "false");
+    fprintf(out, "  \"arena_mb\": %u,\n", options.mServerArenaMB);
+    fprintf(out, "  \"host\": \"%s\",\n", options.mHost.c_str());
+    fprintf(out, "  \"port\": %u,\n", options.mPort);
+    fprintf(out, "  \"connections\": %u,\n", options.mConnections);
+    fprintf(out, "  \"threads\": %u,\n", options.mThreads);
+    fprintf(out, "  \"message_size\": %u,\n", options.mMessageSize);
+    fprintf(out, "  \"pipeline\": %u,\n", options.mPipeline);
+    fprintf(out, "  \"target_rate\": %llu,\n", static_cast<unsigned long long>(options.mRate));
+    fprintf(out, "  \"duration_sec\": %.3f,\n", seconds);
+    fprintf(out, "  \"messages_sent\": %llu,\n", static_cast<unsigned long long>(total.mMessagesSent));
+    fprintf(out, "  \"messages_received\": %llu,\n", static_cast<unsigned long long>(total.mMessagesReceived));
+    fprintf(out, "  \"sends_skipped\": %llu,\n", static_cast<unsigned long long>(total.mSendsSkipped));
+    fprintf(out, "  \"errors\": %llu,\n", static_cast<unsigned long long>(total.mErrors));
+    fprintf(out, "  \"throughput_msgs_per_sec\": %.1f,\n", seconds > 0.0 ? messages / seconds : 0.0);
+    fprintf(out, "  \"throughput_mib_per_sec\": %.3f,\n",
+            seconds > 0.0 ? static_cast<double>(total.mBytesReceived) / seconds / (1024.0 * 1024.0) : 0.0);
+    if (options.mAcceptStorm)
+    {
+        // 서버 카운터는 프로세스 내 서버를 실행할 때만 채워짐
+        const MetricsSnapshot& metrics = summary.mServerMetrics;
+        const uint64_t accepts = metrics.Get(MetricCounter::Accepts);
+        const uint64_t wakeups = metrics.Get(MetricCounter::PollWakeups);
+
+        fprintf(out, "  \"accept_storm\": {\n");
+        fprintf(out, "    \"connections_completed\": %llu,\n", static_cast<unsigned long long>(total.mConnectionsCompleted));
+        fprintf(out, "    \"connections_per_sec\": %.1f,\n",
+                seconds > 0.0 ? static_cast<double>(total.mConnectionsCompleted) / seconds : 0.0);
+        fprintf(out, "    \"server_accepts\": %llu,\n", static_cast<unsigned long long>(accepts));
+        fprintf(out, "    \"server_poll_wakeups\": %llu,\n", static_cast<unsigned long long>(wakeups));
+        fprintf(out, "    \"server_poll_events\": %llu,\n",
+                static_cast<unsigned long long>(metrics.Get(MetricCounter::PollEvents)));
+        fprintf(out, "    \"server_accept_misses\": %llu,\n",
+                static_cast<unsigned long long>(metrics.Get(MetricCounter::AcceptMisses)));
+        fprintf(out, "    \"server_dispatch_collisions\": %llu,\n",
+                static_cast<unsigned long long>(metrics.Get(MetricCounter::DispatchCollisions)));
+        fprintf(out, "    \"wakeups_per_accept\": %.3f\n",
+                accepts > 0 ? static_cast<double>(wakeups) / static_cast<double>(accepts) : 0.0);
+        fprintf(out, "  },\n");
+    }
+    fprintf(out, "  \"latency_us\": {\n");
+    fprintf(out, "    \"min\": %.3f,\n", ToMicroseconds(latency.GetMin()));
+    fprintf(out, "    \"mean\": %.3f,\n", latency.GetMean() / 1000.0);
+    fprintf(out, "    \"p50\": %.3f,\n", ToMicroseconds(latency.GetValueAtPercentile(50.0)));
+    fprintf(out, "    \"p90\": %.3f,\n", ToMicroseconds(latency.GetValueAtPercentile(90.0)));
+    fprintf(out, "    \"p99\": %.3f,\n", ToMicroseconds(latency.GetValueAtPercentile(99.0)));
+    fprintf(out, "    \"p999\": %.3f,\n", ToMicroseconds(latency.GetValueAtPercentile(99.9)));
+    fprintf(out, "    \"max\": %.3f\n", ToMicroseconds(latency.GetMax()));
+    fprintf(out, "  },\n");
+    fprintf(out, "  \"process\": {\n");
+    fprintf(out, "    \"cpu_user_sec\": %.3f,\n", summary.mCpuUserSec);
+    fprintf(out, "    \"cpu_system_sec\": %.3f,\n", summary.mCpuSystemSec);
+    fprintf(out, "    \"server_cpu_sec\": %.3f,\n", summary.mServerCpuSec);
+    fprintf(out, "    \"cpu_us_per_msg\": %.4f,\n", messages > 0.0 ? cpuSec * 1e6 / messages : 0.0);
+    fprintf(out, "    \"server_cpu_us_per_msg\": %.4f,\n", messages > 0.0 ? summary.mServerCpuSec * 1e6 / messages : 0.0);
+    fprintf(out, "    \"max_rss_kb\": %ld,\n", summary.mMaxRssKB);
+    fprintf(out, "    \"rss_before_connect_kb\": %ld,\n", summary.mRssBeforeConnectKB);
+    fprintf(out, "    \"rss_connected_kb\": %ld,\n", summary.mRssConnectedKB);
+    fprintf(out, "    \"rss_loaded_kb\": %ld,\n", summary.mRssLoadedKB);
+    fprintf(out, "    \"rss_per_connection_kb\": %.2f\n",
+            static_cast<double>(summary.mRssLoadedKB - summary.mRssBeforeConnectKB) / options.mConnections);
+    fprintf(out, "  }\n");
+    fprintf(out, "}\n");
+}
+
+int main(int argc, char* argv[])
+{
+    BenchOptions options;
+    if (!options.Parse(argc, argv))
+    {
+        return 1;
+    }
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    // 연결보다 많은 스레드는 의미 없음
+    options.mThreads = (std::min)(options.mThreads, options.mConnections);
+
+    BenchSummary summary;
+    summary.mRssBeforeConnectKB = ReadCurrentRssKB();
+
+    // 프로세스 내 에코 서버
+    std::unique_ptr<IBenchServerRunner> server;
+    if (options.mServerModel != "none")
+    {
+        server = CreateServerRunner(options.mServerModel);
+        if (!server)
+        {
+            fprintf(stderr, "Server model '%s' is not available in this build\n", options.mServerModel.c_str());
+            return 1;
+        }
+
+        EngineConfig config;
+        config.mPort = options.mPort;
+        config.mMaxSessions = options.mConnections + 16;
+        config.mBacklog = (std::min)((std::max)(options.mConnections, 200u), 10000u);
+        config.mUseSendChain = options.mServerSendChain;
+        config.mTaskWorkerCount = options.mServerTaskWorkers;
+        config.mEpollOneShot = options.mServerEpollOneShot;
+        config.mDeferAcceptSec = options.mServerDeferAcceptSec;
+        config.mBusyPoll = options.mServerBusyPoll;
+        config.mBufferArenaSize = static_cast<size_t>(options.mServerArenaMB) * 1024 * 1024;
+
+        // 연결 폭주 모드에서는 깨어남 횟수를 보기 위해 메트릭 수집 (처리량 측정에는 영향을 주지 않도록 끔)
+        config.mEnableMetrics = options.mAcceptStorm;
+
+        if (!server->Start(config, options.mServerThreads))
+        {
+            fprintf(stderr, "Failed to start %s echo server on port %u\n", options.mServerModel.c_str(), options.mPort);
+            return 1;
+        }
+    }
+
+    // 연결/전송률을 스레드에 분배
+    std::vector<std::unique_ptr<BenchClient>> clients;
+    for (uint32_t i = 0; i < options.mThreads; ++i)
+    {
+        uint32_t connections = options.mConnections / options.mThreads
+                             + ((i < options.mConnections % options.mThreads) ? 1 : 0);
+        double rate = static_cast<double>(options.mRate) * connections / options.mConnections;
+        clients.push_back(std::make_unique<BenchClient>(options, connections, rate));
+    }
+
+    for (auto& client : clients)
+    {
+        if (!client->Connect())
+        {
+            return 1;
+        }
+    }
+
+    summary.mRssConnectedKB = ReadCurrentRssKB();
+
+    // 측정 구간
+    const int64_t start = NetworkMetrics::Now();
+    const int64_t measureStart = start + static_cast<int64_t>(options.mWarmupSec * 1e9);
+    const int64_t measureEnd = measureStart + static_cast<int64_t>(options.mDurationSec * 1e9);
+
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> threads;
+    for (auto& client : clients)
+    {
+        BenchClient* worker = client.get();
+        threads.emplace_back([worker, measureStart, measureEnd, &stop]() {
+            worker->Run(measureStart, measureEnd, stop);
+        });
+    }
+
+    // CPU 시간은 워밍업/드레인을 제외한 측정 구간만 샘플링
+    double userStart = 0.0;
+    double systemStart = 0.0;
+    double userEnd = 0.0;
+    double systemEnd = 0.0;
+
+    std::this_thread::sleep_for(std::chrono::nanoseconds(measureStart - NetworkMetrics::Now()));
+    GetProcessCpuSeconds(userStart, systemStart);
+    const double serverCpuStart = server ? server->GetCpuSeconds() : 0.0;
+    const MetricsSnapshot serverMetricsStart = server ? server->GetMetricsSnapshot() : MetricsSnapshot();
+
+    std::this_thread::sleep_for(std::chrono::nanoseconds(measureEnd - NetworkMetrics::Now()));
+    GetProcessCpuSeconds(userEnd, systemEnd);
+    const double serverCpuEnd = server ? server->GetCpuSeconds() : 0.0;
+    const MetricsSnapshot serverMetricsEnd = server ? server->GetMetricsSnapshot() : MetricsSnapshot();
+    summary.mRssLoadedKB = ReadCurrentRssKB();
+
+    // 측정 종료 직전에 보낸 메시지의 응답을 받을 수 있도록 잠시 더 실행
+    const int64_t drain = 200 * 1000000LL;
+    std::this_thread::sleep_for(std::chrono::nanoseconds(measureEnd + drain - NetworkMetrics::Now()));
+    stop.store(true);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    struct rusage usageEnd;
+    getrusage(RUSAGE_SELF, &usageEnd);
+
+    if (server)
+    {
+        server->Stop();
+    }
+
+    // 결과 합산
+    summary.mMeasuredSec = options.mDurationSec;
+    for (auto& client : clients)
+    {
+        const BenchWorkerResult& result = client->GetResult();
+        summary.mTotal.mMessagesSent += result.mMessagesSent;
+        summary.mTotal.mMessagesReceived += result.mMessagesReceived;
+        summary.mTotal.mBytesReceived += result.mBytesReceived;
+        summary.mTotal.mSendsSkipped += result.mSendsSkipped;
+        summary.mTotal.mErrors += result.mErrors;
+        summary.mTotal.mConnectionsCompleted += result.mConnectionsCompleted;
+        summary.mTotal.mLatency.Merge(result.mLatency);
+    }
+
+    summary.mCpuUserSec = userEnd - userStart;
+    summary.mCpuSystemSec = systemEnd - systemStart;
+    summary.mServerCpuSec = serverCpuEnd - serverCpuStart;
+    summary.mServerMetrics = DiffCounters(serverMetricsStart, serverMetricsEnd);
+    summary.mMaxRssKB = usageEnd.ru_maxrss;
+
+    WriteJson(stdout, options, summary);
+
+    if (!options.mOutputPath.empty())
+    {
+        FILE* file = fopen(options.mOutputPath.c_str(), "w");
+        if (!file)
+        {
+            fprintf(stderr, "Failed to open %s\n", options.mOutputPath.c_str());
+            return 1;
+        }
+        WriteJson(file, options, summary);
+        fclose(file);
+    }
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include "MicroBench.h"
+#include <KanchoNet.h>
+#include <memory>
+#include <vector>
+
+using namespace KanchoNet;
+
+namespace
+{
+    const std::vector<size_t> BUFFER_SIZES = { 64, 512, 4096, 65536 };
+    const std::vector<uint32_t> SINGLE_THREAD = { 1 };
+    const std::vector<uint32_t> POOL_THREADS = { 1, 2, 4, 8 };
+
+    // 스레드별 상태를 서로 다른 캐시 라인에 두기 위한 래퍼
+    template<typename T>
+    struct alignas(64) PerThread
+    {
+        T mValue;
+
+        template<typename... Args>
+        explicit PerThread(Args&&... args) : mValue(std::forward<Args>(args)...) {}
+    };
+}
+
+void RegisterBufferBenchmarks(MicroBenchRunner& runner)
+{
+    // RingBuffer: 쓰기 한 번 + Peek/Skip 한 번 (세션 수신 경로와 같은 패턴)
+    // 버퍼를 충분히 크게 잡고 매 사이클 Clear하여 항상 연속 영역만 사용
+    runner.Add("RingBuffer/WritePeekSkip", BUFFER_SIZES, SINGLE_THREAD, true,
+        [](const MicroBenchParams& params) -> MicroBenchBody {
+            auto ring = std::make_shared<RingBuffer>(params.mSize * 4);
+            auto chunk = std::make_shared<std::vector<uint8_t>>(params.mSize, 0x5A);
+            auto out = std::make_shared<std::vector<uint8_t>>(params.mSize);
+
+            return [ring, chunk, out](uint32_t, uint64_t iterations) {
+                const size_t size = chunk->size();
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    ring->Write(chunk->data(), size);
+                    size_t peeked = ring->Peek(out->data(), size);
+                    ring->Skip(peeked);
+                    ring->Clear();
+                    DoNotOptimize(out->data()[0]);
+                }
+            };
+        });
+
+    // 용량을 1.5배 청크로 잡아 두 번에 한 번은 끝을 넘어 감싸는(wrap) 복사가 일어나도록 함
+    runner.Add("RingBuffer/WritePeekSkip/Wrap", BUFFER_SIZES, SINGLE_THREAD, true,
+        [](const MicroBenchParams& params) -> MicroBenchBody {
+            auto ring = std::make_shared<RingBuffer>(params.mSize * 3 / 2);
+            auto chunk = std::make_shared<std::vector<uint8_t>>(params.mSize, 0x5A);
+            auto out = std::make_shared<std::vector<uint8_t>>(params.mSize);
+
+            return [ring, chunk, out](uint32_t, uint64_t iterations) {
+                const size_t size = chunk->size();
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    ring->Write(chunk->data(), size);
+                    size_t peeked = ring->Peek(out->data(), size);
+                    ring->Skip(peeked);
+                    DoNotOptimize(out->data()[0]);
+                }
+            };
+        });
+
+    // PacketBuffer: 데이터 복사 생성 (송신 시 패킷 생성 비용)
+    runner.Add("PacketBuffer/Construct", BUFFER_SIZES, SINGLE_THREAD, true,
+        [](const MicroBenchParams& params) -> MicroBenchBody {
+            auto chunk = std::make_shared<std::vector<uint8_t>>(params.mSize, 0x5A);
+
+            return [chunk](uint32_t, uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    PacketBuffer buffer(chunk->data(), chunk->size());
+                    DoNotOptimize(buffer.GetData());
+                }
+            };
+        });
+
+    // 헤더 + 본문을 나눠 붙이는 직렬화 패턴 (미리 확보한 용량 재사용)
+    runner.Add("PacketBuffer/Append", BUFFER_SIZES, SINGLE_THREAD, true,
+        [](const MicroBenchParams& params) -> MicroBenchBody {
+            auto chunk = std::make_shared<std::vector<uint8_t>>(params.mSize, 0x5A);
+            auto buffer = std::make_shared<PacketBuffer>(params.mSize + sizeof(uint32_t));
+
+            return [chunk, buffer](uint32_t, uint64_t iterations) {
+                const uint32_t header = static_cast<uint32_t>(chunk->size());
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    buffer->Clear();
+                    buffer->Append(&header, sizeof(header));
+                    buffer->Append(chunk->data(), chunk->size());
+                    DoNotOptimize(buffer->GetData());
+                }
+            };
+        });
+
+    // 복사 생성 (브로드캐스트 시 세션마다 복사하던 비용)
+    runner.Add("PacketBuffer/Copy", BUFFER_SIZES, SINGLE_THREAD, true,
+        [](const MicroBenchParams& params) -> MicroBenchBody {
+            std::vector<uint8_t> chunk(params.mSize, 0x5A);
+            auto source = std::make_shared<PacketBuffer>(chunk.data(), chunk.size());
+
+            return [source](uint32_t, uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    PacketBuffer copy(*source);
+                    DoNotOptimize(copy.GetData());
+                }
+            };
+        });
+
+    // BufferPool: 할당/반환 왕복 (스레드 수를 늘려 풀 뮤텍스 경합 측정)
+    runner.Add("BufferPool/AllocateFree", { 4096 }, POOL_THREADS, false,
+        [](const MicroBenchParams& params) -> MicroBenchBody {
+            auto pool = std::make_shared<BufferPool>(params.mSize, params.mThreads * 4);
+
+            return [pool](uint32_t, uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    std::unique_ptr<PacketBuffer> buffer = pool->Allocate();
+                    DoNotOptimize(buffer.get());
+                    pool->Deallocate(std::move(buffer));
+                }
+            };
+        });
+
+    // 같은 작업을 스레드 로컬 PacketBuffer로 했을 때의 기준선 (경합이 없는 하한)
+    runner.Add("BufferPool/ThreadLocalBaseline", { 4096 }, POOL_THREADS, false,
+        [](const MicroBenchParams& params) -> MicroBenchBody {
+            auto buffers = std::make_shared<std::vector<PerThread<PacketBuffer>>>();
+            buffers->reserve(params.mThreads);
+            for (uint32_t i = 0; i < params.mThreads; ++i)
+            {
+                buffers->emplace_back(params.mSize);
+            }
+
+            return [buffers](uint32_t threadIndex, uint64_t iterations) {
+                PacketBuffer& buffer = (*buffers)[threadIndex].mValue;
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    buffer.Clear();
+                    DoNotOptimize(buffer.GetData());
+                }
+            };
+        });
+}
@@ -0,0 +1,170 @@
+#include "MicroBench.h"
+#include <KanchoNet.h>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace KanchoNet;
+
+namespace
+{
+    const std::vector<uint32_t> COMPRESSION_THREADS = { 1 };
+    const std::vector<size_t> PAYLOAD_SIZES = { 256, 1024, 4096, 16384 };
+    const size_t RECV_BUFFER_SIZE = 64 * 1024;
+
+    // 측정용 압축 설정 (크기 조합을 모두 압축하도록 임계값은 가장 작은 크기로)
+    CompressionConfig MakeBenchConfig(bool enabled)
+    {
+        CompressionConfig config;
+        config.mEnabled = enabled;
+        config.mThreshold = 256;
+        return config;
+    }
+
+    // 방 상태 스냅샷: 엔티티 레코드 배열 (PacketWriter 바이너리, 좌표는 실수라 압축이 잘 되지 않는 편)
+    std::shared_ptr<PacketBuffer> MakeRoomSnapshot(size_t size)
+    {
+        static const char* const NAMES[] = { "Player_", "Goblin", "Orc_Warrior", "Skeleton_Archer", "Merchant" };
+
+        std::mt19937 random(7);
+        auto packet = std::make_shared<PacketBuffer>();
+        PacketWriter writer(*packet);
+        writer.Reserve(4);
+        writer.Write<uint32_t>(42);     // 방 ID
+        writer.Write<uint32_t>(123456); // 틱
+
+        for (uint32_t entity = 0; writer.GetSize() < size; ++entity)
+        {
+            const uint32_t kind = random() % 5;
+            writer.WriteVarint(100000 + entity);
+            writer.Write<uint8_t>(static_cast<uint8_t>(kind));
+            writer.Write<float>(static_cast<float>(random() % 20000) / 100.0f);
+            writer.Write<float>(0.0f);
+            writer.Write<float>(static_cast<float>(random() % 20000) / 100.0f);
+            writer.Write<uint16_t>(static_cast<uint16_t>(random() % 4 == 0 ? random() % 100 : 100));
+            writer.Write<uint8_t>(static_cast<uint8_t>(random() % 3));
+            writer.WriteString(kind == 0 ? std::string(NAMES[0]) + std::to_string(random() % 10000) : NAMES[kind]);
+        }
+
+        packet->Resize(size);
+        return packet;
+    }
+
+    // 채팅 기록: "[시:분:초] 이름: 내용" 줄 (텍스트라 압축이 잘 되는 편)
+    std::shared_ptr<PacketBuffer> MakeChatHistory(size_t size)
+    {
+        static const char* const USERS[] = { "kancho", "dragon_slayer", "healer99", "tank_main", "guild_master" };
+        static const char* const WORDS[] = { "raid", "tonight", "need", "healer", "for", "the", "boss", "gg", "wp",
+                                             "anyone", "selling", "potions", "lfg", "dungeon", "at", "9pm", "ok", "thanks" };
+
+        std::mt19937 random(11);
+        std::string text;
+        uint32_t seconds = 20 * 3600;
+        while (text.size() < size)
+        {
+            seconds += random() % 30;
+            char line[64];
+            snprintf(line, sizeof(line), "[%02u:%02u:%02u] %s: ", seconds / 3600 % 24, seconds / 60 % 60, seconds % 60,
+                     USERS[random() % 5]);
+            text += line;
+
+            const uint32_t words = 2 + random() % 8;
+            for (uint32_t i = 0; i < words; ++i)
+            {
+                text += WORDS[random() % 18];
+                text += (i + 1 < words) ? ' ' : '\n';
+            }
+        }
+
+        return std::make_shared<PacketBuffer>(text.data(), size);
+    }
+
+    // 이미 압축/암호화된 데이터 (압축 도중 포기하는 비용)
+    std::shared_ptr<PacketBuffer> MakeIncompressible(size_t size)
+    {
+        std::mt19937 random(13);
+        auto packet = std::make_shared<PacketBuffer>();
+        packet->Resize(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            packet->GetData()[i] = static_cast<uint8_t>(random());
+        }
+        return packet;
+    }
+
+    using PayloadMaker = std::shared_ptr<PacketBuffer> (*)(size_t);
+
+    // 페이로드 종류별 케이스 등록 (처리량은 원본 바이트 기준, out/in은 프레임 크기 / 원본 크기)
+    void RegisterPayloadBenchmarks(MicroBenchRunner& runner, const std::string& name, PayloadMaker makePayload)
+    {
+        auto ratio = [makePayload](const MicroBenchParams& params) {
+            PacketCompressor compressor(MakeBenchConfig(true));
+            PacketBuffer frame;
+            compressor.Encode(makePayload(params.mSize)->GetData(), params.mSize, frame);
+            return static_cast<double>(frame.GetSize()) / static_cast<double>(params.mSize);
+        };
+
+        // 송신: 프레임 하나 만들기 (브로드캐스트는 이 비용을 수신자 수와 관계없이 한 번만 냄)
+        runner.Add("Compress/" + name + "/Encode", PAYLOAD_SIZES, COMPRESSION_THREADS, true,
+            [makePayload](const MicroBenchParams& params) -> MicroBenchBody {
+                auto payload = makePayload(params.mSize);
+                auto compressor = std::make_shared<PacketCompressor>(MakeBenchConfig(true));
+
+                return [payload, compressor](uint32_t, uint64_t iterations) {
+                    PacketBuffer frame(payload->GetSize() + PacketCompressor::COMPRESSED_HEADER_SIZE);
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        frame.Clear();
+                        compressor->Encode(payload->GetData(), payload->GetSize(), frame);
+                        DoNotOptimize(frame.GetData());
+                    }
+                };
+            }, ratio);
+
+        // 수신: 수신 버퍼에 쌓인 프레임을 풀 버퍼로 해제
+        runner.Add("Compress/" + name + "/Decode", PAYLOAD_SIZES, COMPRESSION_THREADS, true,
+            [makePayload](const MicroBenchParams& params) -> MicroBenchBody {
+                auto compressor = std::make_shared<PacketCompressor>(MakeBenchConfig(true));
+                auto frame = std::make_shared<PacketBuffer>();
+                compressor->Encode(makePayload(params.mSize)->GetData(), params.mSize, *frame);
+
+                return [compressor, frame](uint32_t, uint64_t iterations) {
+                    RingBuffer recvBuffer(RECV_BUFFER_SIZE);
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        recvBuffer.Write(frame->GetData(), frame->GetSize());
+
+                        std::unique_ptr<PacketBuffer> packet;
+                        DoNotOptimize(compressor->Decode(recvBuffer, packet));
+                        DoNotOptimize(packet->GetData());
+                        compressor->Release(std::move(packet));
+                    }
+                };
+            }, ratio);
+    }
+}
+
+void RegisterCompressionBenchmarks(MicroBenchRunner& runner)
+{
+    // 기준: 압축 없이 프레이밍만 (복사 비용)
+    runner.Add("Compress/Disabled/Encode", PAYLOAD_SIZES, COMPRESSION_THREADS, true,
+        [](const MicroBenchParams& params) -> MicroBenchBody {
+            auto payload = MakeRoomSnapshot(params.mSize);
+            auto compressor = std::make_shared<PacketCompressor>(MakeBenchConfig(false));
+
+            return [payload, compressor](uint32_t, uint64_t iterations) {
+                PacketBuffer frame(payload->GetSize() + PacketCompressor::COMPRESSED_HEADER_SIZE);
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    frame.Clear();
+                    compressor->Encode(payload->GetData(), payload->GetSize(), frame);
+                    DoNotOptimize(frame.GetData());
+                }
+            };
+        });
+
+    RegisterPayloadBenchmarks(runner, "RoomSnapshot", MakeRoomSnapshot);
+    RegisterPayloadBenchmarks(runner, "ChatHistory", MakeChatHistory);
+    RegisterPayloadBenchmarks(runner, "Incompressible", MakeIncompressible);
+}
@@ -0,0 +1,207 @@
+#include "MicroBench.h"
+#include <KanchoNet.h>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace KanchoNet;
+
+namespace
+{
+    const std::vector<uint32_t> DISPATCH_THREADS = { 1 };
+    const size_t STREAM_PACKETS = 4096;     // 미리 만들어 두는 패킷 수 (순환하며 처리)
+
+    // 측정용 프로토콜 (크기가 서로 다른 패킷 8종)
+    enum class BenchPacketType : uint16_t
+    {
+        Move = 1,
+        Attack,
+        Chat,
+        UseItem,
+        Ping,
+        Emote,
+        Trade,
+        Logout
+    };
+
+    struct BenchHeader
+    {
+        uint16_t size;
+        BenchPacketType type;
+    };
+
+    struct MovePacket { BenchHeader header; float x, y, z; };
+    struct AttackPacket { BenchHeader header; uint32_t target; uint32_t skill; };
+    struct ChatPacket { BenchHeader header; char message[120]; };
+    struct UseItemPacket { BenchHeader header; uint32_t item; };
+    struct PingPacket { BenchHeader header; uint64_t time; };
+    struct EmotePacket { BenchHeader header; uint16_t emote; uint16_t pad; };
+    struct TradePacket { BenchHeader header; uint32_t target; uint32_t items[8]; };
+    struct LogoutPacket { BenchHeader header; };
+
+    // 핸들러가 하는 일은 같게 두고 분기 비용만 비교
+    struct BenchContext
+    {
+        uint64_t mSum = 0;
+
+        void OnMove(Session*, const MovePacket& packet) { mSum += static_cast<uint64_t>(packet.x); }
+        void OnAttack(Session*, const AttackPacket& packet) { mSum += packet.target ^ packet.skill; }
+        void OnChat(Session*, const ChatPacket& packet) { mSum += static_cast<uint8_t>(packet.message[0]); }
+        void OnUseItem(Session*, const UseItemPacket& packet) { mSum += packet.item; }
+        void OnPing(Session*, const PingPacket& packet) { mSum += packet.time; }
+        void OnEmote(Session*, const EmotePacket& packet) { mSum += packet.emote; }
+        void OnTrade(Session*, const TradePacket& packet) { mSum += packet.items[0] + packet.target; }
+        void OnLogout(Session*, const LogoutPacket&) { ++mSum; }
+    };
+
+    using BenchDispatcher = PacketDispatcher<BenchHeader,
+        PacketHandler<BenchPacketType::Move, MovePacket, &BenchContext::OnMove>,
+        PacketHandler<BenchPacketType::Attack, AttackPacket, &BenchContext::OnAttack>,
+        PacketHandler<BenchPacketType::Chat, ChatPacket, &BenchContext::OnChat>,
+        PacketHandler<BenchPacketType::UseItem, UseItemPacket, &BenchContext::OnUseItem>,
+        PacketHandler<BenchPacketType::Ping, PingPacket, &BenchContext::OnPing>,
+        PacketHandler<BenchPacketType::Emote, EmotePacket, &BenchContext::OnEmote>,
+        PacketHandler<BenchPacketType::Trade, TradePacket, &BenchContext::OnTrade>,
+        PacketHandler<BenchPacketType::Logout, LogoutPacket, &BenchContext::OnLogout>>;
+
+    // 수신 버퍼처럼 패킷이 이어 붙은 스트림
+    struct PacketStream
+    {
+        std::vector<uint8_t> mData;
+        std::vector<size_t> mOffsets;
+    };
+
+    template<typename TPacket>
+    void AppendPacket(PacketStream& stream, BenchPacketType type, uint32_t seed)
+    {
+        TPacket packet;
+        memset(&packet, static_cast<int>(seed & 0x7F), sizeof(packet));
+        packet.header.size = static_cast<uint16_t>(sizeof(packet));
+        packet.header.type = type;
+
+        stream.mOffsets.push_back(stream.mData.size());
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&packet);
+        stream.mData.insert(stream.mData.end(), bytes, bytes + sizeof(packet));
+    }
+
+    // 패킷 종류를 무작위로 섞은 스트림 (분기 예측이 쉽지 않도록)
+    std::shared_ptr<PacketStream> MakeStream()
+    {
+        auto stream = std::make_shared<PacketStream>();
+        std::mt19937 random(12345);
+
+        for (size_t i = 0; i < STREAM_PACKETS; ++i)
+        {
+            const uint32_t seed = random();
+            switch (static_cast<BenchPacketType>(seed % 8 + 1))
+            {
+            case BenchPacketType::Move: AppendPacket<MovePacket>(*stream, BenchPacketType::Move, seed); break;
+            case BenchPacketType::Attack: AppendPacket<AttackPacket>(*stream, BenchPacketType::Attack, seed); break;
+            case BenchPacketType::Chat: AppendPacket<ChatPacket>(*stream, BenchPacketType::Chat, seed); break;
+            case BenchPacketType::UseItem: AppendPacket<UseItemPacket>(*stream, BenchPacketType::UseItem, seed); break;
+            case BenchPacketType::Ping: AppendPacket<PingPacket>(*stream, BenchPacketType::Ping, seed); break;
+            case BenchPacketType::Emote: AppendPacket<EmotePacket>(*stream, BenchPacketType::Emote, seed); break;
+            case BenchPacketType::Trade: AppendPacket<TradePacket>(*stream, BenchPacketType::Trade, seed); break;
+            case BenchPacketType::Logout: AppendPacket<LogoutPacket>(*stream, BenchPacketType::Logout, seed); break;
+            }
+        }
+
+        return stream;
+    }
+
+    // 직접 작성한 switch 분기 (디스패처와 같은 크기 검사/정렬 처리 포함)
+    template<typename TPacket, typename THandler>
+    bool HandleChecked(BenchContext& context, const uint8_t* data, size_t packetSize, THandler handler)
+    {
+        if (packetSize != sizeof(TPacket))
+        {
+            return false;
+        }
+
+        if (reinterpret_cast<uintptr_t>(data) % alignof(TPacket) == 0)
+        {
+            (context.*handler)(nullptr, *reinterpret_cast<const TPacket*>(data));
+        }
+        else
+        {
+            TPacket packet;
+            memcpy(&packet, data, sizeof(packet));
+            (context.*handler)(nullptr, packet);
+        }
+        return true;
+    }
+
+    bool SwitchDispatch(BenchContext& context, const uint8_t* data, size_t size)
+    {
+        if (size < sizeof(BenchHeader))
+        {
+            return false;
+        }
+
+        BenchHeader header;
+        memcpy(&header, data, sizeof(header));
+        if (header.size > size)
+        {
+            return false;
+        }
+
+        switch (header.type)
+        {
+        case BenchPacketType::Move: return HandleChecked<MovePacket>(context, data, header.size, &BenchContext::OnMove);
+        case BenchPacketType::Attack: return HandleChecked<AttackPacket>(context, data, header.size, &BenchContext::OnAttack);
+        case BenchPacketType::Chat: return HandleChecked<ChatPacket>(context, data, header.size, &BenchContext::OnChat);
+        case BenchPacketType::UseItem: return HandleChecked<UseItemPacket>(context, data, header.size, &BenchContext::OnUseItem);
+        case BenchPacketType::Ping: return HandleChecked<PingPacket>(context, data, header.size, &BenchContext::OnPing);
+        case BenchPacketType::Emote: return HandleChecked<EmotePacket>(context, data, header.size, &BenchContext::OnEmote);
+        case BenchPacketType::Trade: return HandleChecked<TradePacket>(context, data, header.size, &BenchContext::OnTrade);
+        case BenchPacketType::Logout: return HandleChecked<LogoutPacket>(context, data, header.size, &BenchContext::OnLogout);
+        default: return false;
+        }
+    }
+}
+
+void RegisterDispatchBenchmarks(MicroBenchRunner& runner)
+{
+    // 기준: 패킷 타입 switch + 크기 검사
+    runner.Add("Dispatch/Switch", {}, DISPATCH_THREADS, false,
+        [](const MicroBenchParams&) -> MicroBenchBody {
+            auto stream = MakeStream();
+
+            return [stream](uint32_t, uint64_t iterations) {
+                BenchContext context;
+                const uint8_t* begin = stream->mData.data();
+                const size_t total = stream->mData.size();
+                size_t index = 0;
+
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    const size_t offset = stream->mOffsets[index];
+                    DoNotOptimize(SwitchDispatch(context, begin + offset, total - offset));
+                    index = (index + 1) % STREAM_PACKETS;
+                }
+                DoNotOptimize(context.mSum);
+            };
+        });
+
+    // PacketDispatcher 점프 테이블
+    runner.Add("Dispatch/Table", {}, DISPATCH_THREADS, false,
+        [](const MicroBenchParams&) -> MicroBenchBody {
+            auto stream = MakeStream();
+
+            return [stream](uint32_t, uint64_t iterations) {
+                BenchContext context;
+                const uint8_t* begin = stream->mData.data();
+                const size_t total = stream->mData.size();
+                size_t index = 0;
+
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    const size_t offset = stream->mOffsets[index];
+                    DoNotOptimize(BenchDispatcher::Dispatch(context, nullptr, begin + offset, total - offset));
+                    index = (index + 1) % STREAM_PACKETS;
+                }
+                DoNotOptimize(context.mSum);
+            };
+        });
+}
@@ -0,0 +1,323 @@
+#include "MicroBench.h"
+#include <Platform.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#ifdef KANCHONET_PLATFORM_LINUX
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    // 호출 스레드의 하드웨어 캐시 미스 카운터 (사용자 모드만, 마지막 레벨 캐시 기준)
+    // 가상 머신처럼 PMU가 없거나 perf_event_paranoid로 막힌 환경에서는 열리지 않음
+    class CacheMissCounter
+    {
+    public:
+        // public 멤버변수 (없음)
+
+    private:
+        // private 멤버변수
+        int mFd;
+
+    public:
+        // 생성자, 파괴자
+        CacheMissCounter()
+            : mFd(-1)
+        {
+        #ifdef KANCHONET_PLATFORM_LINUX
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            mFd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        #endif
+        }
+
+        ~CacheMissCounter()
+        {
+        #ifdef KANCHONET_PLATFORM_LINUX
+            if (mFd >= 0)
+            {
+                close(mFd);
+            }
+        #endif
+        }
+
+        CacheMissCounter(const CacheMissCounter&) = delete;
+        CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+
+    public:
+        // public 함수
+        bool IsOpen() const { return mFd >= 0; }
+
+        void Start()
+        {
+        #ifdef KANCHONET_PLATFORM_LINUX
+            ioctl(mFd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(mFd, PERF_EVENT_IOC_ENABLE, 0);
+        #endif
+        }
+
+        // 반환값: Start 이후 캐시 미스 수 (읽지 못하면 음수)
+        double Stop()
+        {
+        #ifdef KANCHONET_PLATFORM_LINUX
+            ioctl(mFd, PERF_EVENT_IOC_DISABLE, 0);
+            uint64_t count = 0;
+            if (read(mFd, &count, sizeof(count)) == static_cast<ssize_t>(sizeof(count)))
+            {
+                return static_cast<double>(count);
+            }
+        #endif
+            return -1.0;
+        }
+    };
+
+    // 카운터를 켠 채 본문 실행 (counting이 false면 본문만)
+    // 반환값: 캐시 미스 수 (측정하지 않았거나 실패하면 음수)
+    double RunCounted(const MicroBenchBody& body, uint32_t threadIndex, uint64_t iterations, bool counting)
+    {
+        if (!counting)
+        {
+            body(threadIndex, iterations);
+            return -1.0;
+        }
+
+        CacheMissCounter counter;
+        if (!counter.IsOpen())
+        {
+            body(threadIndex, iterations);
+            return -1.0;
+        }
+
+        counter.Start();
+        body(threadIndex, iterations);
+        return counter.Stop();
+    }
+}
+
+void MicroBenchRunner::Add(const std::string& name, const std::vector<size_t>& sizes,
+                           const std::vector<uint32_t>& threads, bool countBytes, MicroBenchFactory factory,
+                           MicroBenchRatio ratio)
+{
+    Case benchCase;
+    benchCase.mName = name;
+    benchCase.mSizes = sizes.empty() ? std::vector<size_t>{ 0 } : sizes;
+    benchCase.mThreads = threads.empty() ? std::vector<uint32_t>{ 1 } : threads;
+    benchCase.mCountBytes = countBytes;
+    benchCase.mFactory = std::move(factory);
+    benchCase.mRatio = std::move(ratio);
+    mCases.push_back(std::move(benchCase));
+}
+
+void MicroBenchRunner::Run(const MicroBenchOptions& options, FILE* out)
+{
+    fprintf(out, "%-44s %8s %7s %12s %12s %14s %12s %8s %9s\n",
+            "benchmark", "size", "threads", "ns/op", "min ns/op", "ops/s", "MiB/s", "out/in", "miss/op");
+
+    for (const Case& benchCase : mCases)
+    {
+        if (!options.mFilter.empty() && benchCase.mName.find(options.mFilter) == std::string::npos)
+        {
+            continue;
+        }
+
+        for (uint32_t threads : benchCase.mThreads)
+        {
+            for (size_t size : benchCase.mSizes)
+            {
+                MicroBenchParams params;
+                params.mSize = size;
+                params.mThreads = threads;
+
+                MicroBenchResult result = RunCase(benchCase, params, options);
+                mResults.push_back(result);
+
+                char ratio[16] = "-";
+                if (benchCase.mRatio)
+                {
+                    snprintf(ratio, sizeof(ratio), "%.3f", result.mOutputRatio);
+                }
+
+                char misses[16] = "-";
+                if (result.mCacheMissesPerOp >= 0.0)
+                {
+                    snprintf(misses, sizeof(misses), "%.3f", result.mCacheMissesPerOp);
+                }
+
+                fprintf(out, "%-44s %8zu %7u %12.1f %12.1f %14.0f %12.1f %8s %9s\n",
+                        result.mName.c_str(), size, threads, result.mNsPerOp, result.mNsPerOpMin,
+                        result.mOpsPerSec, result.mBytesPerSec / (1024.0 * 1024.0), ratio, misses);
+                fflush(out);
+            }
+        }
+    }
+}
+
+bool MicroBenchRunner::WriteJson(const std::string& path) const
+{
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file)
+    {
+        return false;
+    }
+
+    // 커밋 간 diff가 쉽도록 결과 한 건을 한 줄로 기록
+    fprintf(file, "{\n");
+    fprintf(file, "  \"tool\": \"KanchoNetMicroBench\",\n");
+    fprintf(file, "  \"cpus\": %u,\n", std::thread::hardware_concurrency());
+    fprintf(file, "  \"results\": [\n");
+    for (size_t i = 0; i < mResults.size(); ++i)
+    {
+        const MicroBenchResult& result = mResults[i];
+
+        // 측정하지 못한 카운터는 null
+        char misses[32] = "null";
+        if (result.mCacheMissesPerOp >= 0.0)
+        {
+            snprintf(misses, sizeof(misses), "%.4f", result.mCacheMissesPerOp);
+        }
+
+        fprintf(file, "    {\"name\": \"%s\", \"size\": %zu, \"threads\": %u, \"iterations\": %llu, "
+                      "\"ns_per_op\": %.2f, \"ns_per_op_min\": %.2f, \"ops_per_sec\": %.0f, \"bytes_per_sec\": %.0f, "
+                      "\"output_ratio\": %.4f, \"cache_misses_per_op\": %s}%s\n",
+                result.mName.c_str(), result.mParams.mSize, result.mParams.mThreads,
+                static_cast<unsigned long long>(result.mIterations), result.mNsPerOp, result.mNsPerOpMin,
+                result.mOpsPerSec, result.mBytesPerSec, result.mOutputRatio, misses, (i + 1 < mResults.size()) ? "," : "");
+    }
+    fprintf(file, "  ]\n");
+    fprintf(file, "}\n");
+
+    fclose(file);
+    return true;
+}
+
+double MicroBenchRunner::Measure(const MicroBenchBody& body, uint32_t threads, uint64_t iterations, double* cacheMisses)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const bool counting = (cacheMisses != nullptr);
+
+    if (threads <= 1)
+    {
+        Clock::time_point start = Clock::now();
+        const double misses = RunCounted(body, 0, iterations, counting);
+        const double elapsed = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        if (counting)
+        {
+            *cacheMisses = misses;
+        }
+        return elapsed;
+    }
+
+    // 모든 스레드가 준비된 뒤 동시에 출발 (스레드 생성 비용 제외)
+    std::atomic<uint32_t> ready(0);
+    std::atomic<bool> go(false);
+    std::vector<double> threadMisses(threads, -1.0);
+    std::vector<std::thread> workers;
+
+    for (uint32_t i = 0; i < threads; ++i)
+    {
+        workers.emplace_back([&body, &ready, &go, &threadMisses, i, iterations, counting]() {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+            threadMisses[i] = RunCounted(body, i, iterations, counting);
+        });
+    }
+
+    while (ready.load() < threads)
+    {
+        std::this_thread::yield();
+    }
+
+    Clock::time_point start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    const double elapsed = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+
+    if (counting)
+    {
+        *cacheMisses = 0.0;
+        for (double misses : threadMisses)
+        {
+            if (misses < 0.0)
+            {
+                *cacheMisses = -1.0;
+                break;
+            }
+            *cacheMisses += misses;
+        }
+    }
+
+    return elapsed;
+}
+
+MicroBenchResult MicroBenchRunner::RunCase(const Case& benchCase, const MicroBenchParams& params,
+                                           const MicroBenchOptions& options)
+{
+    MicroBenchBody body = benchCase.mFactory(params);
+    const double minTimeNs = options.mMinTimeSec * 1e9;
+
+    // 최소 측정 시간을 넘길 때까지 반복 수 증가
+    uint64_t iterations = 1;
+    while (true)
+    {
+        double elapsed = Measure(body, params.mThreads, iterations);
+        if (elapsed >= minTimeNs || iterations >= (1ull << 40))
+        {
+            break;
+        }
+
+        double scale = (elapsed > 0.0) ? (minTimeNs * 1.2 / elapsed) : 10.0;
+        scale = (std::min)((std::max)(scale, 2.0), 10.0);
+        iterations = static_cast<uint64_t>(static_cast<double>(iterations) * scale);
+    }
+
+    std::vector<double> nsPerOp;
+    for (uint32_t i = 0; i < (std::max)(options.mRepetitions, 1u); ++i)
+    {
+        nsPerOp.push_back(Measure(body, params.mThreads, iterations) / static_cast<double>(iterations));
+    }
+    std::sort(nsPerOp.begin(), nsPerOp.end());
+
+    MicroBenchResult result;
+    result.mName = benchCase.mName;
+    result.mParams = params;
+    result.mIterations = iterations;
+    result.mNsPerOp = nsPerOp[nsPerOp.size() / 2];
+    result.mNsPerOpMin = nsPerOp.front();
+    result.mOpsPerSec = (result.mNsPerOp > 0.0) ? 1e9 / result.mNsPerOp * params.mThreads : 0.0;
+    result.mBytesPerSec = benchCase.mCountBytes ? result.mOpsPerSec * static_cast<double>(params.mSize) : 0.0;
+    result.mOutputRatio = benchCase.mRatio ? benchCase.mRatio(params) : 0.0;
+
+    // 카운터는 시간 측정과 별도로 한 번 더 실행해 읽음 (카운터 읽기 비용이 시간에 섞이지 않도록)
+    if (options.mPerfCounters)
+    {
+        double misses = -1.0;
+        Measure(body, params.mThreads, iterations, &misses);
+        if (misses >= 0.0)
+        {
+            result.mCacheMissesPerOp = misses / (static_cast<double>(iterations) * params.mThreads);
+        }
+    }
+
+    return result;
+}
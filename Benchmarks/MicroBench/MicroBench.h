@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// 마이크로벤치마크 파라미터
+struct MicroBenchParams
+{
+    size_t mSize = 0;           // 데이터 크기 (바이트, 크기와 무관한 케이스는 0)
+    uint32_t mThreads = 1;      // 동시에 실행할 스레드 수
+};
+
+// 측정 본문: 스레드마다 호출되며 iterations번 연산을 수행
+using MicroBenchBody = std::function<void(uint32_t threadIndex, uint64_t iterations)>;
+
+// 파라미터 조합마다 호출되어 공유 상태를 준비하고 측정 본문을 반환
+using MicroBenchFactory = std::function<MicroBenchBody(const MicroBenchParams& params)>;
+
+// 케이스 준비 후 한 번 계산하는 출력/입력 크기 비율 (압축률 등, 시간과 함께 보고)
+using MicroBenchRatio = std::function<double(const MicroBenchParams& params)>;
+
+// 실행 옵션
+struct MicroBenchOptions
+{
+    std::string mFilter;            // 이름에 포함되어야 하는 문자열 (비우면 전체)
+    double mMinTimeSec = 0.2;       // 반복 1회의 최소 측정 시간
+    uint32_t mRepetitions = 5;      // 반복 횟수 (중앙값 보고)
+    std::string mJsonPath;          // JSON 결과 파일 (비우면 생략)
+    bool mPerfCounters = false;     // 하드웨어 캐시 미스 카운터도 측정 (Linux perf_event, 열지 못하면 "-")
+};
+
+// 측정 결과 (반복 중 중앙값 기준)
+struct MicroBenchResult
+{
+    std::string mName;
+    MicroBenchParams mParams;
+    uint64_t mIterations = 0;       // 반복 1회에서 스레드당 연산 수
+    double mNsPerOp = 0.0;          // 연산 1회 시간 (스레드 관점, 중앙값)
+    double mNsPerOpMin = 0.0;       // 연산 1회 시간 (최솟값)
+    double mOpsPerSec = 0.0;        // 전체 스레드 합산 처리량
+    double mBytesPerSec = 0.0;      // 전체 처리 바이트 (크기 기반 케이스만)
+    double mOutputRatio = 0.0;      // 출력/입력 크기 비율 (비율을 지정한 케이스만)
+    double mCacheMissesPerOp = -1.0;    // 연산 1회당 캐시 미스 (--perf, 측정하지 못하면 음수)
+};
+
+// 컴파일러가 측정 대상 연산을 제거하지 못하도록 값을 사용한 것으로 표시
+template<typename T>
+inline void DoNotOptimize(const T& value)
+{
+#ifdef _MSC_VER
+    static volatile const void* sink;
+    sink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+// 마이크로벤치마크 등록/실행기
+class MicroBenchRunner
+{
+public:
+    // public 멤버변수 (없음)
+
+private:
+    // private 멤버변수
+    struct Case
+    {
+        std::string mName;
+        std::vector<size_t> mSizes;
+        std::vector<uint32_t> mThreads;
+        bool mCountBytes;
+        MicroBenchFactory mFactory;
+        MicroBenchRatio mRatio;
+    };
+
+    std::vector<Case> mCases;
+    std::vector<MicroBenchResult> mResults;
+
+public:
+    // public 함수
+    // 케이스 등록 (sizes x threads 조합마다 측정, countBytes면 크기 x 연산 수를 처리량으로 보고)
+    // ratio를 지정하면 조합마다 출력/입력 크기 비율도 함께 보고
+    void Add(const std::string& name, const std::vector<size_t>& sizes, const std::vector<uint32_t>& threads,
+             bool countBytes, MicroBenchFactory factory, MicroBenchRatio ratio = nullptr);
+
+    // 등록된 케이스 실행 (진행 상황/표는 out에 출력)
+    void Run(const MicroBenchOptions& options, FILE* out);
+
+    // 결과 JSON 저장
+    bool WriteJson(const std::string& path) const;
+
+    const std::vector<MicroBenchResult>& GetResults() const { return mResults; }
+
+private:
+    // private 함수
+    // iterations번 실행한 벽시계 시간 (나노초)
+    // cacheMisses를 주면 스레드별 카운터 합계를 기록 (카운터를 열지 못한 스레드가 있으면 음수)
+    static double Measure(const MicroBenchBody& body, uint32_t threads, uint64_t iterations, double* cacheMisses = nullptr);
+
+    MicroBenchResult RunCase(const Case& benchCase, const MicroBenchParams& params, const MicroBenchOptions& options);
+};
+
+// 케이스 등록 함수 (각 Benchmarks 파일에서 구현)
+void RegisterBufferBenchmarks(MicroBenchRunner& runner);
+void RegisterSessionBenchmarks(MicroBenchRunner& runner);
+void RegisterDispatchBenchmarks(MicroBenchRunner& runner);
+void RegisterSerializeBenchmarks(MicroBenchRunner& runner);
+void RegisterCompressionBenchmarks(MicroBenchRunner& runner);
+void RegisterProtobufBenchmarks(MicroBenchRunner& runner);    // KANCHONET_HAS_PROTOBUF 빌드에서만 구현
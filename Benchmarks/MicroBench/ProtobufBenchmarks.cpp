@@ -0,0 +1,134 @@
+#include "MicroBench.h"
+#include <KanchoNet.h>
+
+// Protobuf 코덱 벤치마크는 KANCHONET_WITH_PROTOBUF=ON 빌드에서만 포함
+#ifdef KANCHONET_HAS_PROTOBUF
+
+#include "game_message.pb.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace KanchoNet;
+
+namespace
+{
+    const std::vector<uint32_t> PROTOBUF_THREADS = { 1 };
+    const std::vector<size_t> GAME_MESSAGE_SIZES = { 16, 256, 1024 };    // GameMessage::data 길이
+    const size_t SESSION_BUFFER_SIZE = 64 * 1024;
+    const uint32_t ARENA_RESET_INTERVAL = 32;   // 수신 콜백 한 번에 처리하는 메시지 수 가정
+
+    GameProto::GameMessage MakeGameMessage(size_t dataSize)
+    {
+        GameProto::GameMessage message;
+        message.set_message_type(7);
+        message.set_user_id(1234567890123LL);
+        message.set_data(std::string(dataSize, 'x'));
+        return message;
+    }
+
+    GameProto::MoveBroadcast MakeMoveBroadcast()
+    {
+        GameProto::MoveBroadcast message;
+        message.set_player_id(1234567890123LL);
+        message.mutable_current_position()->set_x(10.5f);
+        message.mutable_current_position()->set_y(0.0f);
+        message.mutable_current_position()->set_z(-3.25f);
+        message.mutable_target_position()->set_x(12.0f);
+        message.mutable_target_position()->set_y(0.0f);
+        message.mutable_target_position()->set_z(-1.5f);
+        return message;
+    }
+
+    // 메시지 종류별 케이스 등록 (makeMessage: 파라미터 크기로 보낼 메시지 생성)
+    template<typename TMessage, typename TMaker>
+    void RegisterMessageBenchmarks(MicroBenchRunner& runner, const std::string& name,
+                                   const std::vector<size_t>& sizes, TMaker makeMessage)
+    {
+        const bool countBytes = !sizes.empty();
+
+        // 기준 디코딩: 메시지마다 힙에 만들고 ParseFromArray (재조립 없이 연속 메모리에서 바로 파싱하는 최선의 경우)
+        runner.Add("Protobuf/" + name + "/Decode/Heap", sizes, PROTOBUF_THREADS, countBytes,
+            [makeMessage](const MicroBenchParams& params) -> MicroBenchBody {
+                auto body = std::make_shared<std::string>(makeMessage(params.mSize).SerializeAsString());
+
+                return [body](uint32_t, uint64_t iterations) {
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        std::unique_ptr<TMessage> message(new TMessage());
+                        DoNotOptimize(message->ParseFromArray(body->data(), static_cast<int>(body->size())));
+                        DoNotOptimize(message.get());
+                    }
+                };
+            });
+
+        // 코덱 디코딩: 수신 데이터를 세션 수신 버퍼에 쌓고 프레임 단위로 아레나 메시지에 디코딩
+        runner.Add("Protobuf/" + name + "/Decode/RingArena", sizes, PROTOBUF_THREADS, countBytes,
+            [makeMessage](const MicroBenchParams& params) -> MicroBenchBody {
+                auto frame = std::make_shared<PacketBuffer>();
+                ProtobufCodec::Encode(makeMessage(params.mSize), *frame);
+
+                return [frame](uint32_t, uint64_t iterations) {
+                    RingBuffer recvBuffer(SESSION_BUFFER_SIZE);
+                    ProtobufArena arena;
+
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        recvBuffer.Write(frame->GetData(), frame->GetSize());
+
+                        TMessage* message = arena.template Create<TMessage>();
+                        DoNotOptimize(ProtobufCodec::Decode(recvBuffer, *message));
+                        DoNotOptimize(message);
+
+                        if ((i + 1) % ARENA_RESET_INTERVAL == 0)
+                        {
+                            arena.Reset();
+                        }
+                    }
+                };
+            });
+
+        // 기준 인코딩: PacketBuffer에 직렬화한 뒤 세션 송신 버퍼로 복사 (엔진 Send 경로)
+        runner.Add("Protobuf/" + name + "/Encode/PacketBuffer", sizes, PROTOBUF_THREADS, countBytes,
+            [makeMessage](const MicroBenchParams& params) -> MicroBenchBody {
+                auto message = std::make_shared<TMessage>(makeMessage(params.mSize));
+
+                return [message](uint32_t, uint64_t iterations) {
+                    RingBuffer sendBuffer(SESSION_BUFFER_SIZE);
+
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        PacketBuffer packet;
+                        ProtobufCodec::Encode(*message, packet);
+                        sendBuffer.Write(packet.GetData(), packet.GetSize());
+                        sendBuffer.Skip(packet.GetSize());
+                    }
+                };
+            });
+
+        // 코덱 인코딩: 세션 송신 버퍼에 바로 직렬화 (NetworkEngine::SendInPlace 경로)
+        runner.Add("Protobuf/" + name + "/Encode/InPlace", sizes, PROTOBUF_THREADS, countBytes,
+            [makeMessage](const MicroBenchParams& params) -> MicroBenchBody {
+                auto message = std::make_shared<TMessage>(makeMessage(params.mSize));
+
+                return [message](uint32_t, uint64_t iterations) {
+                    RingBuffer sendBuffer(SESSION_BUFFER_SIZE);
+
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        const size_t written = ProtobufCodec::Encode(sendBuffer, *message);
+                        sendBuffer.Skip(written);
+                    }
+                };
+            });
+    }
+}
+
+void RegisterProtobufBenchmarks(MicroBenchRunner& runner)
+{
+    RegisterMessageBenchmarks<GameProto::GameMessage>(runner, "GameMessage", GAME_MESSAGE_SIZES, MakeGameMessage);
+    RegisterMessageBenchmarks<GameProto::MoveBroadcast>(runner, "MoveBroadcast", {},
+        [](size_t) { return MakeMoveBroadcast(); });
+}
+
+#endif // KANCHONET_HAS_PROTOBUF
@@ -0,0 +1,109 @@
+#include "MicroBench.h"
+#include <KanchoNet.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace KanchoNet;
+
+namespace
+{
+    const std::vector<uint32_t> SERIALIZE_THREADS = { 1 };
+    const std::vector<size_t> MESSAGE_SIZES = { 16, 64, 200 };   // 채팅 메시지 길이
+    const size_t SEND_BUFFER_SIZE = 64 * 1024;
+    const char USERNAME[] = "kancho_player";
+
+    struct BenchHeader
+    {
+        uint16_t size;
+        uint16_t type;
+    };
+
+    // 기존 방식: 내용과 관계없이 고정 크기 구조체 (ChatProtocol의 이전 MessageBroadcastPacket과 같은 배치)
+    struct FixedBroadcastPacket
+    {
+        BenchHeader header;
+        char username[32];
+        char message[256];
+    };
+}
+
+void RegisterSerializeBenchmarks(MicroBenchRunner& runner)
+{
+    // 기준: 고정 구조체를 채워 송신 버퍼로 복사 (패킷당 292바이트)
+    runner.Add("Serialize/FixedStruct", MESSAGE_SIZES, SERIALIZE_THREADS, false,
+        [](const MicroBenchParams& params) -> MicroBenchBody {
+            auto message = std::make_shared<std::string>(params.mSize, 'm');
+
+            return [message](uint32_t, uint64_t iterations) {
+                RingBuffer sendBuffer(SEND_BUFFER_SIZE);
+
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    FixedBroadcastPacket packet = {};
+                    packet.header.size = sizeof(packet);
+                    packet.header.type = 4;
+                    memcpy(packet.username, USERNAME, sizeof(USERNAME));
+                    memcpy(packet.message, message->data(), message->size());
+
+                    sendBuffer.Write(&packet, sizeof(packet));
+                    sendBuffer.Skip(sizeof(packet));
+                }
+            };
+        });
+
+    // PacketWriter: 송신 버퍼의 연속 공간에 실제 길이만큼 바로 직렬화
+    runner.Add("Serialize/Writer/InPlace", MESSAGE_SIZES, SERIALIZE_THREADS, false,
+        [](const MicroBenchParams& params) -> MicroBenchBody {
+            auto message = std::make_shared<std::string>(params.mSize, 'm');
+
+            return [message](uint32_t, uint64_t iterations) {
+                RingBuffer sendBuffer(SEND_BUFFER_SIZE);
+
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    PacketWriter writer(sendBuffer.GetWritePtr(), sendBuffer.GetContiguousWriteSize());
+                    const size_t header = writer.Reserve(sizeof(BenchHeader));
+                    writer.WriteString(std::string_view(USERNAME, sizeof(USERNAME) - 1));
+                    writer.WriteString(*message);
+                    writer.Patch(header, static_cast<uint16_t>(writer.GetSize()));
+                    writer.Patch(header + 2, static_cast<uint16_t>(4));
+
+                    if (!writer.IsValid())
+                    {
+                        // 연속 공간이 모자라면 버퍼를 비우고 다시 (측정 중 드물게 발생)
+                        sendBuffer.Clear();
+                        continue;
+                    }
+
+                    sendBuffer.CommitWrite(writer.GetSize());
+                    sendBuffer.Skip(writer.GetSize());
+                }
+            };
+        });
+
+    // 수신 측: 가변 길이 패킷을 복사 없이 읽기
+    runner.Add("Serialize/Reader", MESSAGE_SIZES, SERIALIZE_THREADS, false,
+        [](const MicroBenchParams& params) -> MicroBenchBody {
+            auto packet = std::make_shared<PacketBuffer>();
+            PacketWriter writer(*packet);
+            writer.Reserve(sizeof(BenchHeader));
+            writer.WriteString(std::string_view(USERNAME, sizeof(USERNAME) - 1));
+            writer.WriteString(std::string(params.mSize, 'm'));
+
+            return [packet](uint32_t, uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    PacketReader reader(*packet);
+                    std::string_view username;
+                    std::string_view message;
+                    reader.Skip(sizeof(BenchHeader));
+                    reader.ReadString(username, 32);
+                    reader.ReadString(message, 256);
+                    DoNotOptimize(message.size());
+                    DoNotOptimize(reader.IsValid());
+                }
+            };
+        });
+}
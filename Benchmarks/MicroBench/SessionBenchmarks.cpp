@@ -0,0 +1,205 @@
+#include "MicroBench.h"
+#include <KanchoNet.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace KanchoNet;
+
+namespace
+{
+    const std::vector<uint32_t> SESSION_THREADS = { 1, 4 };
+    const uint32_t RESIDENT_SESSIONS = 10000;   // 조회 측정 시 미리 등록해 두는 세션 수
+
+    const uint32_t EVENT_SESSIONS = 32768;      // 이벤트 측정 세션 수 (핫 필드만으로 L2를 넘는 규모)
+
+    // 세션 관리 비용만 측정하도록 수신/송신 링 버퍼를 작게 설정
+    SessionConfig MakeBenchSessionConfig()
+    {
+        SessionConfig config;
+        config.mMaxPacketSize = 4096;
+        return config;
+    }
+
+    // 슬랩 도입 전의 세션 필드 배치 (비교 기준)
+    // 세션마다 힙에 따로 할당되고, 리액터가 이벤트마다 읽는 필드가 링 버퍼/설정을 사이에 두고 흩어져 있음
+    struct LegacySession
+    {
+        SessionID mID;
+        SocketHandle mSocket;
+        std::atomic<SessionState> mState;
+        RingBuffer mSendBuffer;
+        RingBuffer mRecvBuffer;
+        SendChain mSendChain;
+        void* mUserData;
+        std::atomic<bool> mIsSending;
+        SessionConfig mConfig;
+        SpinLock mLock;
+
+        LegacySession(SessionID id, SocketHandle socket, const SessionConfig& config)
+            : mID(id)
+            , mSocket(socket)
+            , mState(SessionState::Connected)
+            , mSendBuffer(config.mMaxPacketSize * 2)
+            , mRecvBuffer(config.mMaxPacketSize * 2)
+            , mSendChain(config.mMaxSendQueueSize)
+            , mUserData(nullptr)
+            , mIsSending(false)
+            , mConfig(config)
+        {
+        }
+    };
+
+    // 이벤트 순서 (epoll이 돌려주는 준비된 세션처럼 세션 배치와 무관한 순서)
+    std::shared_ptr<std::vector<uint32_t>> MakeEventOrder(uint32_t count)
+    {
+        auto order = std::make_shared<std::vector<uint32_t>>(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            (*order)[i] = i;
+        }
+        std::shuffle(order->begin(), order->end(), std::mt19937(17));
+        return order;
+    }
+}
+
+void RegisterSessionBenchmarks(MicroBenchRunner& runner)
+{
+    // 접속/종료 churn: 추가 직후 제거 (풀 슬롯 재사용 + 맵 삽입/삭제)
+    runner.Add("SessionManager/AddRemove", {}, SESSION_THREADS, false,
+        [](const MicroBenchParams& params) -> MicroBenchBody {
+            auto manager = std::make_shared<SessionManager>(RESIDENT_SESSIONS + params.mThreads);
+            const SessionConfig config = MakeBenchSessionConfig();
+
+            return [manager, config](uint32_t, uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    Session* session = manager->AddSession(INVALID_SOCKET_HANDLE, config);
+                    DoNotOptimize(session);
+                    if (session)
+                    {
+                        manager->RemoveSession(session->GetID());
+                    }
+                }
+            };
+        });
+
+    // 세션 수가 많은 상태에서의 ID 조회 (패킷 송신 경로의 GetSession)
+    runner.Add("SessionManager/Get", {}, SESSION_THREADS, false,
+        [](const MicroBenchParams&) -> MicroBenchBody {
+            auto manager = std::make_shared<SessionManager>(RESIDENT_SESSIONS);
+            auto ids = std::make_shared<std::vector<SessionID>>();
+            const SessionConfig config = MakeBenchSessionConfig();
+
+            for (uint32_t i = 0; i < RESIDENT_SESSIONS; ++i)
+            {
+                Session* session = manager->AddSession(INVALID_SOCKET_HANDLE, config);
+                if (session)
+                {
+                    ids->push_back(session->GetID());
+                }
+            }
+
+            return [manager, ids](uint32_t threadIndex, uint64_t iterations) {
+                // 스레드마다 다른 지점에서 시작해 큰 보폭으로 순회 (캐시 친화적 순차 접근 회피)
+                size_t cursor = (threadIndex * 7919) % ids->size();
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    Session* session = manager->GetSession((*ids)[cursor]);
+                    DoNotOptimize(session);
+                    cursor = (cursor + 4099) % ids->size();
+                }
+            };
+        });
+
+    // 연결 폭주 시 세션 생성/반환 비용 비교 (매니저의 맵/락 제외)
+    // Legacy: 세션마다 힙 할당 + 링 버퍼 할당, Slab: 슬랩 슬롯 재사용 (버퍼 유지)
+    runner.Add("Session/Accept/Legacy", {}, {}, false,
+        [](const MicroBenchParams&) -> MicroBenchBody {
+            const SessionConfig config = MakeBenchSessionConfig();
+
+            return [config](uint32_t, uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    auto session = std::make_unique<LegacySession>(i + 1, INVALID_SOCKET_HANDLE, config);
+                    DoNotOptimize(session.get());
+                }
+            };
+        });
+
+    runner.Add("Session/Accept/Slab", {}, {}, false,
+        [](const MicroBenchParams&) -> MicroBenchBody {
+            auto pool = std::make_shared<SessionPool>(1);
+            const SessionConfig config = MakeBenchSessionConfig();
+
+            return [pool, config](uint32_t, uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    Session* session = pool->Acquire(i + 1, INVALID_SOCKET_HANDLE, config);
+                    DoNotOptimize(session);
+                    pool->Release(session);
+                }
+            };
+        });
+
+    // 이벤트 1건마다 리액터가 읽는 세션 상태 (락, 상태, 송신 중 여부, 소켓, ID, 사용자 데이터)
+    // 세션 수가 캐시보다 클 때 필드 배치에 따라 이벤트당 읽는 캐시 라인 수가 달라짐 (--perf로 캐시 미스 확인)
+    runner.Add("Session/Event/Legacy", {}, {}, false,
+        [](const MicroBenchParams&) -> MicroBenchBody {
+            SessionConfig config;
+            config.mMaxPacketSize = 256;
+
+            auto sessions = std::make_shared<std::vector<std::unique_ptr<LegacySession>>>();
+            for (uint32_t i = 0; i < EVENT_SESSIONS; ++i)
+            {
+                sessions->push_back(std::make_unique<LegacySession>(i + 1, static_cast<SocketHandle>(i), config));
+            }
+            auto order = MakeEventOrder(EVENT_SESSIONS);
+
+            return [sessions, order](uint32_t, uint64_t iterations) {
+                uint64_t sink = 0;
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    LegacySession& session = *(*sessions)[(*order)[i % EVENT_SESSIONS]];
+                    SpinLockGuard lock(session.mLock);
+                    if (session.mState.load(std::memory_order_acquire) == SessionState::Connected &&
+                        !session.mIsSending.load(std::memory_order_acquire))
+                    {
+                        sink += static_cast<uint64_t>(session.mSocket) + session.mID + reinterpret_cast<uintptr_t>(session.mUserData);
+                    }
+                }
+                DoNotOptimize(sink);
+            };
+        });
+
+    runner.Add("Session/Event/Slab", {}, {}, false,
+        [](const MicroBenchParams&) -> MicroBenchBody {
+            SessionConfig config;
+            config.mMaxPacketSize = 256;
+
+            auto pool = std::make_shared<SessionPool>(EVENT_SESSIONS);
+            auto sessions = std::make_shared<std::vector<Session*>>();
+            for (uint32_t i = 0; i < EVENT_SESSIONS; ++i)
+            {
+                Session* session = pool->Acquire(i + 1, static_cast<SocketHandle>(i), config);
+                session->SetState(SessionState::Connected);
+                sessions->push_back(session);
+            }
+            auto order = MakeEventOrder(EVENT_SESSIONS);
+
+            return [pool, sessions, order](uint32_t, uint64_t iterations) {
+                uint64_t sink = 0;
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    Session* session = (*sessions)[(*order)[i % EVENT_SESSIONS]];
+                    SpinLockGuard lock(session->GetLock());
+                    if (session->IsConnected() && !session->IsSending())
+                    {
+                        sink += static_cast<uint64_t>(session->GetSocket()) + session->GetID() + reinterpret_cast<uintptr_t>(session->GetUserData());
+                    }
+                }
+                DoNotOptimize(sink);
+            };
+        });
+}
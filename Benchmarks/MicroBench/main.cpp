@@ -0,0 +1,91 @@
+#include "MicroBench.h"
+#include <KanchoNet.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+static void PrintUsage(const char* program)
+{
+    printf("Usage: %s [options]\n", program);
+    printf("  --filter <text>       Run only benchmarks whose name contains <text>\n");
+    printf("  --min-time <sec>      Minimum time per repetition (default 0.2)\n");
+    printf("  --repetitions <n>     Repetitions per case, median is reported (default 5)\n");
+    printf("  --json <path>         Write results as JSON\n");
+    printf("  --perf                Also report hardware cache misses per op (Linux perf_event)\n");
+    printf("  --help                Show this message\n");
+}
+
+static bool ParseOptions(int argc, char* argv[], MicroBenchOptions& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        const bool hasValue = (i + 1 < argc);
+
+        if (arg == "--filter" && hasValue)
+        {
+            options.mFilter = argv[++i];
+        }
+        else if (arg == "--min-time" && hasValue)
+        {
+            options.mMinTimeSec = atof(argv[++i]);
+        }
+        else if (arg == "--repetitions" && hasValue)
+        {
+            options.mRepetitions = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--json" && hasValue)
+        {
+            options.mJsonPath = argv[++i];
+        }
+        else if (arg == "--perf")
+        {
+            options.mPerfCounters = true;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return false;
+        }
+    }
+
+    if (options.mMinTimeSec <= 0.0 || options.mRepetitions == 0)
+    {
+        fprintf(stderr, "--min-time and --repetitions must be positive\n");
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    MicroBenchOptions options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        return 1;
+    }
+
+    KanchoNet::Logger::GetInstance().SetLogLevel(KanchoNet::LogLevel::Warning);
+
+    MicroBenchRunner runner;
+    RegisterBufferBenchmarks(runner);
+    RegisterSessionBenchmarks(runner);
+    RegisterDispatchBenchmarks(runner);
+    RegisterSerializeBenchmarks(runner);
+    RegisterCompressionBenchmarks(runner);
+#ifdef KANCHONET_HAS_PROTOBUF
+    RegisterProtobufBenchmarks(runner);
+#endif
+
+    runner.Run(options, stdout);
+
+    if (!options.mJsonPath.empty() && !runner.WriteJson(options.mJsonPath))
+    {
+        fprintf(stderr, "Failed to write %s\n", options.mJsonPath.c_str());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,315 @@
+#!/usr/bin/env python3
+"""KanchoNet 성능 회귀 하네스
+
+KanchoBench(프로세스 내 에코 서버 + 부하 생성기)로 모델 x 연결 수 x 메시지 크기 x 서버 I/O 스레드
+매트릭스를 루프백에서 실행하고, 결과를 JSON 베이스라인으로 저장/비교합니다.
+
+  # 빌드 후 기본 매트릭스 실행, 베이스라인 저장
+  ./Benchmarks/Regression/kancho_regression.py run --build --output baselines/main.json
+
+  # 변경 후 다시 실행하여 비교 (임계값을 넘는 악화가 있으면 종료 코드 1)
+  ./Benchmarks/Regression/kancho_regression.py run --output current.json
+  ./Benchmarks/Regression/kancho_regression.py compare baselines/main.json current.json --threshold 5
+"""
+
+import argparse
+import datetime
+import itertools
+import json
+import os
+import platform
+import socket
+import statistics
+import subprocess
+import sys
+import tempfile
+
+REPO_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+# 기본 매트릭스
+DEFAULT_MODELS = ["epoll", "io_uring"]
+DEFAULT_CONNECTIONS = [16, 256]
+DEFAULT_SIZES = [64, 1024]
+DEFAULT_SERVER_THREADS = [1, 4]
+
+# 비교 지표: (이름, 결과 키, 클수록 좋은지)
+METRICS = [
+    ("throughput", "throughput_msgs_per_sec", True),
+    ("p50_us", "p50_us", False),
+    ("p99_us", "p99_us", False),
+    ("p999_us", "p999_us", False),
+    ("cpu_us_per_msg", "cpu_us_per_msg", False),
+    ("server_cpu_us_per_msg", "server_cpu_us_per_msg", False),
+    ("rss_kb_per_conn", "rss_per_connection_kb", False),
+]
+
+# 지연 지표는 노이즈가 커서 별도 임계값 적용
+LATENCY_METRICS = {"p50_us", "p99_us", "p999_us"}
+
+
+def parse_list(text, cast=int):
+    return [cast(item) for item in text.split(",") if item]
+
+
+def uses_epoll_oneshot(model, server_threads):
+    # 기본 epoll 디스패치는 세션별 직렬화가 없으므로 여러 I/O 스레드는 다중 대기 모드로만 측정
+    return model == "epoll" and server_threads > 1
+
+
+def case_key(model, connections, size, server_threads):
+    key = "%s/c%d/s%d/w%d" % (model, connections, size, server_threads)
+    if uses_epoll_oneshot(model, server_threads):
+        key += "/oneshot"
+    return key
+
+
+def git_revision():
+    try:
+        return subprocess.check_output(["git", "-C", REPO_ROOT, "rev-parse", "--short", "HEAD"],
+                                       stderr=subprocess.DEVNULL, text=True).strip()
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+
+def build(build_dir, build_type):
+    print("[build] configuring %s (%s)" % (build_dir, build_type), file=sys.stderr)
+    subprocess.check_call(["cmake", "-S", REPO_ROOT, "-B", build_dir,
+                           "-DCMAKE_BUILD_TYPE=" + build_type, "-DKANCHONET_BUILD_BENCHMARKS=ON"])
+    subprocess.check_call(["cmake", "--build", build_dir, "--target", "KanchoBench",
+                           "-j", str(os.cpu_count() or 1)])
+
+
+def run_bench(bench, args, model, connections, size, server_threads, port):
+    with tempfile.NamedTemporaryFile(suffix=".json", delete=False) as handle:
+        output_path = handle.name
+
+    command = [bench,
+               "--server", model,
+               "--port", str(port),
+               "--server-threads", str(server_threads),
+               "--connections", str(connections),
+               "--threads", str(min(args.client_threads, connections)),
+               "--size", str(size),
+               "--pipeline", str(args.pipeline),
+               "--duration", str(args.duration),
+               "--warmup", str(args.warmup),
+               "--output", output_path]
+    if uses_epoll_oneshot(model, server_threads):
+        command.append("--epoll-oneshot")
+
+    try:
+        completed = subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+        if completed.returncode != 0:
+            return None, completed.stderr.strip()
+        with open(output_path) as handle:
+            return json.load(handle), None
+    finally:
+        os.unlink(output_path)
+
+
+def summarize(raw):
+    latency = raw["latency_us"]
+    process = raw["process"]
+    return {
+        "throughput_msgs_per_sec": raw["throughput_msgs_per_sec"],
+        "p50_us": latency["p50"],
+        "p99_us": latency["p99"],
+        "p999_us": latency["p999"],
+        "cpu_us_per_msg": process["cpu_us_per_msg"],
+        "server_cpu_us_per_msg": process["server_cpu_us_per_msg"],
+        "rss_per_connection_kb": process["rss_per_connection_kb"],
+        "errors": raw["errors"],
+    }
+
+
+def median_of(samples):
+    # 반복 실행의 지표별 중앙값
+    merged = {}
+    for key in samples[0]:
+        merged[key] = round(statistics.median(sample[key] for sample in samples), 4)
+    return merged
+
+
+def command_run(args):
+    build_dir = os.path.abspath(args.build_dir)
+    if args.build:
+        build(build_dir, args.build_type)
+
+    bench = os.path.join(build_dir, "bin", "KanchoBench")
+    if not os.path.exists(bench):
+        print("KanchoBench not found at %s (use --build)" % bench, file=sys.stderr)
+        return 2
+
+    matrix = list(itertools.product(parse_list(args.models, str), parse_list(args.connections),
+                                    parse_list(args.sizes), parse_list(args.server_threads)))
+
+    results = {}
+    skipped = {}
+    port = args.base_port
+    for index, (model, connections, size, server_threads) in enumerate(matrix):
+        key = case_key(model, connections, size, server_threads)
+        print("[%d/%d] %s" % (index + 1, len(matrix), key), file=sys.stderr)
+
+        samples = []
+        error = None
+        for _ in range(args.repeat):
+            # 이전 실행의 TIME_WAIT와 겹치지 않도록 실행마다 포트 변경
+            raw, error = run_bench(bench, args, model, connections, size, server_threads, port)
+            port += 1
+            if raw is None:
+                break
+            samples.append(summarize(raw))
+
+        if not samples:
+            print("  skipped: %s" % error, file=sys.stderr)
+            skipped[key] = error
+            continue
+
+        results[key] = median_of(samples)
+        results[key].update({"model": model, "connections": connections, "size": size,
+                             "server_threads": server_threads,
+                             "epoll_oneshot": uses_epoll_oneshot(model, server_threads)})
+        print("  %.0f msgs/s, p99 %.1f us, %.3f cpu us/msg" % (
+            results[key]["throughput_msgs_per_sec"], results[key]["p99_us"], results[key]["cpu_us_per_msg"]),
+            file=sys.stderr)
+
+    document = {
+        "tool": "kancho_regression",
+        "created": datetime.datetime.now().isoformat(timespec="seconds"),
+        "revision": git_revision(),
+        "host": {
+            "hostname": socket.gethostname(),
+            "kernel": platform.release(),
+            "cpus": os.cpu_count(),
+        },
+        "config": {
+            "duration_sec": args.duration,
+            "warmup_sec": args.warmup,
+            "repeat": args.repeat,
+            "client_threads": args.client_threads,
+            "pipeline": args.pipeline,
+            "epoll_oneshot_multithread": True,
+        },
+        "results": results,
+        "skipped": skipped,
+    }
+
+    output_dir = os.path.dirname(os.path.abspath(args.output))
+    os.makedirs(output_dir, exist_ok=True)
+    with open(args.output, "w") as handle:
+        json.dump(document, handle, indent=2, sort_keys=True)
+        handle.write("\n")
+
+    print("Wrote %d results to %s" % (len(results), args.output), file=sys.stderr)
+    return 0
+
+
+def command_compare(args):
+    with open(args.baseline) as handle:
+        baseline = json.load(handle)
+    with open(args.current) as handle:
+        current = json.load(handle)
+
+    if baseline.get("host", {}).get("hostname") != current.get("host", {}).get("hostname"):
+        print("warning: baseline and current results come from different hosts", file=sys.stderr)
+
+    for name, document in (("baseline", baseline), ("current", current)):
+        if not document.get("config", {}).get("epoll_oneshot_multithread"):
+            print("warning: %s ran multi-threaded epoll without --epoll-oneshot (unsupported dispatch), "
+                  "those cases are not comparable and show up as missing" % name, file=sys.stderr)
+
+    lines = []
+    lines.append("# KanchoNet benchmark comparison")
+    lines.append("")
+    lines.append("baseline: %s (%s), current: %s (%s), threshold: %.1f%% (latency %.1f%%)" % (
+        baseline.get("revision"), baseline.get("created"), current.get("revision"), current.get("created"),
+        args.threshold, args.latency_threshold))
+    lines.append("")
+    lines.append("| case | metric | baseline | current | change | |")
+    lines.append("|---|---|---:|---:|---:|---|")
+
+    regressions = 0
+    improvements = 0
+    missing = []
+    for key in sorted(baseline["results"]):
+        if key not in current["results"]:
+            missing.append(key)
+            continue
+
+        before = baseline["results"][key]
+        after = current["results"][key]
+        for name, field, higher_is_better in METRICS:
+            if field not in before or field not in after or before[field] == 0:
+                continue
+
+            change = (after[field] - before[field]) / before[field] * 100.0
+            worse = -change if higher_is_better else change
+            threshold = args.latency_threshold if name in LATENCY_METRICS else args.threshold
+
+            mark = ""
+            if worse > threshold:
+                mark = "REGRESSION"
+                regressions += 1
+            elif -worse > threshold:
+                mark = "improved"
+                improvements += 1
+
+            if mark or args.verbose:
+                lines.append("| %s | %s | %.3f | %.3f | %+.1f%% | %s |" % (
+                    key, name, before[field], after[field], change, mark))
+
+        if after.get("errors", 0) > before.get("errors", 0):
+            lines.append("| %s | errors | %d | %d | | REGRESSION |" % (key, before.get("errors", 0), after["errors"]))
+            regressions += 1
+
+    lines.append("")
+    lines.append("%d regression(s), %d improvement(s)" % (regressions, improvements))
+    if missing:
+        lines.append("missing in current: %s" % ", ".join(missing))
+
+    report = "\n".join(lines) + "\n"
+    sys.stdout.write(report)
+    if args.report:
+        with open(args.report, "w") as handle:
+            handle.write(report)
+
+    return 1 if regressions > 0 else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="KanchoNet benchmark regression harness")
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    run = subparsers.add_parser("run", help="run the benchmark matrix and write a JSON result file")
+    run.add_argument("--build", action="store_true", help="configure and build KanchoBench first")
+    run.add_argument("--build-dir", default=os.path.join(REPO_ROOT, "build"))
+    run.add_argument("--build-type", default="Release")
+    run.add_argument("--models", default=",".join(DEFAULT_MODELS))
+    run.add_argument("--connections", default=",".join(map(str, DEFAULT_CONNECTIONS)))
+    run.add_argument("--sizes", default=",".join(map(str, DEFAULT_SIZES)))
+    run.add_argument("--server-threads", default=",".join(map(str, DEFAULT_SERVER_THREADS)))
+    run.add_argument("--client-threads", type=int, default=4)
+    run.add_argument("--pipeline", type=int, default=1)
+    run.add_argument("--duration", type=float, default=5.0)
+    run.add_argument("--warmup", type=float, default=1.0)
+    run.add_argument("--repeat", type=int, default=3, help="runs per case, the median is stored")
+    run.add_argument("--base-port", type=int, default=19500)
+    run.add_argument("--output", required=True)
+
+    compare = subparsers.add_parser("compare", help="compare two result files")
+    compare.add_argument("baseline")
+    compare.add_argument("current")
+    compare.add_argument("--threshold", type=float, default=5.0, help="allowed change in percent")
+    compare.add_argument("--latency-threshold", type=float, default=15.0,
+                         help="allowed change in percent for latency percentiles")
+    compare.add_argument("--report", help="also write the report (markdown) to this file")
+    compare.add_argument("--verbose", action="store_true", help="list unchanged metrics too")
+
+    args = parser.parse_args()
+    if args.command == "run":
+        return command_run(args)
+    return command_compare(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -46,13 +46,9 @@ namespace ChatProtocol
         char message[256];
     };
 
-    // 메시지 브로드캐스트
-    struct MessageBroadcastPacket
-    {
-        PacketHeader header;
-        char username[32];
-        char message[256];
-    };
+    // 메시지 브로드캐스트 (가변 길이, KanchoNet::PacketWriter/PacketReader 형식)
+    // [PacketHeader][username: varint 길이 + 바이트][message: varint 길이 + 바이트]
+    // 실제 문자열 길이만큼만 전송 (고정 구조체였을 때는 내용과 관계없이 292바이트)
 
     // 로그아웃
     struct LogoutPacket
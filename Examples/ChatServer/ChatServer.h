@@ -3,7 +3,12 @@
 #include <KanchoNet.h>
 #include "ChatProtocol.h"
 #include <iostream>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <mutex>
 
@@ -53,35 +58,59 @@ protected:
         session->SetUserData(new ChatUser{ "", session });
     }
 
-    // 패킷 수신
+    // 패킷 수신 (세션 수신 버퍼에 모아 두고 완성된 패킷만 순서대로 처리, 잘린 뒷부분은 다음 수신까지 보관)
     void OnReceive(KanchoNet::Session* session, const uint8_t* data, size_t size) override
     {
-        if (size < sizeof(ChatProtocol::PacketHeader))
+        KanchoNet::RingBuffer& recvBuffer = session->GetRecvBuffer();
+        if (recvBuffer.Write(data, size) < size)
         {
+            std::cout << "[Warning] Receive buffer overflow, SessionID: " << session->GetID() << std::endl;
+            recvBuffer.Clear();
             return;
         }
 
-        const ChatProtocol::PacketHeader* header = 
-            reinterpret_cast<const ChatProtocol::PacketHeader*>(data);
-
-        switch (header->type)
+        while (true)
         {
-        case ChatProtocol::PacketType::Login:
-            HandleLogin(session, data, size);
-            break;
-
-        case ChatProtocol::PacketType::Message:
-            HandleMessage(session, data, size);
-            break;
-
-        case ChatProtocol::PacketType::Logout:
-            HandleLogout(session);
-            break;
-
-        default:
-            std::cout << "[Warning] Unknown packet type: " 
-                     << static_cast<int>(header->type) << std::endl;
-            break;
+            const size_t available = recvBuffer.GetAvailableRead();
+            uint8_t header[sizeof(ChatProtocol::PacketHeader)];
+            if (available < sizeof(header))
+            {
+                break;
+            }
+
+            recvBuffer.Peek(header, sizeof(header));
+            const size_t packetSize = Dispatcher::GetPacketSize(header, sizeof(header));
+
+            // 헤더에 적힌 크기가 어떤 패킷과도 맞지 않으면 뒤따르는 바이트의 경계를 알 수 없으므로 버림
+            KanchoNet::DispatchResult result = KanchoNet::DispatchResult::InvalidSize;
+            if (packetSize >= sizeof(header) && packetSize <= MAX_PACKET_SIZE)
+            {
+                if (packetSize > available)
+                {
+                    break;
+                }
+
+                // 링 버퍼 끝에서 패킷이 둘로 나뉘었으면 임시 버퍼에 이어 붙여서 처리
+                uint8_t packet[MAX_PACKET_SIZE];
+                const uint8_t* packetData = recvBuffer.GetReadPtr();
+                if (recvBuffer.GetContiguousReadSize() < packetSize)
+                {
+                    recvBuffer.Peek(packet, packetSize);
+                    packetData = packet;
+                }
+
+                result = Dispatcher::Dispatch(*this, session, packetData, packetSize);
+            }
+
+            if (result != KanchoNet::DispatchResult::Handled)
+            {
+                std::cout << "[Warning] Invalid packet, SessionID: " << session->GetID()
+                          << ", Result: " << static_cast<int>(result) << std::endl;
+                recvBuffer.Clear();
+                break;
+            }
+
+            recvBuffer.Skip(packetSize);
         }
     }
 
@@ -116,18 +145,16 @@ protected:
     }
 
 private:
-    void HandleLogin(KanchoNet::Session* session, const uint8_t* data, size_t size)
+    // 패킷 핸들러 (Dispatcher가 크기를 확인한 뒤 호출)
+    void HandleLogin(KanchoNet::Session* session, const ChatProtocol::LoginPacket& packet)
     {
-        const ChatProtocol::LoginPacket* packet = 
-            reinterpret_cast<const ChatProtocol::LoginPacket*>(data);
-
         ChatUser* user = session->GetUserData<ChatUser>();
         if (!user)
         {
             return;
         }
 
-        user->username = packet->username;
+        user->username.assign(packet.username, strnlen(packet.username, sizeof(packet.username)));
 
         // 사용자 목록에 추가
         {
@@ -143,36 +170,37 @@ private:
         response.header.size = sizeof(response);
         response.header.type = ChatProtocol::PacketType::LoginResponse;
         response.success = true;
-        strcpy_s(response.message, "Welcome to KanchoNet Chat Server!");
+        snprintf(response.message, sizeof(response.message), "%s", "Welcome to KanchoNet Chat Server!");
 
         Send(session, &response, sizeof(response));
     }
 
-    void HandleMessage(KanchoNet::Session* session, const uint8_t* data, size_t size)
+    void HandleMessage(KanchoNet::Session* session, const ChatProtocol::MessagePacket& packet)
     {
-        const ChatProtocol::MessagePacket* packet = 
-            reinterpret_cast<const ChatProtocol::MessagePacket*>(data);
-
         ChatUser* user = session->GetUserData<ChatUser>();
         if (!user || user->username.empty())
         {
             return;
         }
 
+        const std::string_view message(packet.message, strnlen(packet.message, sizeof(packet.message)));
+
         std::cout << "[Message] From: " << user->username 
-                  << ", Message: " << packet->message << std::endl;
+                  << ", Message: " << message << std::endl;
 
-        // 모든 사용자에게 브로드캐스트
-        ChatProtocol::MessageBroadcastPacket broadcast = {};
-        broadcast.header.size = sizeof(broadcast);
-        broadcast.header.type = ChatProtocol::PacketType::MessageBroadcast;
-        strcpy_s(broadcast.username, user->username.c_str());
-        strcpy_s(broadcast.message, packet->message);
+        // 모든 사용자에게 브로드캐스트 (헤더 자리를 잡아두고 문자열을 쓴 뒤 크기를 채움, 길이 접두사는 각 2바이트 이하)
+        auto broadcast = std::make_shared<KanchoNet::PacketBuffer>(sizeof(ChatProtocol::PacketHeader) + user->username.size() + message.size() + 4);
+        KanchoNet::PacketWriter writer(*broadcast);
+        const size_t header = writer.Reserve(sizeof(ChatProtocol::PacketHeader));
+        writer.WriteString(user->username);
+        writer.WriteString(message);
+        writer.Patch(header + offsetof(ChatProtocol::PacketHeader, size), static_cast<uint16_t>(writer.GetSize()));
+        writer.Patch(header + offsetof(ChatProtocol::PacketHeader, type), ChatProtocol::PacketType::MessageBroadcast);
 
         BroadcastMessage(broadcast);
     }
 
-    void HandleLogout(KanchoNet::Session* session)
+    void HandleLogout(KanchoNet::Session* session, const ChatProtocol::LogoutPacket&)
     {
         ChatUser* user = session->GetUserData<ChatUser>();
         if (user && !user->username.empty())
@@ -184,15 +212,25 @@ private:
         }
     }
 
+    // 클라이언트가 보내는 가장 큰 패킷 (수신 버퍼에서 잘린 패킷을 이어 붙일 임시 버퍼 크기)
+    static constexpr size_t MAX_PACKET_SIZE = sizeof(ChatProtocol::MessagePacket);
+
+    // 패킷 ID -> 핸들러 표
+    using Dispatcher = KanchoNet::PacketDispatcher<ChatProtocol::PacketHeader,
+        KanchoNet::PacketHandler<ChatProtocol::PacketType::Login, ChatProtocol::LoginPacket, &ChatServer::HandleLogin>,
+        KanchoNet::PacketHandler<ChatProtocol::PacketType::Message, ChatProtocol::MessagePacket, &ChatServer::HandleMessage>,
+        KanchoNet::PacketHandler<ChatProtocol::PacketType::Logout, ChatProtocol::LogoutPacket, &ChatServer::HandleLogout>>;
+
 private:
     // private 함수
-    void BroadcastMessage(const ChatProtocol::MessageBroadcastPacket& packet)
+    // 한 번 직렬화한 패킷을 모든 사용자와 공유 (세그먼트 체인 모드면 복사 없이 참조만 추가)
+    void BroadcastMessage(const KanchoNet::SharedPacketBuffer& packet)
     {
         std::lock_guard<std::mutex> lock(mUsersMutex);
         
         for (auto& pair : mUsers)
         {
-            Send(pair.second->session, &packet, sizeof(packet));
+            SendShared(pair.second->session, packet);
         }
     }
 };
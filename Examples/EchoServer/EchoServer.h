@@ -41,6 +41,13 @@ protected:
         std::cout << "[Disconnect] SessionID: " << session->GetID() << std::endl;
     }
 
+    // 정상 종료 (Drain) - 연결을 닫기 전에 작별 메시지 전송
+    void OnDrain(KanchoNet::Session* session) override
+    {
+        static const char GOODBYE[] = "server restarting\n";
+        Send(session, GOODBYE, sizeof(GOODBYE) - 1);
+    }
+
     // 에러 발생
     void OnError(KanchoNet::Session* session, KanchoNet::ErrorCode errorCode) override
     {
@@ -3,8 +3,13 @@
 #include <thread>
 #include <vector>
 #include <atomic>
+#include <chrono>
+#include <string>
 
-int main()
+// 사용법: EchoServer [--handoff <유닉스 소켓 경로>]
+// --handoff를 주면 같은 경로로 실행 중인 서버에서 리슨 소켓을 넘겨받아 시작하고,
+// 이후 같은 옵션으로 새 서버를 띄우면 리슨 소켓을 넘긴 뒤 기존 연결을 정리하고 종료 (무중단 재시작, Linux)
+int main(int argc, char* argv[])
 {
     std::cout << "==================================" << std::endl;
     #ifdef KANCHONET_PLATFORM_WINDOWS
@@ -29,6 +34,25 @@ int main()
     config.mBacklog = 200;
     config.mNoDelay = true;
     config.mKeepAlive = true;
+    config.mEpollOneShot = true;    // 아래에서 4개 스레드가 ProcessIO를 호출하므로 epoll 다중 대기 모드 사용
+
+    std::string handoffPath;
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (std::string(argv[i]) == "--handoff")
+        {
+            handoffPath = argv[++i];
+        }
+    }
+
+    #ifdef KANCHONET_PLATFORM_LINUX
+        // 실행 중인 서버가 있으면 리슨 소켓을 넘겨받음 (없으면 새로 bind)
+        KanchoNet::ListenerHandoff takeover;
+        if (!handoffPath.empty())
+        {
+            config.mInheritedListenSocket = takeover.Connect(handoffPath, 5000);
+        }
+    #endif
 
     // 초기화
     if (!server.Initialize(config))
@@ -44,8 +68,16 @@ int main()
         return 1;
     }
 
+    #ifdef KANCHONET_PLATFORM_LINUX
+        // 수락을 시작했으므로 이전 서버가 정리를 시작해도 됨
+        if (config.mInheritedListenSocket != KanchoNet::INVALID_SOCKET_HANDLE)
+        {
+            takeover.NotifyReady();
+        }
+    #endif
+
     std::cout << "Echo Server started on port " << config.mPort << std::endl;
-    std::cout << "Press 'q' + Enter to quit" << std::endl;
+    std::cout << "Press 'q' + Enter to quit, 'd' + Enter to drain and quit" << std::endl;
     std::cout << std::endl;
 
     // 워커 스레드 생성 (4개)
@@ -56,6 +88,9 @@ int main()
     {
         workers.emplace_back([&server, &running, i]() {
             std::cout << "[Worker " << i << "] Started" << std::endl;
+
+            // EngineConfig에 CPU/NUMA 배치를 지정한 경우 이 스레드를 고정
+            server.BindIOThread(static_cast<uint32_t>(i));
             
             while (running.load())
             {
@@ -67,19 +102,77 @@ int main()
         });
     }
 
-    // 사용자 입력 대기
-    std::string input;
-    while (std::getline(std::cin, input))
-    {
-        if (input == "q" || input == "Q")
+    // 종료 요청 (사용자 입력 또는 리슨 소켓 인계)
+    std::atomic<bool> quit(false);
+    std::atomic<bool> drain(false);
+
+    // 사용자 입력 대기 (입력 대기 중에도 인계로 종료할 수 있도록 별도 스레드, 종료 시 그대로 둠)
+    std::thread([&quit, &drain]() {
+        std::string input;
+        while (std::getline(std::cin, input))
+        {
+            if (input == "d" || input == "D")
+            {
+                drain.store(true);
+                break;
+            }
+            if (input == "q" || input == "Q")
+            {
+                break;
+            }
+        }
+        quit.store(true);
+    }).detach();
+
+    #ifdef KANCHONET_PLATFORM_LINUX
+        // 새 서버가 리슨 소켓을 가져가면 기존 연결을 정리하고 종료
+        std::thread handoffThread;
+        if (!handoffPath.empty())
         {
-            break;
+            handoffThread = std::thread([&server, &quit, &drain, handoffPath]() {
+                KanchoNet::ListenerHandoff handoff;
+                while (!quit.load())
+                {
+                    if (!handoff.IsListening() && !handoff.Listen(handoffPath))
+                    {
+                        return;
+                    }
+
+                    if (handoff.Serve(server.GetListenSocket(), 500))
+                    {
+                        drain.store(true);
+                        quit.store(true);
+                    }
+                }
+            });
         }
+    #endif
+
+    while (!quit.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
 
+    #ifdef KANCHONET_PLATFORM_LINUX
+        if (handoffThread.joinable())
+        {
+            handoffThread.join();
+        }
+    #endif
+
     // 종료
     std::cout << std::endl;
     std::cout << "Shutting down server..." << std::endl;
+
+    // 정상 종료: 워커가 I/O를 계속 처리하는 동안 작별 메시지를 보내고 클라이언트가 끊기를 기다림
+    // (Drain은 Stop을 호출하지 않으므로 아래에서 워커를 합류시킨 뒤 Stop)
+    if (drain.load())
+    {
+        if (!server.Drain(5000))
+        {
+            std::cout << "Drain timed out. Remaining sessions were closed." << std::endl;
+        }
+    }
     
     running.store(false);
     
@@ -3,12 +3,15 @@
 #include <KanchoNet.h>
 #include <iostream>
 
+#ifdef KANCHONET_HAS_PROTOBUF
+#include "game_message.pb.h"    // CMake가 Proto/game_message.proto에서 생성
+#endif
+
 // Protobuf 예제 서버
-// 실제로 Protobuf를 사용하려면:
-// 1. Protobuf 라이브러리 설치
-// 2. .proto 파일 정의
-// 3. protoc 컴파일러로 .pb.h/.pb.cc 생성
-// 4. ParseFromArray() / SerializeToArray() 사용
+// KANCHONET_WITH_PROTOBUF=ON으로 빌드하면 길이 접두사 프레임의 GameMessage를 받아 GameResponse로 응답
+// - 수신 데이터를 세션 수신 버퍼에 쌓고 ProtobufCodec::Decode로 프레임 단위 디코딩 (메시지는 스레드별 아레나에 생성)
+// - ProtobufCodec::Send로 세션 송신 버퍼에 바로 직렬화
+// Protobuf 없이 빌드하면 받은 데이터를 그대로 Echo
 
 // 크로스 플랫폼 네트워크 모델 선택
 #ifdef KANCHONET_PLATFORM_WINDOWS
@@ -33,31 +36,41 @@ protected:
     // 패킷 수신
     void OnReceive(KanchoNet::Session* session, const uint8_t* data, size_t size) override
     {
-        std::cout << "[Receive] SessionID: " << session->GetID() 
-                  << ", Size: " << size << " bytes" << std::endl;
-
-        // Protobuf 사용 예제 (실제 구현은 Proto 파일 필요)
-        // 
-        // GameMessage message;
-        // if (message.ParseFromArray(data, size))
-        // {
-        //     // 메시지 처리
-        //     ProcessGameMessage(session, message);
-        //     
-        //     // 응답 전송
-        //     GameResponse response;
-        //     response.set_result(true);
-        //     response.set_message("OK");
-        //     
-        //     KanchoNet::PacketBuffer buffer;
-        //     buffer.Resize(response.ByteSizeLong());
-        //     response.SerializeToArray(buffer.GetData(), buffer.GetSize());
-        //     
-        //     Send(session, buffer);
-        // }
-
-        // 현재는 단순히 Echo
+#ifdef KANCHONET_HAS_PROTOBUF
+        KanchoNet::RingBuffer& recvBuffer = session->GetRecvBuffer();
+        if (recvBuffer.Write(data, size) < size)
+        {
+            std::cout << "[Warning] Receive buffer overflow, SessionID: " << session->GetID() << std::endl;
+            recvBuffer.Clear();
+            return;
+        }
+
+        // 디코딩한 메시지는 이 콜백이 끝나면 아레나와 함께 한꺼번에 해제
+        KanchoNet::ProtobufArena& arena = KanchoNet::ProtobufArena::GetThreadArena();
+        while (true)
+        {
+            GameProto::GameMessage* message = arena.Create<GameProto::GameMessage>();
+            const KanchoNet::DecodeResult result = KanchoNet::ProtobufCodec::Decode(recvBuffer, *message);
+            if (result == KanchoNet::DecodeResult::Incomplete)
+            {
+                break;
+            }
+
+            if (result != KanchoNet::DecodeResult::Decoded)
+            {
+                std::cout << "[Warning] Invalid message, SessionID: " << session->GetID()
+                          << ", Result: " << static_cast<int>(result) << std::endl;
+                recvBuffer.Clear();
+                break;
+            }
+
+            ProcessGameMessage(session, *message);
+        }
+        arena.Reset();
+#else
+        // Protobuf 없이 빌드하면 단순히 Echo
         Send(session, data, size);
+#endif
     }
 
     // 연결 종료
@@ -72,5 +85,24 @@ protected:
         std::cout << "[Error] SessionID: " << (session ? session->GetID() : 0)
                   << ", ErrorCode: " << static_cast<int>(errorCode) << std::endl;
     }
+
+#ifdef KANCHONET_HAS_PROTOBUF
+private:
+    // private 함수
+    void ProcessGameMessage(KanchoNet::Session* session, const GameProto::GameMessage& message)
+    {
+        std::cout << "[Message] SessionID: " << session->GetID()
+                  << ", Type: " << message.message_type()
+                  << ", UserID: " << message.user_id() << std::endl;
+
+        // 응답도 같은 스레드 아레나에 생성 (송신 버퍼에 직렬화한 뒤에는 필요 없음)
+        GameProto::GameResponse* response =
+            KanchoNet::ProtobufArena::GetThreadArena().Create<GameProto::GameResponse>();
+        response->set_result(true);
+        response->set_message("OK");
+
+        KanchoNet::ProtobufCodec::Send(*this, session, *response);
+    }
+#endif
 };
 
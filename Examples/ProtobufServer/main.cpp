@@ -16,12 +16,12 @@ int main()
     std::cout << "==================================" << std::endl;
     std::cout << std::endl;
 
-    std::cout << "NOTE: This is a Protobuf integration example." << std::endl;
-    std::cout << "To use Protobuf, you need to:" << std::endl;
-    std::cout << "1. Install Google Protobuf library" << std::endl;
-    std::cout << "2. Define .proto files" << std::endl;
-    std::cout << "3. Compile with protoc" << std::endl;
-    std::cout << "4. Use ParseFromArray() and SerializeToArray()" << std::endl;
+#ifdef KANCHONET_HAS_PROTOBUF
+    std::cout << "Protocol: length-delimited GameProto::GameMessage -> GameResponse" << std::endl;
+#else
+    std::cout << "NOTE: Built without Protobuf, echoing received data." << std::endl;
+    std::cout << "Configure with -DKANCHONET_WITH_PROTOBUF=ON to enable the Protobuf codec." << std::endl;
+#endif
     std::cout << std::endl;
 
     // 로그 레벨 설정
@@ -2,14 +2,15 @@
 
 namespace KanchoNet
 {
-    BufferPool::BufferPool(size_t bufferSize, size_t initialCount)
+    BufferPool::BufferPool(size_t bufferSize, size_t initialCount, HugePageArena* arena)
         : mBufferSize(bufferSize)
         , mTotalAllocated(0)
+        , mArena(arena)
     {
         mPool.reserve(initialCount);
         for (size_t i = 0; i < initialCount; ++i)
         {
-            mPool.push_back(std::make_unique<PacketBuffer>(mBufferSize));
+            mPool.push_back(std::make_unique<PacketBuffer>(mBufferSize, mArena));
         }
     }
 
@@ -32,7 +33,7 @@ namespace KanchoNet
         
         // 풀이 비어있으면 새로 할당
         ++mTotalAllocated;
-        return std::make_unique<PacketBuffer>(mBufferSize);
+        return std::make_unique<PacketBuffer>(mBufferSize, mArena);
     }
 
     void BufferPool::Deallocate(std::unique_ptr<PacketBuffer> buffer)
@@ -10,6 +10,7 @@
 namespace KanchoNet
 {
     // 버퍼 풀 (객체 재사용을 통한 메모리 할당 최적화)
+    // 아레나를 지정하면 버퍼 저장소를 아레나에서 할당 (아레나는 풀보다 오래 살아 있어야 함)
     class BufferPool : public NonCopyable
     {
     public:
@@ -19,12 +20,13 @@ namespace KanchoNet
         // private 멤버변수
         size_t mBufferSize;
         size_t mTotalAllocated;
+        HugePageArena* mArena;
         std::vector<std::unique_ptr<PacketBuffer>> mPool;
         mutable std::mutex mMutex;
         
     public:
         // 생성자, 파괴자
-        explicit BufferPool(size_t bufferSize, size_t initialCount = 100);
+        explicit BufferPool(size_t bufferSize, size_t initialCount = 100, HugePageArena* arena = nullptr);
         ~BufferPool();
         
     public:
@@ -39,6 +41,7 @@ namespace KanchoNet
         size_t GetPoolSize() const;
         size_t GetBufferSize() const { return mBufferSize; }
         size_t GetTotalAllocated() const { return mTotalAllocated; }
+        HugePageArena* GetArena() const { return mArena; }
         
         // 풀 비우기
         void Clear();
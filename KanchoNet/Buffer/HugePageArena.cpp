@@ -0,0 +1,234 @@
+#include "HugePageArena.h"
+#include "../Utils/Logger.h"
+
+#ifdef KANCHONET_PLATFORM_WINDOWS
+    #include <Windows.h>
+#elif defined(KANCHONET_PLATFORM_LINUX)
+    #include <sys/mman.h>
+    #include <cerrno>
+    #include <cstring>
+#endif
+
+namespace KanchoNet
+{
+    HugePageArena::HugePageArena(size_t capacity, bool useHugePages)
+        : mBase(nullptr)
+        , mCapacity(0)
+        , mMappedSize(0)
+        , mPageMode(ArenaPageMode::Normal)
+        , mOffset(0)
+        , mUsedBytes(0)
+        , mPeakUsedBytes(0)
+        , mAllocations(0)
+        , mFailures(0)
+    {
+        if (capacity == 0)
+        {
+            return;
+        }
+
+        capacity = RoundUp(capacity, HUGE_PAGE_SIZE);
+        if (!Map(capacity, useHugePages))
+        {
+            LOG_ERROR("Failed to reserve buffer arena. Size: %zu", capacity);
+            return;
+        }
+
+        mCapacity = capacity;
+        LOG_INFO("Buffer arena reserved. Size: %zu, Pages: %s", mCapacity, GetPageModeName(mPageMode));
+    }
+
+    HugePageArena::~HugePageArena()
+    {
+        Unmap();
+    }
+
+    void* HugePageArena::Allocate(size_t size)
+    {
+        if (mBase == nullptr || size == 0)
+        {
+            return nullptr;
+        }
+
+        const size_t blockSize = RoundUp(size, ALIGNMENT);
+
+        SpinLockGuard lock(mLock);
+
+        void* ptr = nullptr;
+        auto it = mFreeLists.find(blockSize);
+        if (it != mFreeLists.end() && !it->second.empty())
+        {
+            ptr = it->second.back();
+            it->second.pop_back();
+        }
+        else if (blockSize <= mCapacity - mOffset)
+        {
+            ptr = mBase + mOffset;
+            mOffset += blockSize;
+        }
+        else
+        {
+            ++mFailures;
+            return nullptr;
+        }
+
+        ++mAllocations;
+        mUsedBytes += blockSize;
+        if (mUsedBytes > mPeakUsedBytes)
+        {
+            mPeakUsedBytes = mUsedBytes;
+        }
+        return ptr;
+    }
+
+    void HugePageArena::Deallocate(void* ptr, size_t size)
+    {
+        if (ptr == nullptr || !Owns(ptr))
+        {
+            return;
+        }
+
+        const size_t blockSize = RoundUp(size, ALIGNMENT);
+
+        SpinLockGuard lock(mLock);
+        mFreeLists[blockSize].push_back(ptr);
+        mUsedBytes -= blockSize;
+    }
+
+    ArenaStats HugePageArena::GetStats() const
+    {
+        ArenaStats stats;
+        stats.mCapacity = mCapacity;
+        stats.mPageMode = mPageMode;
+
+        SpinLockGuard lock(mLock);
+        stats.mCommittedBytes = mOffset;
+        stats.mUsedBytes = mUsedBytes;
+        stats.mPeakUsedBytes = mPeakUsedBytes;
+        stats.mAllocations = mAllocations;
+        stats.mFailures = mFailures;
+        return stats;
+    }
+
+    const char* HugePageArena::GetPageModeName(ArenaPageMode mode)
+    {
+        switch (mode)
+        {
+            case ArenaPageMode::Normal:      return "normal";
+            case ArenaPageMode::Transparent: return "transparent";
+            case ArenaPageMode::Explicit:    return "explicit";
+        }
+        return "unknown";
+    }
+
+    bool HugePageArena::Map(size_t size, bool useHugePages)
+    {
+        #ifdef KANCHONET_PLATFORM_WINDOWS
+            // 대형 페이지는 SeLockMemoryPrivilege가 있어야 하고 예약 즉시 물리 메모리를 잡음
+            if (useHugePages)
+            {
+                const SIZE_T largePageSize = GetLargePageMinimum();
+                if (largePageSize > 0)
+                {
+                    const size_t largeSize = RoundUp(size, largePageSize);
+                    void* base = VirtualAlloc(nullptr, largeSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+                    if (base)
+                    {
+                        mBase = static_cast<uint8_t*>(base);
+                        mMappedSize = largeSize;
+                        mPageMode = ArenaPageMode::Explicit;
+                        return true;
+                    }
+                }
+                LOG_WARNING("Large pages unavailable (error %lu). Falling back to normal pages", GetLastError());
+            }
+
+            void* base = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+            if (!base)
+            {
+                return false;
+            }
+
+            mBase = static_cast<uint8_t*>(base);
+            mMappedSize = size;
+            mPageMode = ArenaPageMode::Normal;
+            return true;
+        #elif defined(KANCHONET_PLATFORM_LINUX)
+            if (useHugePages)
+            {
+                // 1) 미리 확보된 대형 페이지 (vm.nr_hugepages, 부족하면 mmap이 바로 실패)
+                void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if (base != MAP_FAILED)
+                {
+                    mBase = static_cast<uint8_t*>(base);
+                    mMappedSize = size;
+                    mPageMode = ArenaPageMode::Explicit;
+                    return true;
+                }
+
+                // 2) 투명 대형 페이지: 커널이 2MB 단위로 합칠 수 있도록 시작 주소를 정렬해 예약
+                const size_t reserveSize = size + HUGE_PAGE_SIZE;
+                base = mmap(nullptr, reserveSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (base == MAP_FAILED)
+                {
+                    return false;
+                }
+
+                uint8_t* raw = static_cast<uint8_t*>(base);
+                uint8_t* aligned = reinterpret_cast<uint8_t*>(RoundUp(reinterpret_cast<uintptr_t>(raw), HUGE_PAGE_SIZE));
+                const size_t head = static_cast<size_t>(aligned - raw);
+                if (head > 0)
+                {
+                    munmap(raw, head);
+                }
+                if (reserveSize - head > size)
+                {
+                    munmap(aligned + size, reserveSize - head - size);
+                }
+
+                mBase = aligned;
+                mMappedSize = size;
+                if (madvise(mBase, size, MADV_HUGEPAGE) == 0)
+                {
+                    mPageMode = ArenaPageMode::Transparent;
+                }
+                else
+                {
+                    LOG_WARNING("Huge pages unavailable (%s). Falling back to normal pages", strerror(errno));
+                    mPageMode = ArenaPageMode::Normal;
+                }
+                return true;
+            }
+
+            void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (base == MAP_FAILED)
+            {
+                return false;
+            }
+
+            mBase = static_cast<uint8_t*>(base);
+            mMappedSize = size;
+            mPageMode = ArenaPageMode::Normal;
+            return true;
+        #endif
+    }
+
+    void HugePageArena::Unmap()
+    {
+        if (mBase == nullptr)
+        {
+            return;
+        }
+
+        #ifdef KANCHONET_PLATFORM_WINDOWS
+            VirtualFree(mBase, 0, MEM_RELEASE);
+        #elif defined(KANCHONET_PLATFORM_LINUX)
+            munmap(mBase, mMappedSize);
+        #endif
+
+        mBase = nullptr;
+        mCapacity = 0;
+        mMappedSize = 0;
+    }
+
+} // namespace KanchoNet
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "../Types.h"
+#include "../Utils/NonCopyable.h"
+#include "../Utils/SpinLock.h"
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace KanchoNet
+{
+    // 아레나 메모리의 페이지 종류
+    enum class ArenaPageMode : uint8_t
+    {
+        Normal,         // 일반 페이지 (대형 페이지를 쓸 수 없을 때)
+        Transparent,    // 투명 대형 페이지 (Linux madvise(MADV_HUGEPAGE), 커널이 가능할 때 2MB 페이지로 합침)
+        Explicit        // 명시적 대형 페이지 (Linux MAP_HUGETLB, Windows MEM_LARGE_PAGES)
+    };
+
+    // 아레나 사용량 스냅샷
+    struct ArenaStats
+    {
+        size_t mCapacity = 0;           // 예약한 전체 크기
+        size_t mCommittedBytes = 0;     // 한 번이라도 잘라 준 크기 (앞에서부터 순서대로 사용)
+        size_t mUsedBytes = 0;          // 현재 사용 중인 크기
+        size_t mPeakUsedBytes = 0;      // 최대 사용 크기
+        uint64_t mAllocations = 0;      // 아레나에서 할당한 횟수
+        uint64_t mFailures = 0;         // 공간이 부족해 할당하지 못한 횟수 (호출자는 일반 힙으로 대체)
+        ArenaPageMode mPageMode = ArenaPageMode::Normal;
+
+        double GetUtilization() const { return mCapacity > 0 ? static_cast<double>(mUsedBytes) / mCapacity : 0.0; }
+    };
+
+    // 대형 페이지 아레나
+    // 큰 영역 하나를 대형 페이지로 예약하고 세션 송수신 버퍼, 세션 슬랩, 버퍼 풀 저장소를 잘라 주어 TLB 미스를 줄임
+    // 대형 페이지를 쓸 수 없으면 일반 페이지로 예약 (GetPageMode로 확인)
+    //
+    // 블록은 캐시 라인 단위로 정렬되며, 반환된 블록은 같은 크기 요청에만 재사용됨 (합치지 않음)
+    // 세션 버퍼/풀 버퍼처럼 크기가 몇 가지로 정해진 할당에 맞춤
+    // 예약한 영역은 처음 만질 때 물리 메모리가 할당되므로 (MAP_HUGETLB 제외) 크게 잡아도 부담이 적음
+    // 스레드 안전
+    class HugePageArena : public NonCopyable
+    {
+    public:
+        // public 멤버변수
+        static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;   // x86-64 기본 대형 페이지 크기
+        static constexpr size_t ALIGNMENT = CACHE_LINE_SIZE;
+
+    private:
+        // private 멤버변수
+        uint8_t* mBase;
+        size_t mCapacity;
+        size_t mMappedSize;             // 해제 시 넘길 크기 (대형 페이지 단위로 올림)
+        ArenaPageMode mPageMode;
+
+        mutable SpinLock mLock;
+        size_t mOffset;                 // 다음에 잘라 줄 위치
+        size_t mUsedBytes;
+        size_t mPeakUsedBytes;
+        uint64_t mAllocations;
+        uint64_t mFailures;
+        std::unordered_map<size_t, std::vector<void*>> mFreeLists;  // 크기별 반환 블록
+
+    public:
+        // 생성자, 파괴자
+        // useHugePages가 false면 처음부터 일반 페이지로 예약
+        explicit HugePageArena(size_t capacity, bool useHugePages = true);
+        ~HugePageArena();
+
+    public:
+        // public 함수
+        // 블록 할당 (ALIGNMENT 정렬, 공간이 부족하면 nullptr)
+        void* Allocate(size_t size);
+
+        // 블록 반환 (size는 Allocate에 넘긴 값)
+        void Deallocate(void* ptr, size_t size);
+
+        // 이 아레나에서 할당한 블록인지
+        bool Owns(const void* ptr) const { return ptr >= mBase && ptr < mBase + mCapacity; }
+
+        bool IsValid() const { return mBase != nullptr; }
+        size_t GetCapacity() const { return mCapacity; }
+        ArenaPageMode GetPageMode() const { return mPageMode; }
+        ArenaStats GetStats() const;
+
+        static const char* GetPageModeName(ArenaPageMode mode);
+
+    private:
+        // private 함수
+        // 영역 예약 (성공 시 mBase/mMappedSize/mPageMode 설정)
+        bool Map(size_t size, bool useHugePages);
+        void Unmap();
+
+        static size_t RoundUp(size_t size, size_t unit) { return (size + unit - 1) / unit * unit; }
+    };
+
+    // HugePageArena에서 할당하는 표준 할당자 (아레나가 없거나 가득 차면 일반 힙 사용)
+    // PacketBuffer 등 std::vector 기반 저장소를 아레나에 두는 데 사용
+    template<typename T>
+    class ArenaAllocator
+    {
+    public:
+        // public 멤버변수
+        using value_type = T;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        HugePageArena* mArena;
+
+    public:
+        // 생성자, 파괴자
+        ArenaAllocator() noexcept : mArena(nullptr) {}
+        explicit ArenaAllocator(HugePageArena* arena) noexcept : mArena(arena) {}
+
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept : mArena(other.mArena) {}
+
+    public:
+        // public 함수
+        T* allocate(size_t count)
+        {
+            const size_t size = count * sizeof(T);
+            if (mArena)
+            {
+                if (void* ptr = mArena->Allocate(size))
+                {
+                    return static_cast<T*>(ptr);
+                }
+            }
+            return static_cast<T*>(::operator new(size));
+        }
+
+        void deallocate(T* ptr, size_t count) noexcept
+        {
+            if (mArena && mArena->Owns(ptr))
+            {
+                mArena->Deallocate(ptr, count * sizeof(T));
+                return;
+            }
+            ::operator delete(ptr);
+        }
+
+        template<typename U>
+        bool operator==(const ArenaAllocator<U>& other) const noexcept { return mArena == other.mArena; }
+        template<typename U>
+        bool operator!=(const ArenaAllocator<U>& other) const noexcept { return mArena != other.mArena; }
+    };
+
+} // namespace KanchoNet
@@ -15,6 +15,13 @@ namespace KanchoNet
         mData.reserve(initialCapacity);
     }
 
+    PacketBuffer::PacketBuffer(size_t initialCapacity, HugePageArena* arena)
+        : mData(ArenaAllocator<uint8_t>(arena))
+        , mSize(0)
+    {
+        mData.reserve(initialCapacity);
+    }
+
     PacketBuffer::PacketBuffer(const void* data, size_t size)
         : mSize(size)
     {
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "../Types.h"
+#include "HugePageArena.h"
 #include <vector>
+#include <memory>
 #include <cstring>
 
 namespace KanchoNet
@@ -15,13 +17,14 @@ namespace KanchoNet
         
     private:
         // private 멤버변수
-        std::vector<uint8_t> mData;
+        std::vector<uint8_t, ArenaAllocator<uint8_t>> mData;  // 아레나를 지정하지 않으면 일반 힙
         size_t mSize;  // 실제 사용 중인 데이터 크기
         
     public:
         // 생성자, 파괴자
         PacketBuffer();
         explicit PacketBuffer(size_t initialCapacity);
+        PacketBuffer(size_t initialCapacity, HugePageArena* arena);  // 저장소를 아레나에서 할당 (BufferPool용)
         PacketBuffer(const void* data, size_t size);
         
         // 복사/이동
@@ -57,5 +60,9 @@ namespace KanchoNet
         bool IsEmpty() const { return mSize == 0; }
     };
 
+    // 참조 카운트 기반 공유 패킷 (브로드캐스트 등 여러 세션에 복사 없이 전송할 때 사용)
+    // 송신 큐에 연결된 이후에는 내용을 수정하면 안 됨
+    using SharedPacketBuffer = std::shared_ptr<const PacketBuffer>;
+
 } // namespace KanchoNet
 
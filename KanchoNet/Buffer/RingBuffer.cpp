@@ -1,26 +1,39 @@
 #include "RingBuffer.h"
+#include "HugePageArena.h"
 #include <algorithm>
 
 namespace KanchoNet
 {
-    RingBuffer::RingBuffer(size_t capacity)
-        : mCapacity(capacity + 1) // +1 for distinguishing full from empty
+    RingBuffer::RingBuffer(size_t capacity, HugePageArena* arena)
+        : mBuffer(nullptr)
+        , mCapacity(capacity + 1) // +1 for distinguishing full from empty
+        , mArena(arena)
         , mReadPos(0)
         , mWritePos(0)
     {
-        mBuffer.resize(mCapacity);
+        if (mArena)
+        {
+            mBuffer = static_cast<uint8_t*>(mArena->Allocate(mCapacity));
+        }
+        if (mBuffer == nullptr)
+        {
+            mBuffer = new uint8_t[mCapacity];
+        }
     }
 
     RingBuffer::~RingBuffer()
     {
+        FreeStorage();
     }
 
     RingBuffer::RingBuffer(RingBuffer&& other) noexcept
-        : mBuffer(std::move(other.mBuffer))
+        : mBuffer(other.mBuffer)
         , mCapacity(other.mCapacity)
+        , mArena(other.mArena)
         , mReadPos(other.mReadPos)
         , mWritePos(other.mWritePos)
     {
+        other.mBuffer = nullptr;
         other.mCapacity = 0;
         other.mReadPos = 0;
         other.mWritePos = 0;
@@ -30,11 +43,15 @@ namespace KanchoNet
     {
         if (this != &other)
         {
-            mBuffer = std::move(other.mBuffer);
+            FreeStorage();
+
+            mBuffer = other.mBuffer;
             mCapacity = other.mCapacity;
+            mArena = other.mArena;
             mReadPos = other.mReadPos;
             mWritePos = other.mWritePos;
             
+            other.mBuffer = nullptr;
             other.mCapacity = 0;
             other.mReadPos = 0;
             other.mWritePos = 0;
@@ -59,14 +76,14 @@ namespace KanchoNet
         size_t contiguousSize = GetContiguousWriteSize();
         if (writeSize <= contiguousSize)
         {
-            std::memcpy(mBuffer.data() + mWritePos, src, writeSize);
+            std::memcpy(mBuffer + mWritePos, src, writeSize);
             mWritePos = (mWritePos + writeSize) % mCapacity;
         }
         else
         {
             // 두 번에 나눠서 쓰기 (순환)
-            std::memcpy(mBuffer.data() + mWritePos, src, contiguousSize);
-            std::memcpy(mBuffer.data(), src + contiguousSize, writeSize - contiguousSize);
+            std::memcpy(mBuffer + mWritePos, src, contiguousSize);
+            std::memcpy(mBuffer, src + contiguousSize, writeSize - contiguousSize);
             mWritePos = writeSize - contiguousSize;
         }
 
@@ -100,13 +117,13 @@ namespace KanchoNet
         size_t contiguousSize = GetContiguousReadSize();
         if (peekSize <= contiguousSize)
         {
-            std::memcpy(dest, mBuffer.data() + mReadPos, peekSize);
+            std::memcpy(dest, mBuffer + mReadPos, peekSize);
         }
         else
         {
             // 두 번에 나눠서 읽기 (순환)
-            std::memcpy(dest, mBuffer.data() + mReadPos, contiguousSize);
-            std::memcpy(dest + contiguousSize, mBuffer.data(), peekSize - contiguousSize);
+            std::memcpy(dest, mBuffer + mReadPos, contiguousSize);
+            std::memcpy(dest + contiguousSize, mBuffer, peekSize - contiguousSize);
         }
 
         return peekSize;
@@ -189,5 +206,69 @@ namespace KanchoNet
         mReadPos = (mReadPos + commitSize) % mCapacity;
     }
 
+    size_t RingBuffer::GetReadSegments(const uint8_t* segments[2], size_t sizes[2]) const
+    {
+        segments[0] = mBuffer + mReadPos;
+        sizes[0] = GetContiguousReadSize();
+        segments[1] = nullptr;
+        sizes[1] = 0;
+
+        if (sizes[0] == 0)
+        {
+            segments[0] = nullptr;
+            return 0;
+        }
+
+        // 쓰기 위치가 앞쪽으로 감싼 경우 버퍼 시작부터 이어짐
+        if (mWritePos < mReadPos && mWritePos > 0)
+        {
+            segments[1] = mBuffer;
+            sizes[1] = mWritePos;
+            return 2;
+        }
+
+        return 1;
+    }
+
+    size_t RingBuffer::GetWriteSegments(uint8_t* segments[2], size_t sizes[2])
+    {
+        segments[0] = mBuffer + mWritePos;
+        sizes[0] = GetContiguousWriteSize();
+        segments[1] = nullptr;
+        sizes[1] = 0;
+
+        if (sizes[0] == 0)
+        {
+            segments[0] = nullptr;
+            return 0;
+        }
+
+        // 끝까지 쓰고 나면 버퍼 시작부터 읽기 위치 직전까지 이어서 쓸 수 있음
+        if (mWritePos >= mReadPos && mReadPos > 1)
+        {
+            segments[1] = mBuffer;
+            sizes[1] = mReadPos - 1;
+            return 2;
+        }
+
+        return 1;
+    }
+
+    void RingBuffer::FreeStorage()
+    {
+        if (mBuffer == nullptr)
+            return;
+
+        if (mArena && mArena->Owns(mBuffer))
+        {
+            mArena->Deallocate(mBuffer, mCapacity);
+        }
+        else
+        {
+            delete[] mBuffer;
+        }
+        mBuffer = nullptr;
+    }
+
 } // namespace KanchoNet
 
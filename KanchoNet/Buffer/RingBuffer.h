@@ -2,13 +2,15 @@
 
 #include "../Types.h"
 #include "../Utils/NonCopyable.h"
-#include <vector>
 #include <cstring>
 
 namespace KanchoNet
 {
+    class HugePageArena;
+
     // 순환 버퍼 (Circular Buffer)
     // 송수신 버퍼로 사용되며, 연속된 메모리 공간에서 효율적인 데이터 관리
+    // 아레나를 지정하면 저장소를 아레나에서 잘라 받음 (가득 차면 일반 힙)
     class RingBuffer : public NonCopyable
     {
     public:
@@ -16,14 +18,15 @@ namespace KanchoNet
         
     private:
         // private 멤버변수
-        std::vector<uint8_t> mBuffer;
+        uint8_t* mBuffer;
         size_t mCapacity;
+        HugePageArena* mArena;  // 저장소를 요청한 아레나 (nullptr = 일반 힙)
         size_t mReadPos;
         size_t mWritePos;
         
     public:
         // 생성자, 파괴자
-        explicit RingBuffer(size_t capacity);
+        explicit RingBuffer(size_t capacity, HugePageArena* arena = nullptr);
         ~RingBuffer();
 
         // 이동 생성자/대입 연산자
@@ -46,6 +49,7 @@ namespace KanchoNet
         
         // 버퍼 상태
         size_t GetCapacity() const { return mCapacity; }
+        HugePageArena* GetArena() const { return mArena; }
         size_t GetAvailableRead() const;  // 읽을 수 있는 데이터 크기
         size_t GetAvailableWrite() const; // 쓸 수 있는 여유 공간
         bool IsEmpty() const { return mReadPos == mWritePos; }
@@ -55,12 +59,21 @@ namespace KanchoNet
         void Clear();
         
         // 직접 메모리 접근 (고급 사용)
-        uint8_t* GetWritePtr() { return mBuffer.data() + mWritePos; }
-        const uint8_t* GetReadPtr() const { return mBuffer.data() + mReadPos; }
+        uint8_t* GetWritePtr() { return mBuffer + mWritePos; }
+        const uint8_t* GetReadPtr() const { return mBuffer + mReadPos; }
         size_t GetContiguousWriteSize() const; // 연속된 쓰기 가능 크기
         size_t GetContiguousReadSize() const;  // 연속된 읽기 가능 크기
         void CommitWrite(size_t size);         // 쓰기 완료 알림
         void CommitRead(size_t size);          // 읽기 완료 알림
+
+        // 읽을 수 있는 데이터/쓸 수 있는 공간을 연속 구간으로 (끝을 넘어 감싸면 2개)
+        // 반환값: 구간 수 (0~2, 쓰지 않은 항목은 nullptr/0)
+        size_t GetReadSegments(const uint8_t* segments[2], size_t sizes[2]) const;
+        size_t GetWriteSegments(uint8_t* segments[2], size_t sizes[2]);
+
+    private:
+        // private 함수
+        void FreeStorage();
     };
 
 } // namespace KanchoNet
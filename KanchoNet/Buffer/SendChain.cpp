@@ -0,0 +1,162 @@
+#include "SendChain.h"
+#include <algorithm>
+
+namespace KanchoNet
+{
+    SendChain::SendChain(size_t maxBytes)
+        : mTotalBytes(0)
+        , mMaxBytes(maxBytes)
+    {
+    }
+
+    SendChain::~SendChain()
+    {
+    }
+
+    SendChain::SendChain(SendChain&& other) noexcept
+        : mSegments(std::move(other.mSegments))
+        , mCopyTail(std::move(other.mCopyTail))
+        , mTotalBytes(other.mTotalBytes)
+        , mMaxBytes(other.mMaxBytes)
+    {
+        other.mTotalBytes = 0;
+    }
+
+    SendChain& SendChain::operator=(SendChain&& other) noexcept
+    {
+        if (this != &other)
+        {
+            mSegments = std::move(other.mSegments);
+            mCopyTail = std::move(other.mCopyTail);
+            mTotalBytes = other.mTotalBytes;
+            mMaxBytes = other.mMaxBytes;
+
+            other.mTotalBytes = 0;
+        }
+        return *this;
+    }
+
+    bool SendChain::Append(const SharedPacketBuffer& payload)
+    {
+        return Append(&payload, 1);
+    }
+
+    bool SendChain::Append(const SharedPacketBuffer* payloads, size_t count)
+    {
+        if (payloads == nullptr || count == 0)
+            return false;
+
+        // 용량 확인 (부분 추가 방지)
+        size_t totalSize = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (payloads[i])
+            {
+                totalSize += payloads[i]->GetSize();
+            }
+        }
+
+        if (!CanAppend(totalSize))
+            return false;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!payloads[i] || payloads[i]->IsEmpty())
+                continue;
+
+            mSegments.push_back(Segment{ payloads[i], 0 });
+            mTotalBytes += payloads[i]->GetSize();
+        }
+
+        // 공유 세그먼트 뒤에는 복사 데이터를 이어붙이지 않음 (순서 유지)
+        mCopyTail.reset();
+        return true;
+    }
+
+    bool SendChain::Append(const void* data, size_t size)
+    {
+        if (data == nullptr || size == 0)
+            return false;
+
+        if (!CanAppend(size))
+            return false;
+
+        // 마지막 복사 세그먼트에 재할당 없이 들어가면 이어붙임
+        // (io_uring 등 비동기 송신 중에도 기존 데이터 주소가 바뀌지 않도록 capacity 이내로 제한)
+        if (mCopyTail && mCopyTail->GetSize() + size <= mCopyTail->GetCapacity())
+        {
+            mCopyTail->Append(data, size);
+            mTotalBytes += size;
+            return true;
+        }
+
+        auto segment = std::make_shared<PacketBuffer>((std::max)(size, COPY_SEGMENT_SIZE));
+        segment->Append(data, size);
+
+        mSegments.push_back(Segment{ segment, 0 });
+        mCopyTail = std::move(segment);
+        mTotalBytes += size;
+        return true;
+    }
+
+    size_t SendChain::Consume(size_t size)
+    {
+        size_t consumed = 0;
+
+        while (size > 0 && !mSegments.empty())
+        {
+            Segment& front = mSegments.front();
+            size_t remaining = front.mPayload->GetSize() - front.mOffset;
+
+            if (size < remaining)
+            {
+                front.mOffset += size;
+                consumed += size;
+                break;
+            }
+
+            // 세그먼트 전체 송신 완료
+            if (mCopyTail && mCopyTail.get() == front.mPayload.get())
+            {
+                mCopyTail.reset();
+            }
+
+            mSegments.pop_front();
+            size -= remaining;
+            consumed += remaining;
+        }
+
+        mTotalBytes -= consumed;
+        return consumed;
+    }
+
+#ifdef KANCHONET_PLATFORM_LINUX
+    size_t SendChain::FillIOVec(struct iovec* iov, size_t maxCount) const
+    {
+        if (iov == nullptr)
+            return 0;
+
+        size_t count = 0;
+        for (const Segment& segment : mSegments)
+        {
+            if (count >= maxCount)
+                break;
+
+            iov[count].iov_base = const_cast<uint8_t*>(segment.mPayload->GetData()) + segment.mOffset;
+            iov[count].iov_len = segment.mPayload->GetSize() - segment.mOffset;
+            ++count;
+        }
+
+        return count;
+    }
+#endif
+
+    void SendChain::Clear()
+    {
+        mSegments.clear();
+        mCopyTail.reset();
+        mTotalBytes = 0;
+    }
+
+} // namespace KanchoNet
+
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../Types.h"
+#include "../Utils/NonCopyable.h"
+#include "PacketBuffer.h"
+#include <deque>
+#include <memory>
+
+#ifdef KANCHONET_PLATFORM_LINUX
+    #include <sys/uio.h>
+#endif
+
+namespace KanchoNet
+{
+    // 참조 카운트 세그먼트 기반 송신 큐 (Scatter/Gather)
+    // RingBuffer와 달리 데이터를 하나의 연속 메모리로 모으지 않고 세그먼트 목록으로 유지하며,
+    // 송신 시 writev/sendmsg 한 번으로 여러 세그먼트를 전송
+    // 공유 패킷(SharedPacketBuffer)은 복사 없이 참조만 추가되므로 브로드캐스트/대용량 데이터에 유리
+    // 스레드 안전하지 않음 (세션 락으로 보호)
+    class SendChain : public NonCopyable
+    {
+    public:
+        // public 멤버변수
+        // 한 번의 송신 호출에 담을 수 있는 최대 세그먼트 수 (Linux IOV_MAX)
+        static constexpr size_t MAX_IOV_COUNT = 1024;
+
+        // 복사 데이터를 담는 세그먼트의 기본 크기 (작은 패킷들은 하나의 세그먼트로 합쳐짐)
+        static constexpr size_t COPY_SEGMENT_SIZE = DEFAULT_BUFFER_SIZE;
+
+    private:
+        // private 멤버변수
+        struct Segment
+        {
+            SharedPacketBuffer mPayload;
+            size_t mOffset;  // 이미 송신 완료된 바이트 수
+        };
+
+        std::deque<Segment> mSegments;
+        std::shared_ptr<PacketBuffer> mCopyTail;  // 마지막 세그먼트가 체인 소유의 복사 세그먼트일 때만 유효
+        size_t mTotalBytes;                       // 송신 대기 중인 전체 바이트 수
+        size_t mMaxBytes;                         // 최대 대기 바이트 수 (0 = 무제한)
+
+    public:
+        // 생성자, 파괴자
+        explicit SendChain(size_t maxBytes = 0);
+        ~SendChain();
+
+        // 이동 생성자/대입 연산자
+        SendChain(SendChain&& other) noexcept;
+        SendChain& operator=(SendChain&& other) noexcept;
+
+    public:
+        // public 함수
+        // 공유 패킷 추가 (복사 없음)
+        bool Append(const SharedPacketBuffer& payload);
+
+        // 여러 공유 패킷을 하나의 메시지로 추가 (헤더 + 바디 등, 전부 추가되거나 전부 실패)
+        bool Append(const SharedPacketBuffer* payloads, size_t count);
+
+        // 데이터 복사 후 추가 (마지막 복사 세그먼트에 여유가 있으면 이어붙임)
+        bool Append(const void* data, size_t size);
+
+        // 송신 완료된 바이트만큼 앞쪽 세그먼트 해제
+        size_t Consume(size_t size);
+
+    #ifdef KANCHONET_PLATFORM_LINUX
+        // 송신 대기 중인 세그먼트들을 iovec 배열로 채움 (반환값: 채운 개수)
+        size_t FillIOVec(struct iovec* iov, size_t maxCount) const;
+    #endif
+
+        // 상태
+        size_t GetTotalBytes() const { return mTotalBytes; }
+        size_t GetSegmentCount() const { return mSegments.size(); }
+        size_t GetMaxBytes() const { return mMaxBytes; }
+        bool IsEmpty() const { return mTotalBytes == 0; }
+        bool CanAppend(size_t size) const { return mMaxBytes == 0 || mTotalBytes + size <= mMaxBytes; }
+
+        // 최대 대기 바이트 수 설정
+        void SetMaxBytes(size_t maxBytes) { mMaxBytes = maxBytes; }
+
+        // 전체 비우기
+        void Clear();
+    };
+
+} // namespace KanchoNet
+
@@ -33,6 +33,49 @@ namespace KanchoNet
             return false;
         }
 
+        // 리슨 소켓 옵션 확인
+        if (mDeferAcceptSec > 3600 || mFastOpenQueue > 65535)
+        {
+            return false;
+        }
+
+        // CPU/NUMA 배치 확인
+        if (mNumaNode < -1 || mIncomingCpu < -1)
+        {
+            return false;
+        }
+
+        // 바쁜 대기 시간 확인 (최대 10초)
+        if (mBusyPollIdleUs > 10000000 || mSocketBusyPollUs > 10000000)
+        {
+            return false;
+        }
+
+        // 수신 속도 제한 처리 확인
+        if (mRateLimitAction > RateLimitAction::Disconnect)
+        {
+            return false;
+        }
+
+        // 과부하 회복 기준과 제한 방식 확인
+        if (mOverloadRecoverPercent == 0 || mOverloadRecoverPercent > 100 ||
+            mOverloadShedBelow > SessionPriority::High || mOverloadShedAction > RateLimitAction::Disconnect)
+        {
+            return false;
+        }
+
+        // 태스크 워커 수 확인
+        if (mTaskWorkerCount > 256 || mStrandBatchSize == 0)
+        {
+            return false;
+        }
+
+        // 메트릭 엔드포인트 포트는 리슨 포트와 달라야 함
+        if (mMetricsPort != 0 && mMetricsPort == mPort)
+        {
+            return false;
+        }
+
         // RIO 설정 확인
         if (mRioReceiveBufferCount == 0 || mRioReceiveBufferCount > 100000)
         {
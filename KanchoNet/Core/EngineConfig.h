@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../Types.h"
+#include <string>
+#include <vector>
 
 namespace KanchoNet
 {
@@ -13,17 +15,78 @@ namespace KanchoNet
         uint16_t mPort = DEFAULT_PORT;                           // 리슨 포트
         uint32_t mMaxSessions = DEFAULT_MAX_SESSIONS;            // 최대 동시 접속 수
         uint32_t mBacklog = DEFAULT_BACKLOG;                     // listen() backlog 크기
+        SocketHandle mInheritedListenSocket = INVALID_SOCKET_HANDLE; // 이전 프로세스에서 인계받은 리슨 소켓 (ListenerHandoff, 지정하면 생성/bind 생략, Linux)
 
         // 버퍼 설정
         size_t mSendBufferSize = DEFAULT_SEND_BUFFER_SIZE;       // 송신 버퍼 크기
         size_t mRecvBufferSize = DEFAULT_RECV_BUFFER_SIZE;       // 수신 버퍼 크기
+        bool mUseSendChain = false;                              // 송신 큐 방식 (true = 세그먼트 체인 + writev/sendmsg, false = RingBuffer)
+        size_t mBufferArenaSize = 0;                             // 세션 슬랩/송수신 버퍼를 할당할 아레나 크기 (0 = 사용 안 함, 부족분은 일반 힙)
+        bool mArenaHugePages = true;                             // 아레나를 대형 페이지로 예약 (쓸 수 없으면 일반 페이지)
+
+        // 어플리케이션 태스크 설정
+        uint32_t mTaskWorkerCount = 0;                           // 콜백 실행 워커 수 (0 = I/O 스레드에서 세션 스트랜드 직접 실행)
+        uint32_t mStrandBatchSize = 64;                          // 스트랜드가 워커를 한 번 점유할 때 실행하는 최대 작업 수
+
+        // 수신 공정성 (Linux epoll/io_uring)
+        // 한 세션이 예산을 다 쓰면 남은 데이터는 다음 ProcessIO 회차에 이어 읽음 (다른 세션의 이벤트를 먼저 처리)
+        uint32_t mReadBudgetBytes = 64 * 1024;                   // 한 회차에 한 세션에서 읽는 최대 바이트 (0 = 무제한)
+        uint32_t mReadBudgetCount = 16;                          // 한 회차에 한 세션에서 처리하는 최대 수신 횟수 (0 = 무제한)
+
+        // 수신 속도 제한 (Linux epoll/io_uring, 토큰 버킷, 0 = 제한 없음)
+        // 수신 경로에서 락 없이 평가하며, 버스트를 0으로 두면 초당 한도만큼(1초분) 몰아서 허용
+        uint64_t mRateLimitBytesPerSec = 0;                      // 세션당 초당 수신 바이트
+        uint64_t mRateLimitBytesBurst = 0;                       // 세션당 버스트 바이트
+        uint32_t mRateLimitMessagesPerSec = 0;                   // 세션당 초당 수신 횟수 (OnReceive 호출 단위)
+        uint32_t mRateLimitMessagesBurst = 0;                    // 세션당 버스트 수신 횟수
+        RateLimitAction mRateLimitAction = RateLimitAction::Pause; // 세션 한도를 넘었을 때의 처리
+        uint32_t mRateLimitConnectionsPerSec = 0;                // 출발지 IP당 초당 수락 연결 수 (넘으면 수락 직후 닫음)
+        uint32_t mRateLimitConnectionsBurst = 0;                 // 출발지 IP당 버스트 연결 수
+
+        // 과부하 감지와 부하 차단 (Linux epoll/io_uring, 0 = 해당 항목 사용 안 함)
+        // ProcessIO 회차마다 측정해 한 항목이라도 한도를 넘으면 새 연결 수락을 멈추고 낮은 우선순위 세션의 수신을 제한하며 OnOverload 호출
+        uint32_t mOverloadLoopLagUs = 0;                         // 이벤트 루프 지연 한도 (깨어난 뒤 한 회차 처리를 마칠 때까지, 이동 평균, us)
+        uint32_t mOverloadReadyDepth = 0;                        // 준비 큐 깊이 한도 (한 회차에 받은 이벤트 + 이어 읽을 세션 수, 이동 평균)
+        uint64_t mOverloadSendBacklogBytes = 0;                  // 전체 세션 송신 큐에 쌓인 바이트 한도
+        uint32_t mOverloadRecoverPercent = 50;                   // 모든 항목이 한도의 이 비율 아래로 내려가면 회복 (1~100)
+        uint32_t mOverloadHoldMs = 1000;                         // 과부하 상태를 유지하는 최소 시간 (ms)
+        SessionPriority mOverloadShedBelow = SessionPriority::Normal; // 과부하 중 이 우선순위보다 낮은 세션의 수신 제한
+        RateLimitAction mOverloadShedAction = RateLimitAction::Pause; // 제한 방식 (Pause는 과부하가 끝날 때까지 읽기 중지)
+
+        // 바쁜 대기 (Linux epoll/io_uring, 격리된 코어에 고정한 지연 민감 서버용)
+        bool mBusyPoll = false;                                  // ProcessIO가 커널에서 잠들지 않고 회전하며 이벤트 확인 (io_uring은 SQPOLL 사용)
+        uint32_t mBusyPollIdleUs = 1000;                         // 이벤트 없이 이 시간이 지나면 timeout만큼 잠들어 코어 양보 (us, 0 = 계속 회전)
+        uint32_t mSocketBusyPollUs = 0;                          // SO_BUSY_POLL/SO_PREFER_BUSY_POLL 시간 (us, 0 = 사용 안 함, 리슨 소켓에서 상속)
+
+        // CPU/NUMA 배치 (Linux, 듀얼 소켓 서버에서는 노드마다 엔진 하나를 mReusePort로 띄우는 구성을 권장)
+        std::vector<uint32_t> mIOThreadCpus;                     // BindIOThread(i)가 i번째 I/O 스레드를 고정할 CPU (비우면 mNumaNode의 CPU)
+        std::vector<uint32_t> mTaskWorkerCpus;                   // i번째 태스크 워커를 고정할 CPU (비우면 mNumaNode의 CPU)
+        int32_t mNumaNode = -1;                                  // 세션 슬랩/버퍼를 할당할 NUMA 노드 (-1 = 지정 안 함)
+        bool mReusePort = false;                                 // SO_REUSEPORT (같은 포트에 엔진 여러 개)
+        int32_t mIncomingCpu = -1;                               // 리슨 소켓 SO_INCOMING_CPU (-1 = 사용 안 함)
+                                                                 // mReusePort와 함께 쓰면 이 CPU가 수신 큐를 처리한 연결을 이 엔진이 우선 받음
         
         // 소켓 옵션
         bool mNoDelay = true;                                    // Nagle 알고리즘 비활성화 (true = 비활성화)
         bool mKeepAlive = true;                                  // TCP Keep-Alive 활성화
         uint32_t mKeepAliveTime = 7200000;                       // Keep-Alive 시작 시간 (ms, 기본 2시간)
         uint32_t mKeepAliveInterval = 1000;                      // Keep-Alive 간격 (ms, 기본 1초)
+                                                                 // 위 옵션은 리슨 소켓에 설정하며 수락된 소켓이 그대로 상속함
+
+        // 리슨 소켓 설정 (Linux)
+        uint32_t mDeferAcceptSec = 0;                            // TCP_DEFER_ACCEPT: 첫 데이터가 도착할 때까지 accept 지연 (초, 0 = 비활성화)
+                                                                 // 서버가 먼저 보내는 프로토콜에서는 사용하지 말 것
+        uint32_t mFastOpenQueue = 0;                             // TCP_FASTOPEN: SYN 데이터를 받는 대기 연결 최대 수 (0 = 비활성화)
         
+        // 모니터링
+        bool mEnableMetrics = true;                              // 메트릭 수집 (카운터 + 지연 히스토그램, Linux epoll/io_uring)
+        uint16_t mMetricsPort = 0;                               // 메트릭 HTTP 엔드포인트 포트 (0 = 비활성화, Linux epoll/io_uring)
+        std::string mMetricsBindAddress = "127.0.0.1";           // 메트릭 엔드포인트 바인드 주소 (IPv4)
+        
+        // epoll 전용 설정
+        bool mEpollOneShot = false;                              // 다중 대기 모드 (리슨 소켓 EPOLLEXCLUSIVE, 클라이언트 EPOLLONESHOT 재등록)
+                                                                 // 여러 스레드가 ProcessIO를 호출할 때 한 세션의 이벤트를 한 스레드만 처리
+
         // RIO 전용 설정
         uint32_t mRioReceiveBufferCount = 1024;                  // RIO 수신 버퍼 개수
         uint32_t mRioSendBufferCount = 1024;                     // RIO 송신 버퍼 개수
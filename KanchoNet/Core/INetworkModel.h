@@ -4,10 +4,15 @@
 #include "../Core/EngineConfig.h"
 #include "../Session/Session.h"
 #include "../Buffer/PacketBuffer.h"
+#include "../Metrics/NetworkMetrics.h"
+#include "../Metrics/LoadMonitor.h"
 #include <functional>
 
 namespace KanchoNet
 {
+    class MetricsHttpServer;
+    class SessionManager;
+
     // 네트워크 모델 인터페이스
     // 모든 네트워크 모델(IOCP, RIO, epoll, io_uring)이 구현해야 하는 공통 인터페이스
     // 템플릿 기반 설계와 함께 인터페이스 상속을 통해 타입 안전성과 명확성을 보장
@@ -29,15 +34,71 @@ namespace KanchoNet
         
         // 패킷 전송
         virtual bool Send(Session* session, const PacketBuffer& buffer) = 0;
+
+        // 공유 패킷 전송 (여러 세그먼트를 하나의 메시지로 원자적으로 큐잉)
+        // 세그먼트 체인을 지원하는 모델은 복사 없이 참조만 추가하도록 오버라이드
+        // 기본 구현은 세그먼트를 하나의 버퍼로 합쳐 Send()로 전달
+        virtual bool SendShared(Session* session, const SharedPacketBuffer* packets, size_t count)
+        {
+            if (!session || !packets || count == 0)
+            {
+                return false;
+            }
+
+            if (count == 1)
+            {
+                return packets[0] && Send(session, *packets[0]);
+            }
+
+            PacketBuffer merged;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (packets[i])
+                {
+                    merged.Append(*packets[i]);
+                }
+            }
+            return Send(session, merged);
+        }
         
+        // 송신 버퍼에 직접 쓰기 (중간 버퍼 없이 직렬화할 때 사용)
+        // BeginSend는 세션 락을 잡고 송신 RingBuffer를 반환하며, 호출자는 쓴 만큼 CommitWrite한 뒤 반드시 EndSend 호출
+        // 지원하지 않는 모델이나 세그먼트 체인 모드, 종료된 세션이면 락을 잡지 않고 nullptr
+        virtual RingBuffer* BeginSend(Session* /*session*/) { return nullptr; }
+
+        // BeginSend 이후 커밋한 bytes만큼 송신 요청 후 세션 락 해제 (0이면 락만 해제)
+        virtual void EndSend(Session* /*session*/, size_t /*bytes*/) {}
+        
+        // 새 연결 수락 중지 (리슨 소켓은 닫지 않으며 대기 중인 연결은 큐에 남음, 드레인/리슨 소켓 인계용)
+        // 반환값: 지원 여부
+        virtual bool StopAccepting() { return false; }
+
+        // 리슨 소켓 (다른 프로세스에 인계할 때 사용, 노출하지 않는 모델은 INVALID_SOCKET_HANDLE)
+        virtual SocketHandle GetListenSocket() const { return INVALID_SOCKET_HANDLE; }
+
         // 종료
         virtual void Shutdown() = 0;
 
+        // 메트릭 (수집하지 않는 모델이나 비활성화 시 nullptr)
+        virtual const NetworkMetrics* GetMetrics() const { return nullptr; }
+
+        // 메트릭 HTTP 엔드포인트 (EngineConfig::mMetricsPort가 0이거나 지원하지 않는 모델은 nullptr)
+        virtual MetricsHttpServer* GetMetricsServer() { return nullptr; }
+
+        // 현재 부하 (과부하 감지를 지원하지 않거나 EngineConfig::mOverload* 한도를 설정하지 않으면 기본값)
+        virtual LoadSnapshot GetLoad() const { return LoadSnapshot(); }
+
+        // 세션 매니저 (엔진이 세션 참조를 잡고 반환할 때 사용, 노출하지 않는 모델은 nullptr)
+        virtual SessionManager* GetSessionManager() { return nullptr; }
+
         // 콜백 설정
         virtual void SetAcceptCallback(std::function<void(Session*)> callback) = 0;
         virtual void SetReceiveCallback(std::function<void(Session*, const uint8_t*, size_t)> callback) = 0;
         virtual void SetDisconnectCallback(std::function<void(Session*)> callback) = 0;
         virtual void SetErrorCallback(std::function<void(Session*, ErrorCode)> callback) = 0;
+
+        // 과부하 진입/회복 콜백 (과부하 감지를 지원하는 모델만 호출, 상태가 바뀐 I/O 스레드에서 한 번씩)
+        virtual void SetOverloadCallback(std::function<void(const LoadSnapshot&)> /*callback*/) {}
     };
 
 } // namespace KanchoNet
@@ -7,7 +7,9 @@
     #include "../Network/RIOModel.h"
 #elif defined(KANCHONET_PLATFORM_LINUX)
     #include "../Network/EpollModel.h"
-    #include "../Network/IOUringModel.h"
+    #ifdef KANCHONET_HAS_LIBURING
+        #include "../Network/IOUringModel.h"
+    #endif
 #endif
 
 // 템플릿 명시적 인스턴스화
@@ -20,9 +22,11 @@ namespace KanchoNet
         template class NetworkEngine<IOCPModel>;
         template class NetworkEngine<RIOModel>;
     #elif defined(KANCHONET_PLATFORM_LINUX)
-        // Linux: EpollModel과 IOUringModel 인스턴스화
+        // Linux: EpollModel과 IOUringModel 인스턴스화 (IOUringModel은 liburing이 있을 때만)
         template class NetworkEngine<EpollModel>;
-        template class NetworkEngine<IOUringModel>;
+        #ifdef KANCHONET_HAS_LIBURING
+            template class NetworkEngine<IOUringModel>;
+        #endif
     #endif
 
 } // namespace KanchoNet
@@ -4,10 +4,23 @@
 #include "INetworkModel.h"
 #include "EngineConfig.h"
 #include "../Session/Session.h"
+#include "../Session/SessionManager.h"
+#include "../Task/TaskScheduler.h"
 #include "../Buffer/PacketBuffer.h"
+#include "../Buffer/BufferPool.h"
+#include "../Metrics/MetricsHttpServer.h"
+#include "../Network/SocketUtils.h"
 #include "../Utils/NonCopyable.h"
+#include "../Utils/CpuAffinity.h"
+#include "../Utils/Logger.h"
 #include <memory>
 #include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 namespace KanchoNet
 {
@@ -23,9 +36,15 @@ namespace KanchoNet
         // private 멤버변수
         std::atomic<bool> mInitialized;
         std::atomic<bool> mRunning;
+        std::atomic<bool> mDraining;
         
         EngineConfig mConfig;
         std::unique_ptr<TNetworkModel> mNetworkModel;
+
+        // 어플리케이션 태스크 (EngineConfig::mTaskWorkerCount가 0이면 nullptr, 스트랜드는 I/O 스레드에서 직접 실행)
+        std::unique_ptr<TaskScheduler> mTaskScheduler;
+        SessionManager* mSessionManager;    // 스트랜드 실행 중 잡은 세션 참조 반환용 (네트워크 모델 소유, 없으면 스트랜드 미사용)
+        std::vector<uint32_t> mNodeCpus;    // EngineConfig::mNumaNode의 CPU (CPU 목록을 지정하지 않은 스레드를 고정)
         
     public:
         // 생성자, 파괴자
@@ -42,15 +61,53 @@ namespace KanchoNet
         // I/O 처리 (어플리케이션 스레드에서 호출)
         bool ProcessIO(uint32_t timeoutMs = 0);
 
+        // 정상 종료: 새 연결 수락을 멈추고, 세션마다 OnDrain(작별 패킷 등)을 실행한 뒤
+        // 송신 큐가 비면 송신 방향을 닫아(FIN) 클라이언트가 연결을 끊기를 기다림
+        // 대기 중에도 I/O 스레드는 ProcessIO를 계속 호출해야 함 (Drain은 I/O 스레드가 아닌 스레드에서 호출)
+        // Stop은 호출하지 않음: 반환 후 호출자가 ProcessIO 스레드를 모두 멈추고 합류한 뒤 Stop 호출
+        // 반환값: timeoutMs 안에 모든 세션이 닫혔는지 (false면 남은 세션은 Stop에서 강제로 닫힘)
+        bool Drain(uint32_t timeoutMs);
+        bool IsDraining() const { return mDraining; }
+
+        // 리슨 소켓 (ListenerHandoff로 새 프로세스에 넘길 때 사용, 지원하지 않는 모델이면 INVALID_SOCKET_HANDLE)
+        SocketHandle GetListenSocket() const { return mNetworkModel->GetListenSocket(); }
+
+        // 호출 스레드를 index번째 I/O 스레드로 배치 (ProcessIO 루프 시작 전에 호출)
+        // EngineConfig::mIOThreadCpus가 있으면 그 중 하나에, 없으면 mNumaNode의 CPU 전체에 고정하고
+        // 이후 이 스레드가 처음 만지는 세션 슬랩/버퍼 페이지가 mNumaNode에 할당되도록 함
+        bool BindIOThread(uint32_t index);
+
         // 패킷 전송
         bool Send(Session* session, const PacketBuffer& buffer);
         bool Send(Session* session, const void* data, size_t size);
 
+        // 송신 버퍼에 직접 직렬화 (중간 PacketBuffer 없음)
+        // writer(RingBuffer&)는 세션 락을 잡은 상태에서 호출되며, 쓴 만큼 CommitWrite하고 그 바이트 수를 반환 (0 = 쓰지 않음)
+        // 반환값: 송신 요청 여부 (모델이 지원하지 않거나 세그먼트 체인 모드, 공간 부족이면 false이므로 Send로 대체)
+        template<typename TWriter>
+        bool SendInPlace(Session* session, TWriter&& writer);
+
+        // 공유 패킷 전송 (세그먼트 체인 사용 시 복사 없이 송신 큐에 연결)
+        bool SendShared(Session* session, const SharedPacketBuffer& packet);
+        bool SendShared(Session* session, const SharedPacketBuffer& header, const SharedPacketBuffer& body);
+
         // 세션 검색
         Session* GetSession(SessionID sessionID);
         
         // 전체 세션 브로드캐스트
         void Broadcast(const PacketBuffer& buffer);
+
+        // 세션 스트랜드에 작업 추가 (해당 세션의 콜백/작업과 순서대로, 한 번에 하나씩 실행)
+        // 태스크 워커가 있으면 워커에서, 없으면 스트랜드가 비어있을 때 호출 스레드에서 바로 실행
+        // (다른 스레드가 그 세션의 콜백을 실행 중이면 그 스레드가 이어서 실행)
+        // session은 유효한 동안(그 세션의 콜백 안 등)에만 전달해야 함
+        bool Post(Session* session, TaskFunction task);
+
+        // 세션과 무관한 작업 추가 (태스크 워커 중 하나에서 실행, 워커가 없으면 호출 스레드에서 바로 실행)
+        bool Post(TaskFunction task);
+
+        // 태스크 스케줄러 (EngineConfig::mTaskWorkerCount가 0이면 nullptr)
+        const TaskScheduler* GetTaskScheduler() const { return mTaskScheduler.get(); }
         
         // 상태 확인
         bool IsInitialized() const { return mInitialized; }
@@ -59,6 +116,20 @@ namespace KanchoNet
         // 설정 정보
         const EngineConfig& GetConfig() const { return mConfig; }
 
+        // 현재 부하 (이벤트 루프 지연/준비 큐 깊이 이동 평균, 송신 큐 바이트, 과부하 여부)
+        LoadSnapshot GetLoad() const { return mNetworkModel->GetLoad(); }
+
+        // 메트릭 스냅샷 (스레드별 카운터/히스토그램 합산, 수집하지 않으면 모두 0)
+        MetricsSnapshot GetMetricsSnapshot() const;
+
+        // 메트릭 엔드포인트에 어플리케이션 버퍼 풀 노출 (Initialize 이후, Start 이전에 호출)
+        // 반환값: 엔드포인트가 활성화되어 등록되었는지 여부
+        bool RegisterBufferPool(const std::string& name, const BufferPool* pool);
+
+        // 세션 버퍼 아레나 (EngineConfig::mBufferArenaSize가 0이거나 Initialize 전이면 nullptr)
+        // 어플리케이션 BufferPool에 넘겨 풀 저장소도 같은 아레나에 둘 수 있음
+        HugePageArena* GetBufferArena() const { return mSessionManager ? mSessionManager->GetArena() : nullptr; }
+
     protected:
         // 어플리케이션에서 오버라이드할 콜백 함수들
         virtual void OnAccept(Session* session) {}
@@ -66,6 +137,13 @@ namespace KanchoNet
         virtual void OnDisconnect(Session* session) {}
         virtual void OnError(Session* session, ErrorCode errorCode) {}
 
+        // Drain 시작 시 세션마다 한 번 호출 (세션 스트랜드에서 실행, 작별 패킷은 여기서 Send)
+        virtual void OnDrain(Session* /*session*/) {}
+
+        // 과부하 진입(load.mOverloaded == true)/회복 시 한 번씩 호출 (태스크 워커가 있으면 워커에서, 없으면 I/O 스레드에서 실행)
+        // 호출 전에 엔진이 이미 새 연결 수락을 멈추거나(진입) 다시 시작(회복)함. 어플리케이션 부하 차단은 여기서 처리
+        virtual void OnOverload(const LoadSnapshot& /*load*/) {}
+
     private:
         // private 함수
         // 내부 콜백 핸들러들
@@ -73,6 +151,15 @@ namespace KanchoNet
         void HandleReceive(Session* session, const uint8_t* data, size_t size);
         void HandleDisconnect(Session* session);
         void HandleError(Session* session, ErrorCode errorCode);
+
+        // 태스크 워커 없이 스트랜드 실행자 자격을 바로 얻었는지 (성공하면 콜백을 복사 없이 직접 실행한 뒤 RunStrand 호출)
+        bool TryRunInline(Session* session);
+
+        // 세션 스트랜드에 작업을 넣고, 유휴 상태였으면 실행 예약
+        void PostToStrand(Session* session, TaskFunction task);
+
+        // 예약된 스트랜드 실행 (워커에서는 배치 단위로 실행 후 남은 작업이 있으면 다시 예약, 그 외에는 빌 때까지 실행)
+        void RunStrand(Session* session);
     };
 
     // 템플릿 구현 (헤더에 포함)
@@ -80,6 +167,8 @@ namespace KanchoNet
     NetworkEngine<TNetworkModel>::NetworkEngine()
         : mInitialized(false)
         , mRunning(false)
+        , mDraining(false)
+        , mSessionManager(nullptr)
     {
         mNetworkModel = std::make_unique<TNetworkModel>();
     }
@@ -105,6 +194,13 @@ namespace KanchoNet
 
         mConfig = config;
 
+        // NUMA 노드를 지정하면 CPU 목록을 비워둔 스레드는 노드의 CPU 전체에 고정
+        mNodeCpus.clear();
+        if (mConfig.mNumaNode >= 0 && !CpuAffinity::GetNodeCpus(mConfig.mNumaNode, mNodeCpus))
+        {
+            LOG_WARNING("NUMA node %d not found. Threads are not pinned to it", mConfig.mNumaNode);
+        }
+
         // 네트워크 모델에 콜백 설정
         mNetworkModel->SetAcceptCallback([this](Session* session) {
             HandleAccept(session);
@@ -122,12 +218,50 @@ namespace KanchoNet
             HandleError(session, errorCode);
         });
 
-        // 네트워크 모델 초기화
-        if (!mNetworkModel->Initialize(mConfig))
+        mNetworkModel->SetOverloadCallback([this](const LoadSnapshot& load) {
+            Post([this, load]() { OnOverload(load); });
+        });
+
+        // 네트워크 모델 초기화 (초기화 중 할당하는 세션 관리자/버퍼 풀/링은 지정한 노드에 둠)
+        if (mConfig.mNumaNode >= 0)
+        {
+            CpuAffinity::SetPreferredNode(mConfig.mNumaNode);
+        }
+
+        const bool modelInitialized = mNetworkModel->Initialize(mConfig);
+
+        if (mConfig.mNumaNode >= 0)
+        {
+            CpuAffinity::SetPreferredNode(-1);
+        }
+
+        if (!modelInitialized)
         {
             return false;
         }
 
+        // 콜백은 세션 스트랜드를 거쳐 세션별로 직렬 실행 (세션 참조를 관리할 수 있는 모델만 지원)
+        mSessionManager = mNetworkModel->GetSessionManager();
+        if (mConfig.mTaskWorkerCount > 0)
+        {
+            if (!mSessionManager)
+            {
+                LOG_ERROR("Task workers are not supported by this network model");
+                mNetworkModel->Shutdown();
+                return false;
+            }
+
+            mTaskScheduler = std::make_unique<TaskScheduler>();
+            if (!mConfig.mTaskWorkerCpus.empty())
+            {
+                mTaskScheduler->SetPlacement(mConfig.mTaskWorkerCpus, true, mConfig.mNumaNode);
+            }
+            else
+            {
+                mTaskScheduler->SetPlacement(mNodeCpus, false, mConfig.mNumaNode);
+            }
+        }
+
         mInitialized = true;
         return true;
     }
@@ -140,8 +274,17 @@ namespace KanchoNet
             return false;
         }
 
+        if (mTaskScheduler && !mTaskScheduler->Start(mConfig.mTaskWorkerCount))
+        {
+            return false;
+        }
+
         if (!mNetworkModel->StartListen())
         {
+            if (mTaskScheduler)
+            {
+                mTaskScheduler->Stop();
+            }
             return false;
         }
 
@@ -158,6 +301,14 @@ namespace KanchoNet
         }
 
         mRunning = false;
+        mDraining = false;
+
+        // 세션을 정리하기 전에 대기 중인 콜백을 모두 실행하고 워커 종료
+        // (종료 중에 I/O 스레드가 넘기는 콜백은 해당 스레드에서 바로 실행됨)
+        if (mTaskScheduler)
+        {
+            mTaskScheduler->Stop();
+        }
         
         if (mNetworkModel)
         {
@@ -178,6 +329,143 @@ namespace KanchoNet
         return mNetworkModel->ProcessIO(timeoutMs);
     }
 
+    template<typename TNetworkModel>
+    bool NetworkEngine<TNetworkModel>::Drain(uint32_t timeoutMs)
+    {
+        if (!mRunning || mDraining.exchange(true))
+        {
+            return false;
+        }
+
+        if (!mNetworkModel->StopAccepting())
+        {
+            LOG_WARNING("Network model cannot stop accepting. New connections may arrive while draining");
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        bool drained = false;
+
+        if (mSessionManager)
+        {
+            LOG_INFO("Draining %zu sessions", mSessionManager->GetSessionCount());
+
+            // OnDrain을 마친 세션 (OnDrain이 넣은 작별 패킷까지 보낸 뒤에 송신 방향을 닫기 위함)
+            struct DrainState
+            {
+                std::mutex mMutex;
+                std::unordered_set<SessionID> mGreeted;
+            };
+            auto state = std::make_shared<DrainState>();
+
+            std::unordered_set<SessionID> notified;
+            std::unordered_set<SessionID> shutdown;
+            std::vector<Session*> sessions;
+
+            while (true)
+            {
+                if (mSessionManager->GetSessionCount() == 0)
+                {
+                    drained = true;
+                    break;
+                }
+
+                if (std::chrono::steady_clock::now() >= deadline)
+                {
+                    break;
+                }
+
+                // 세션 관리자 락을 잡은 채로 콜백을 실행하지 않도록 참조만 잡아 둠
+                sessions.clear();
+                mSessionManager->ForEachSession([&sessions](Session* session) {
+                    session->AddRef();
+                    sessions.push_back(session);
+                });
+
+                for (Session* session : sessions)
+                {
+                    const SessionID sessionID = session->GetID();
+
+                    if (notified.insert(sessionID).second)
+                    {
+                        Post(session, [this, session, sessionID, state]() {
+                            OnDrain(session);
+
+                            std::lock_guard<std::mutex> lock(state->mMutex);
+                            state->mGreeted.insert(sessionID);
+                        });
+                    }
+
+                    bool greeted;
+                    {
+                        std::lock_guard<std::mutex> lock(state->mMutex);
+                        greeted = state->mGreeted.count(sessionID) > 0;
+                    }
+
+                    if (greeted && shutdown.count(sessionID) == 0)
+                    {
+                        // 연결 종료 처리는 상태를 바꾼 뒤 소켓을 닫으므로, 락 안에서 연결 상태를 확인하면 닫힌(재사용될 수 있는) 소켓을 건드리지 않음
+                        SpinLockGuard lock(session->GetLock());
+                        const bool pending = session->IsSending() ||
+                                             !session->GetSendBuffer().IsEmpty() ||
+                                             !session->GetSendChain().IsEmpty();
+                        if (session->IsConnected() && !pending)
+                        {
+                            SocketUtils::ShutdownSend(session->GetSocket());
+                            shutdown.insert(sessionID);
+                        }
+                    }
+
+                    mSessionManager->ReleaseSession(session);
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        else
+        {
+            // 세션 참조를 관리하지 않는 모델은 클라이언트가 끊기를 기다리지 않고 종료
+            drained = true;
+        }
+
+        if (!drained)
+        {
+            LOG_WARNING("Drain timed out. %zu remaining sessions will be closed by Stop", mSessionManager->GetSessionCount());
+        }
+
+        // 모델 정리(Stop)는 ProcessIO를 호출 중인 스레드와 겹치면 안 되므로 호출자가 I/O 스레드를 멈춘 뒤 호출
+        return drained;
+    }
+
+    template<typename TNetworkModel>
+    bool NetworkEngine<TNetworkModel>::BindIOThread(uint32_t index)
+    {
+        bool result = true;
+
+        if (!mConfig.mIOThreadCpus.empty())
+        {
+            const uint32_t cpu = mConfig.mIOThreadCpus[index % mConfig.mIOThreadCpus.size()];
+            if (!CpuAffinity::PinCurrentThread({ cpu }))
+            {
+                LOG_WARNING("Failed to pin I/O thread %u to CPU %u", index, cpu);
+                result = false;
+            }
+        }
+        else if (!mNodeCpus.empty() && !CpuAffinity::PinCurrentThread(mNodeCpus))
+        {
+            LOG_WARNING("Failed to pin I/O thread %u to NUMA node %d", index, mConfig.mNumaNode);
+            result = false;
+        }
+
+        // 세션 슬롯과 버퍼는 처음 수락한 I/O 스레드가 만질 때 페이지가 할당되므로 스레드 메모리 정책으로 노드 지정
+        if (mConfig.mNumaNode >= 0 && !CpuAffinity::SetPreferredNode(mConfig.mNumaNode))
+        {
+            LOG_WARNING("Failed to set NUMA node %d for I/O thread %u", mConfig.mNumaNode, index);
+            result = false;
+        }
+
+        return result;
+    }
+
     template<typename TNetworkModel>
     bool NetworkEngine<TNetworkModel>::Send(Session* session, const PacketBuffer& buffer)
     {
@@ -201,6 +489,76 @@ namespace KanchoNet
         return mNetworkModel->Send(session, buffer);
     }
 
+    template<typename TNetworkModel>
+    template<typename TWriter>
+    bool NetworkEngine<TNetworkModel>::SendInPlace(Session* session, TWriter&& writer)
+    {
+        if (!mRunning || !session)
+        {
+            return false;
+        }
+
+        RingBuffer* buffer = mNetworkModel->BeginSend(session);
+        if (!buffer)
+        {
+            return false;
+        }
+
+        const size_t written = writer(*buffer);
+        mNetworkModel->EndSend(session, written);
+        return written > 0;
+    }
+
+    template<typename TNetworkModel>
+    bool NetworkEngine<TNetworkModel>::SendShared(Session* session, const SharedPacketBuffer& packet)
+    {
+        if (!mRunning || !session || !packet)
+        {
+            return false;
+        }
+
+        return mNetworkModel->SendShared(session, &packet, 1);
+    }
+
+    template<typename TNetworkModel>
+    bool NetworkEngine<TNetworkModel>::SendShared(Session* session, const SharedPacketBuffer& header, const SharedPacketBuffer& body)
+    {
+        if (!mRunning || !session || !header || !body)
+        {
+            return false;
+        }
+
+        // 헤더와 바디가 다른 송신 사이에 끼어들지 않도록 한 번에 큐잉
+        const SharedPacketBuffer packets[] = { header, body };
+        return mNetworkModel->SendShared(session, packets, 2);
+    }
+
+    template<typename TNetworkModel>
+    MetricsSnapshot NetworkEngine<TNetworkModel>::GetMetricsSnapshot() const
+    {
+        const NetworkMetrics* metrics = mNetworkModel ? mNetworkModel->GetMetrics() : nullptr;
+        if (!metrics)
+        {
+            return MetricsSnapshot();
+        }
+
+        return metrics->GetSnapshot();
+    }
+
+    template<typename TNetworkModel>
+    bool NetworkEngine<TNetworkModel>::RegisterBufferPool(const std::string& name, const BufferPool* pool)
+    {
+    #ifdef KANCHONET_PLATFORM_LINUX
+        MetricsHttpServer* server = mNetworkModel ? mNetworkModel->GetMetricsServer() : nullptr;
+        if (server && !mRunning)
+        {
+            server->AddBufferPool(name, pool);
+            return true;
+        }
+    #endif
+        return false;
+    }
+
     template<typename TNetworkModel>
     Session* NetworkEngine<TNetworkModel>::GetSession(SessionID sessionID)
     {
@@ -219,28 +577,171 @@ namespace KanchoNet
         // 현재 구조에서는 구현 제한
     }
 
+    template<typename TNetworkModel>
+    bool NetworkEngine<TNetworkModel>::Post(Session* session, TaskFunction task)
+    {
+        if (!session || !task)
+        {
+            return false;
+        }
+
+        if (!mSessionManager)
+        {
+            task();
+            return true;
+        }
+
+        if (TryRunInline(session))
+        {
+            task();
+            RunStrand(session);
+            return true;
+        }
+
+        PostToStrand(session, std::move(task));
+        return true;
+    }
+
+    template<typename TNetworkModel>
+    bool NetworkEngine<TNetworkModel>::Post(TaskFunction task)
+    {
+        if (!task)
+        {
+            return false;
+        }
+
+        if (!mTaskScheduler || !mTaskScheduler->Submit(task))
+        {
+            task();
+        }
+        return true;
+    }
+
     template<typename TNetworkModel>
     void NetworkEngine<TNetworkModel>::HandleAccept(Session* session)
     {
-        OnAccept(session);
+        if (!mSessionManager)
+        {
+            OnAccept(session);
+            return;
+        }
+
+        if (TryRunInline(session))
+        {
+            OnAccept(session);
+            RunStrand(session);
+            return;
+        }
+
+        PostToStrand(session, [this, session]() { OnAccept(session); });
     }
 
     template<typename TNetworkModel>
     void NetworkEngine<TNetworkModel>::HandleReceive(Session* session, const uint8_t* data, size_t size)
     {
-        OnReceive(session, data, size);
+        if (!mSessionManager)
+        {
+            OnReceive(session, data, size);
+            return;
+        }
+
+        // 다른 스레드가 이 세션의 콜백을 실행 중이 아니면 복사 없이 바로 실행
+        if (TryRunInline(session))
+        {
+            OnReceive(session, data, size);
+            RunStrand(session);
+            return;
+        }
+
+        // 수신 버퍼는 콜백이 끝나면 재사용되므로 복사해서 넘김
+        PostToStrand(session, [this, session, packet = PacketBuffer(data, size)]() {
+            OnReceive(session, packet.GetData(), packet.GetSize());
+        });
     }
 
     template<typename TNetworkModel>
     void NetworkEngine<TNetworkModel>::HandleDisconnect(Session* session)
     {
-        OnDisconnect(session);
+        if (!mSessionManager)
+        {
+            OnDisconnect(session);
+            return;
+        }
+
+        if (TryRunInline(session))
+        {
+            OnDisconnect(session);
+            RunStrand(session);
+            return;
+        }
+
+        // 앞서 넘긴 수신 콜백이 모두 실행된 뒤 호출됨
+        PostToStrand(session, [this, session]() { OnDisconnect(session); });
     }
 
     template<typename TNetworkModel>
     void NetworkEngine<TNetworkModel>::HandleError(Session* session, ErrorCode errorCode)
     {
-        OnError(session, errorCode);
+        if (!mSessionManager || !session)
+        {
+            OnError(session, errorCode);
+            return;
+        }
+
+        if (TryRunInline(session))
+        {
+            OnError(session, errorCode);
+            RunStrand(session);
+            return;
+        }
+
+        PostToStrand(session, [this, session, errorCode]() { OnError(session, errorCode); });
+    }
+
+    template<typename TNetworkModel>
+    bool NetworkEngine<TNetworkModel>::TryRunInline(Session* session)
+    {
+        // 태스크 워커가 있으면 콜백은 항상 워커에서 실행
+        if (mTaskScheduler || !session->GetStrand().TryAcquire())
+        {
+            return false;
+        }
+
+        // 실행 중 다른 스레드가 세션을 제거해도 슬롯이 재사용되지 않도록 참조 유지 (RunStrand가 유휴 전환 시 반환)
+        session->AddRef();
+        return true;
+    }
+
+    template<typename TNetworkModel>
+    void NetworkEngine<TNetworkModel>::PostToStrand(Session* session, TaskFunction task)
+    {
+        if (session->GetStrand().Push(new Task(std::move(task))))
+        {
+            // 실행이 예약된 동안 세션 슬롯이 재사용되지 않도록 참조 유지 (RunStrand가 유휴 전환 시 반환)
+            session->AddRef();
+
+            // 태스크 워커가 없거나 종료 중이면 호출 스레드에서 실행
+            if (!mTaskScheduler || !mTaskScheduler->Submit([this, session]() { RunStrand(session); }))
+            {
+                RunStrand(session);
+            }
+        }
+    }
+
+    template<typename TNetworkModel>
+    void NetworkEngine<TNetworkModel>::RunStrand(Session* session)
+    {
+        // 한 세션이 워커를 오래 점유하지 않도록 배치 단위로 실행하고 남은 작업은 다시 예약
+        // (I/O 스레드에서 실행 중이면 다른 스레드가 넘긴 작업까지 빌 때까지 실행)
+        while (session->GetStrand().Run(mConfig.mStrandBatchSize))
+        {
+            if (mTaskScheduler && mTaskScheduler->Submit([this, session]() { RunStrand(session); }))
+            {
+                return;
+            }
+        }
+
+        mSessionManager->ReleaseSession(session);
     }
 
 } // namespace KanchoNet
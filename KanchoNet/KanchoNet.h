@@ -20,23 +20,52 @@
     #include "Network/RIOModel.h"
 #elif defined(KANCHONET_PLATFORM_LINUX)
     #include "Network/EpollModel.h"
-    #include "Network/IOUringModel.h"
+    #ifdef KANCHONET_HAS_LIBURING
+        #include "Network/IOUringModel.h"
+    #endif
+    #include "Network/ListenerHandoff.h"
 #endif
 
 // 세션 관리
 #include "Session/Session.h"
 #include "Session/SessionManager.h"
 #include "Session/SessionConfig.h"
+#include "Session/SessionPool.h"
 
 // 버퍼 관리
 #include "Buffer/PacketBuffer.h"
 #include "Buffer/RingBuffer.h"
 #include "Buffer/BufferPool.h"
+#include "Buffer/SendChain.h"
+#include "Buffer/HugePageArena.h"
+
+// 메트릭
+#include "Metrics/LatencyHistogram.h"
+#include "Metrics/NetworkMetrics.h"
+#include "Metrics/MetricsHttpServer.h"
+#include "Metrics/LoadMonitor.h"
+
+// 프로토콜
+#include "Protocol/PacketDispatcher.h"
+#include "Protocol/PacketWriter.h"
+#include "Protocol/PacketReader.h"
+#include "Protocol/Lz4Codec.h"
+#include "Protocol/PacketCompressor.h"
+#include "Protocol/ProtobufCodec.h"
+
+// 태스크 (작업 훔치기 스케줄러, 스트랜드)
+#include "Task/Task.h"
+#include "Task/WorkStealingDeque.h"
+#include "Task/Strand.h"
+#include "Task/TaskScheduler.h"
 
 // 유틸리티
 #include "Utils/NonCopyable.h"
 #include "Utils/SpinLock.h"
+#include "Utils/LogQueue.h"
 #include "Utils/Logger.h"
+#include "Utils/CpuAffinity.h"
+#include "Utils/RateLimiter.h"
 
 // 네임스페이스 사용 예제:
 // using namespace KanchoNet;
@@ -0,0 +1,122 @@
+#include "LatencyHistogram.h"
+#include <limits>
+#include <algorithm>
+
+namespace KanchoNet
+{
+    uint64_t HistogramBuckets::GetLowerBound(uint32_t index)
+    {
+        if (index < SUB_BUCKET_COUNT)
+        {
+            return index;
+        }
+
+        uint32_t shift = index / SUB_BUCKET_COUNT - 1;
+        uint64_t subBucket = index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+        return subBucket << shift;
+    }
+
+    uint64_t HistogramBuckets::GetUpperBound(uint32_t index)
+    {
+        if (index < SUB_BUCKET_COUNT)
+        {
+            return index;
+        }
+
+        // 마지막 버킷은 범위를 넘는 값까지 포함
+        if (index >= BUCKET_COUNT - 1)
+        {
+            return (std::numeric_limits<uint64_t>::max)();
+        }
+
+        uint32_t shift = index / SUB_BUCKET_COUNT - 1;
+        uint64_t subBucket = index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+        return ((subBucket + 1) << shift) - 1;
+    }
+
+    HistogramSnapshot::HistogramSnapshot()
+        : mCount(0)
+        , mSum(0)
+        , mMin((std::numeric_limits<uint64_t>::max)())
+        , mMax(0)
+    {
+        mBuckets.fill(0);
+    }
+
+    void HistogramSnapshot::Merge(const HistogramSnapshot& other)
+    {
+        for (uint32_t i = 0; i < HistogramBuckets::BUCKET_COUNT; ++i)
+        {
+            mBuckets[i] += other.mBuckets[i];
+        }
+
+        mCount += other.mCount;
+        mSum += other.mSum;
+        mMin = (std::min)(mMin, other.mMin);
+        mMax = (std::max)(mMax, other.mMax);
+    }
+
+    uint64_t HistogramSnapshot::GetValueAtPercentile(double percentile) const
+    {
+        if (mCount == 0)
+        {
+            return 0;
+        }
+
+        if (percentile <= 0.0)
+        {
+            return GetMin();
+        }
+
+        // 목표 순위 (1부터 시작)
+        uint64_t target = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(mCount) + 0.5);
+        if (target == 0)
+        {
+            target = 1;
+        }
+
+        uint64_t cumulative = 0;
+        for (uint32_t i = 0; i < HistogramBuckets::BUCKET_COUNT; ++i)
+        {
+            cumulative += mBuckets[i];
+            if (cumulative >= target)
+            {
+                // 버킷 상한이 실제 최대값보다 크면 최대값으로 제한
+                return (std::min)(HistogramBuckets::GetUpperBound(i), mMax);
+            }
+        }
+
+        return mMax;
+    }
+
+    LatencyHistogram::LatencyHistogram()
+        : mCount(0)
+        , mSum(0)
+        , mMin((std::numeric_limits<uint64_t>::max)())
+        , mMax(0)
+    {
+        for (auto& bucket : mBuckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void LatencyHistogram::CopyTo(HistogramSnapshot& snapshot) const
+    {
+        // 기록 중인 값과 약간 어긋날 수 있음 (모니터링 용도로 허용)
+        HistogramSnapshot local;
+        for (uint32_t i = 0; i < HistogramBuckets::BUCKET_COUNT; ++i)
+        {
+            local.mBuckets[i] = mBuckets[i].load(std::memory_order_relaxed);
+        }
+
+        local.mCount = mCount.load(std::memory_order_relaxed);
+        local.mSum = mSum.load(std::memory_order_relaxed);
+        local.mMin = mMin.load(std::memory_order_relaxed);
+        local.mMax = mMax.load(std::memory_order_relaxed);
+
+        snapshot.Merge(local);
+    }
+
+} // namespace KanchoNet
+
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "../Types.h"
+#include <atomic>
+#include <array>
+
+#if defined(KANCHONET_COMPILER_MSVC)
+    #include <intrin.h>
+#endif
+
+namespace KanchoNet
+{
+    // 로그-선형(HDR 방식) 지연 시간 히스토그램의 버킷 규칙
+    // 2의 거듭제곱 구간마다 16개의 선형 하위 버킷 → 상대 오차 약 6% 이내
+    // 값 단위는 나노초, 최대 약 68초(2^36ns)까지 구분하며 그 이상은 마지막 버킷에 합산
+    struct HistogramBuckets
+    {
+        static constexpr uint32_t SUB_BUCKET_BITS = 4;
+        static constexpr uint32_t SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;     // 16
+        static constexpr uint32_t MAX_VALUE_BITS = 36;
+        static constexpr uint32_t BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+        // 값 → 버킷 인덱스
+        static uint32_t GetIndex(uint64_t value);
+
+        // 버킷이 나타내는 값 범위 [하한, 상한]
+        static uint64_t GetLowerBound(uint32_t index);
+        static uint64_t GetUpperBound(uint32_t index);
+    };
+
+    // 히스토그램 읽기 전용 사본 (여러 스레드의 히스토그램을 합산해 조회할 때 사용)
+    class HistogramSnapshot
+    {
+    public:
+        // public 멤버변수 (없음)
+
+    private:
+        // private 멤버변수
+        std::array<uint64_t, HistogramBuckets::BUCKET_COUNT> mBuckets;
+        uint64_t mCount;
+        uint64_t mSum;
+        uint64_t mMin;
+        uint64_t mMax;
+
+    public:
+        // 생성자, 파괴자
+        HistogramSnapshot();
+
+    public:
+        // public 함수
+        // 다른 스냅샷 합산
+        void Merge(const HistogramSnapshot& other);
+
+        // 통계
+        uint64_t GetCount() const { return mCount; }
+        uint64_t GetSum() const { return mSum; }
+        uint64_t GetMin() const { return mCount > 0 ? mMin : 0; }
+        uint64_t GetMax() const { return mMax; }
+        double GetMean() const { return mCount > 0 ? static_cast<double>(mSum) / mCount : 0.0; }
+
+        // 백분위 값 (percentile: 0 ~ 100, 해당 버킷의 상한을 반환)
+        uint64_t GetValueAtPercentile(double percentile) const;
+
+        // 버킷 접근 (노출/직렬화용)
+        uint64_t GetBucketCount(uint32_t index) const { return mBuckets[index]; }
+
+    private:
+        friend class LatencyHistogram;
+    };
+
+    // 지연 시간 히스토그램 (단일 기록 스레드, 다중 읽기 스레드)
+    // 기록은 락 없는 relaxed load/store만 사용하므로 한 스레드만 Record를 호출해야 함
+    // 여러 스레드가 공유하는 경우 shared = true로 원자적 증가를 사용
+    class LatencyHistogram
+    {
+    public:
+        // public 멤버변수 (없음)
+
+    private:
+        // private 멤버변수
+        std::array<std::atomic<uint64_t>, HistogramBuckets::BUCKET_COUNT> mBuckets;
+        std::atomic<uint64_t> mCount;
+        std::atomic<uint64_t> mSum;
+        std::atomic<uint64_t> mMin;
+        std::atomic<uint64_t> mMax;
+
+    public:
+        // 생성자, 파괴자
+        LatencyHistogram();
+
+        // 복사/이동 불가
+        LatencyHistogram(const LatencyHistogram&) = delete;
+        LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    public:
+        // public 함수
+        // 값 기록 (나노초)
+        void Record(uint64_t value, bool shared = false)
+        {
+            Increment(mBuckets[HistogramBuckets::GetIndex(value)], 1, shared);
+            Increment(mCount, 1, shared);
+            Increment(mSum, value, shared);
+
+            if (value < mMin.load(std::memory_order_relaxed))
+            {
+                mMin.store(value, std::memory_order_relaxed);
+            }
+            if (value > mMax.load(std::memory_order_relaxed))
+            {
+                mMax.store(value, std::memory_order_relaxed);
+            }
+        }
+
+        // 현재 값을 스냅샷에 합산
+        void CopyTo(HistogramSnapshot& snapshot) const;
+
+    private:
+        // private 함수
+        static void Increment(std::atomic<uint64_t>& target, uint64_t value, bool shared)
+        {
+            if (shared)
+            {
+                target.fetch_add(value, std::memory_order_relaxed);
+            }
+            else
+            {
+                // 단일 기록자: lock 접두사 명령 없이 갱신
+                target.store(target.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    // 인라인 구현
+    inline uint32_t HistogramBuckets::GetIndex(uint64_t value)
+    {
+        if (value < SUB_BUCKET_COUNT)
+        {
+            return static_cast<uint32_t>(value);
+        }
+
+        // 최상위 비트 위치
+        uint32_t msb = 63;
+        #if defined(KANCHONET_COMPILER_MSVC)
+            unsigned long index;
+            _BitScanReverse64(&index, value);
+            msb = static_cast<uint32_t>(index);
+        #else
+            msb = 63 - static_cast<uint32_t>(__builtin_clzll(value));
+        #endif
+
+        if (msb >= MAX_VALUE_BITS)
+        {
+            return BUCKET_COUNT - 1;
+        }
+
+        // 상위 SUB_BUCKET_BITS+1 비트로 구간(shift)과 하위 버킷 결정
+        uint32_t shift = msb - SUB_BUCKET_BITS;
+        uint32_t subBucket = static_cast<uint32_t>(value >> shift) - SUB_BUCKET_COUNT;
+        return (shift + 1) * SUB_BUCKET_COUNT + subBucket;
+    }
+
+} // namespace KanchoNet
+
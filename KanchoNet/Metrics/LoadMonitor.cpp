@@ -0,0 +1,109 @@
+#include "LoadMonitor.h"
+
+namespace KanchoNet
+{
+    LoadMonitor::LoadMonitor()
+        : mLagLimit(0)
+        , mDepthLimit(0)
+        , mBacklogLimit(0)
+        , mHoldTime(0)
+        , mRecoverPercent(100)
+        , mOverloaded(false)
+        , mChangedTime(0)
+        , mLoopLag(0)
+        , mReadyDepth(0)
+        , mSendBacklog(0)
+    {
+    }
+
+    void LoadMonitor::Configure(uint32_t loopLagUs, uint32_t readyDepth, uint64_t sendBacklogBytes,
+                                uint32_t recoverPercent, uint32_t holdMs)
+    {
+        mLagLimit = static_cast<int64_t>(loopLagUs) * 1000;
+        mDepthLimit = static_cast<int64_t>(readyDepth) * DEPTH_SCALE;
+        mBacklogLimit = static_cast<int64_t>(sendBacklogBytes);
+        mRecoverPercent = recoverPercent;
+        mHoldTime = static_cast<int64_t>(holdMs) * 1000000;
+
+        mOverloaded.store(false, std::memory_order_relaxed);
+        mChangedTime.store(0, std::memory_order_relaxed);
+        mLoopLag.store(0, std::memory_order_relaxed);
+        mReadyDepth.store(0, std::memory_order_relaxed);
+        mSendBacklog.store(0, std::memory_order_relaxed);
+    }
+
+    bool LoadMonitor::RecordCycle(int64_t loopLagNs, uint32_t readyDepth, int64_t now, LoadSnapshot& snapshot)
+    {
+        // 이동 평균 갱신 (avg += (sample - avg) / 8)
+        int64_t loopLag = mLoopLag.load(std::memory_order_relaxed);
+        loopLag += (loopLagNs - loopLag) >> EWMA_SHIFT;
+        mLoopLag.store(loopLag, std::memory_order_relaxed);
+
+        int64_t depth = mReadyDepth.load(std::memory_order_relaxed);
+        depth += (static_cast<int64_t>(readyDepth) * DEPTH_SCALE - depth) >> EWMA_SHIFT;
+        mReadyDepth.store(depth, std::memory_order_relaxed);
+
+        const int64_t backlog = mSendBacklog.load(std::memory_order_relaxed);
+
+        bool overloaded = mOverloaded.load(std::memory_order_relaxed);
+        if (!overloaded)
+        {
+            const uint32_t reasons = GetReasons(loopLag, depth, backlog, 100);
+            if (reasons == 0 || !mOverloaded.compare_exchange_strong(overloaded, true, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            snapshot.mReasons = reasons;
+        }
+        else
+        {
+            if (now - mChangedTime.load(std::memory_order_relaxed) < mHoldTime ||
+                GetReasons(loopLag, depth, backlog, mRecoverPercent) != 0 ||
+                !mOverloaded.compare_exchange_strong(overloaded, false, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            snapshot.mReasons = 0;
+        }
+
+        mChangedTime.store(now, std::memory_order_relaxed);
+        snapshot.mOverloaded = !overloaded;
+        snapshot.mLoopLagNs = loopLag;
+        snapshot.mReadyDepth = static_cast<uint32_t>(depth / DEPTH_SCALE);
+        snapshot.mSendBacklogBytes = backlog;
+        return true;
+    }
+
+    LoadSnapshot LoadMonitor::GetSnapshot() const
+    {
+        LoadSnapshot snapshot;
+        snapshot.mOverloaded = mOverloaded.load(std::memory_order_relaxed);
+        snapshot.mLoopLagNs = mLoopLag.load(std::memory_order_relaxed);
+        snapshot.mReadyDepth = static_cast<uint32_t>(mReadyDepth.load(std::memory_order_relaxed) / DEPTH_SCALE);
+        snapshot.mSendBacklogBytes = mSendBacklog.load(std::memory_order_relaxed);
+        snapshot.mReasons = GetReasons(snapshot.mLoopLagNs, mReadyDepth.load(std::memory_order_relaxed),
+                                       snapshot.mSendBacklogBytes, 100);
+        return snapshot;
+    }
+
+    uint32_t LoadMonitor::GetReasons(int64_t loopLag, int64_t readyDepth, int64_t sendBacklog, uint32_t percent) const
+    {
+        uint32_t reasons = 0;
+        if (mLagLimit != 0 && loopLag * 100 > mLagLimit * percent)
+        {
+            reasons |= LoadSnapshot::REASON_LOOP_LAG;
+        }
+        if (mDepthLimit != 0 && readyDepth * 100 > mDepthLimit * percent)
+        {
+            reasons |= LoadSnapshot::REASON_READY_DEPTH;
+        }
+        if (mBacklogLimit != 0 && sendBacklog * 100 > mBacklogLimit * static_cast<int64_t>(percent))
+        {
+            reasons |= LoadSnapshot::REASON_SEND_BACKLOG;
+        }
+        return reasons;
+    }
+
+} // namespace KanchoNet
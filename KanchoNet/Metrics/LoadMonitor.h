@@ -0,0 +1,91 @@
+#pragma once
+
+#include "../Types.h"
+#include "../Utils/NonCopyable.h"
+#include <atomic>
+
+namespace KanchoNet
+{
+    // 부하 상태 (OnOverload 콜백과 GetLoad로 전달)
+    struct LoadSnapshot
+    {
+        // 한도를 넘은 항목 (mReasons 비트)
+        static constexpr uint32_t REASON_LOOP_LAG = 1 << 0;
+        static constexpr uint32_t REASON_READY_DEPTH = 1 << 1;
+        static constexpr uint32_t REASON_SEND_BACKLOG = 1 << 2;
+
+        bool mOverloaded = false;
+        uint32_t mReasons = 0;              // 한도를 넘은 항목 (REASON_* 조합)
+        int64_t mLoopLagNs = 0;             // 이벤트 루프 지연 이동 평균 (ns)
+        uint32_t mReadyDepth = 0;           // 준비 큐 깊이 이동 평균
+        int64_t mSendBacklogBytes = 0;      // 전체 세션 송신 큐에 쌓인 바이트
+    };
+
+    // 이벤트 루프 과부하 감지
+    // ProcessIO 회차마다 "깨어난 뒤 처리를 마칠 때까지 걸린 시간"(마지막 이벤트가 기다린 시간)과
+    // 그 회차의 준비 큐 깊이를 이동 평균(표본 가중치 1/8)으로 모으고, 송신 큐에 쌓인 전체 바이트와 함께 한도와 비교
+    // 한 항목이라도 한도를 넘으면 과부하로 바꾸고, 최소 유지 시간이 지난 뒤 모든 항목이 회복 비율 아래로 내려가면 회복 (짧게 오가지 않도록)
+    // 여러 I/O 스레드에서 호출 가능 (이동 평균은 relaxed load/store라 경합 시 표본 하나가 빠질 수 있으나 평균에는 영향이 작음)
+    class LoadMonitor : public NonCopyable
+    {
+    public:
+        // public 멤버변수
+        static constexpr uint32_t SHED_RECHECK_MS = 100;    // 과부하 제한으로 읽기를 멈춘 세션을 다시 확인하는 간격
+
+    private:
+        // private 멤버변수
+        static constexpr int EWMA_SHIFT = 3;                // 새 표본 가중치 1/8
+        static constexpr int64_t DEPTH_SCALE = 256;         // 준비 큐 깊이 이동 평균의 고정소수점 배율
+
+        // 설정과 상태 (거의 읽기만 함, 수신 경로가 IsOverloaded로 확인)
+        int64_t mLagLimit;                  // ns (0 = 사용 안 함)
+        int64_t mDepthLimit;                // DEPTH_SCALE배 (0 = 사용 안 함)
+        int64_t mBacklogLimit;              // 바이트 (0 = 사용 안 함)
+        int64_t mHoldTime;                  // 과부하 최소 유지 시간 (ns)
+        uint32_t mRecoverPercent;           // 회복 기준 (한도 대비 %)
+        std::atomic<bool> mOverloaded;
+        std::atomic<int64_t> mChangedTime;  // 마지막으로 상태가 바뀐 시각 (ns)
+
+        // I/O 스레드가 회차마다 갱신
+        alignas(CACHE_LINE_SIZE) std::atomic<int64_t> mLoopLag;
+        std::atomic<int64_t> mReadyDepth;   // DEPTH_SCALE배
+
+        // 송신 스레드가 갱신
+        alignas(CACHE_LINE_SIZE) std::atomic<int64_t> mSendBacklog;
+
+    public:
+        // 생성자, 파괴자
+        LoadMonitor();
+        ~LoadMonitor() = default;
+
+    public:
+        // public 함수
+        // 한도 설정 (0인 항목은 평가하지 않음, 호출 중인 스레드가 없을 때 설정)
+        void Configure(uint32_t loopLagUs, uint32_t readyDepth, uint64_t sendBacklogBytes,
+                       uint32_t recoverPercent, uint32_t holdMs);
+
+        bool IsEnabled() const { return mLagLimit != 0 || mDepthLimit != 0 || mBacklogLimit != 0; }
+        bool IsOverloaded() const { return mOverloaded.load(std::memory_order_relaxed); }
+
+        // 송신 큐 바이트 증감 (큐잉 +, 전송/종료 시 버린 만큼 -, 송신 한도를 쓸 때만 집계)
+        void AddSendBacklog(int64_t bytes)
+        {
+            if (mBacklogLimit != 0)
+            {
+                mSendBacklog.fetch_add(bytes, std::memory_order_relaxed);
+            }
+        }
+
+        // ProcessIO 한 회차 기록 후 상태 평가
+        // 반환값: 이 호출에서 과부하 진입/회복이 일어났는지 (true면 snapshot에 바뀐 상태, 여러 스레드 중 한 스레드만 받음)
+        bool RecordCycle(int64_t loopLagNs, uint32_t readyDepth, int64_t now, LoadSnapshot& snapshot);
+
+        LoadSnapshot GetSnapshot() const;
+
+    private:
+        // private 함수
+        // 한도의 percent% 기준으로 넘은 항목
+        uint32_t GetReasons(int64_t loopLag, int64_t readyDepth, int64_t sendBacklog, uint32_t percent) const;
+    };
+
+} // namespace KanchoNet
@@ -0,0 +1,535 @@
+#include "MetricsHttpServer.h"
+
+#ifdef KANCHONET_PLATFORM_LINUX
+
+#include "../Network/SocketUtils.h"
+#include "../Session/SessionManager.h"
+#include "../Utils/Logger.h"
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+namespace KanchoNet
+{
+    // Prometheus summary로 노출할 백분위
+    static const struct
+    {
+        double mPercentile;
+        const char* mQuantileLabel;
+        const char* mJsonKey;
+    } sQuantiles[] = {
+        { 50.0, "0.5", "p50" },
+        { 90.0, "0.9", "p90" },
+        { 99.0, "0.99", "p99" },
+        { 99.9, "0.999", "p999" },
+    };
+
+    // 포맷 문자열을 버퍼 끝에 이어 쓰기 (한 줄 단위로 호출)
+    static void AppendFormat(PacketBuffer& out, const char* format, ...)
+    {
+        char line[256];
+
+        va_list args;
+        va_start(args, format);
+        int length = vsnprintf(line, sizeof(line), format, args);
+        va_end(args);
+
+        if (length > 0)
+        {
+            out.Append(line, (static_cast<size_t>(length) < sizeof(line)) ? static_cast<size_t>(length) : sizeof(line) - 1);
+        }
+    }
+
+    // 라벨/JSON 문자열에 넣을 수 없는 문자는 '_'로 치환
+    static std::string SanitizeName(const std::string& name)
+    {
+        std::string result(name);
+        for (char& c : result)
+        {
+            if (c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20)
+            {
+                c = '_';
+            }
+        }
+        return result;
+    }
+
+    MetricsHttpServer::MetricsHttpServer()
+        : mListenSocket(INVALID_SOCKET_HANDLE)
+        , mModelName("unknown")
+        , mMetrics(nullptr)
+        , mSessionManager(nullptr)
+        , mResponsePool(RESPONSE_BUFFER_SIZE, 2)
+        , mScrapeCount(0)
+    {
+        // 응답 버퍼 풀도 노출 대상
+        mBufferPools.push_back({ "metrics_response", &mResponsePool });
+    }
+
+    MetricsHttpServer::~MetricsHttpServer()
+    {
+        Close();
+    }
+
+    bool MetricsHttpServer::Open(const std::string& address, uint16_t port, int backlog)
+    {
+        if (IsOpen())
+        {
+            LOG_WARNING("MetricsHttpServer already open");
+            return true;
+        }
+
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        if (inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1)
+        {
+            LOG_ERROR("Invalid metrics bind address: %s", address.c_str());
+            return false;
+        }
+
+        SocketHandle listenSocket = SocketUtils::CreateTCPSocket();
+        if (listenSocket == INVALID_SOCKET_HANDLE)
+        {
+            return false;
+        }
+
+        SocketUtils::SetReuseAddress(listenSocket, true);
+        SocketUtils::SetNonBlocking(listenSocket, true);
+
+        if (bind(listenSocket, (sockaddr*)&addr, sizeof(addr)) < 0)
+        {
+            LOG_ERROR("Metrics bind failed. %s:%u, Error: %d",
+                     address.c_str(), port, SocketUtils::GetLastSocketError());
+            SocketUtils::CloseSocket(listenSocket);
+            return false;
+        }
+
+        if (!SocketUtils::ListenSocket(listenSocket, backlog))
+        {
+            SocketUtils::CloseSocket(listenSocket);
+            return false;
+        }
+
+        mListenSocket = listenSocket;
+        LOG_INFO("Metrics endpoint listening on http://%s:%u/metrics", address.c_str(), port);
+        return true;
+    }
+
+    void MetricsHttpServer::Close()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        for (auto& entry : mConnections)
+        {
+            SocketUtils::CloseSocket(entry.first);
+            mResponsePool.Deallocate(std::move(entry.second->mResponse));
+        }
+        mConnections.clear();
+
+        if (mListenSocket != INVALID_SOCKET_HANDLE)
+        {
+            SocketUtils::CloseSocket(mListenSocket);
+            mListenSocket = INVALID_SOCKET_HANDLE;
+        }
+    }
+
+    void MetricsHttpServer::SetSources(const char* modelName, const NetworkMetrics* metrics,
+                                       const SessionManager* sessionManager)
+    {
+        mModelName = modelName ? modelName : "unknown";
+        mMetrics = metrics;
+        mSessionManager = sessionManager;
+    }
+
+    void MetricsHttpServer::AddBufferPool(const std::string& name, const BufferPool* pool)
+    {
+        if (pool)
+        {
+            mBufferPools.push_back({ SanitizeName(name), pool });
+        }
+    }
+
+    SocketHandle MetricsHttpServer::Accept()
+    {
+        while (true)
+        {
+            SocketHandle socket = accept4(mListenSocket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (socket < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                if (errno != EAGAIN && errno != EWOULDBLOCK)
+                {
+                    LOG_ERROR("Metrics accept failed. Error: %d", SocketUtils::GetLastSocketError());
+                }
+                return INVALID_SOCKET_HANDLE;
+            }
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mConnections.size() >= MAX_CONNECTIONS)
+            {
+                // 스크레이프 연결이 너무 많음: 대기열을 비우기 위해 계속 수락 후 닫음
+                LOG_WARNING("Metrics connection limit reached. Closing new connection.");
+                SocketUtils::CloseSocket(socket);
+                continue;
+            }
+
+            mConnections.emplace(socket, std::make_unique<Connection>());
+            return socket;
+        }
+    }
+
+    uint32_t MetricsHttpServer::HandleEvent(SocketHandle socket, uint32_t events)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto it = mConnections.find(socket);
+        if (it == mConnections.end())
+        {
+            return 0;
+        }
+
+        Connection& connection = *it->second;
+        if (events & EVENT_ERROR)
+        {
+            CloseConnection(socket);
+            return 0;
+        }
+
+        // 요청을 모두 받기 전에는 수신, 응답이 준비되면 바로 송신 시도
+        uint32_t next = EVENT_WRITE;
+        if (!connection.mResponse)
+        {
+            next = ReceiveRequest(connection, socket);
+        }
+
+        if (next == EVENT_WRITE)
+        {
+            next = SendResponse(connection, socket);
+        }
+
+        if (next == 0)
+        {
+            CloseConnection(socket);
+        }
+
+        return next;
+    }
+
+    void MetricsHttpServer::RenderPrometheus(PacketBuffer& out) const
+    {
+        AppendFormat(out, "# TYPE kanchonet_engine_info gauge\n");
+        AppendFormat(out, "kanchonet_engine_info{model=\"%s\"} 1\n", mModelName.c_str());
+
+        if (mMetrics)
+        {
+            MetricsSnapshot snapshot = mMetrics->GetSnapshot();
+
+            for (size_t i = 0; i < METRIC_COUNTER_COUNT; ++i)
+            {
+                const char* name = NetworkMetrics::GetName(static_cast<MetricCounter>(i));
+                AppendFormat(out, "# TYPE kanchonet_%s_total counter\n", name);
+                AppendFormat(out, "kanchonet_%s_total %llu\n", name,
+                             static_cast<unsigned long long>(snapshot.mCounters[i]));
+            }
+
+            for (size_t i = 0; i < METRIC_HISTOGRAM_COUNT; ++i)
+            {
+                const char* name = NetworkMetrics::GetName(static_cast<MetricHistogram>(i));
+                const HistogramSnapshot& histogram = snapshot.mHistograms[i];
+
+                AppendFormat(out, "# TYPE kanchonet_%s summary\n", name);
+                for (const auto& quantile : sQuantiles)
+                {
+                    AppendFormat(out, "kanchonet_%s{quantile=\"%s\"} %llu\n", name, quantile.mQuantileLabel,
+                                 static_cast<unsigned long long>(histogram.GetValueAtPercentile(quantile.mPercentile)));
+                }
+                AppendFormat(out, "kanchonet_%s_sum %llu\n", name, static_cast<unsigned long long>(histogram.GetSum()));
+                AppendFormat(out, "kanchonet_%s_count %llu\n", name, static_cast<unsigned long long>(histogram.GetCount()));
+            }
+        }
+
+        if (mSessionManager)
+        {
+            AppendFormat(out, "# TYPE kanchonet_sessions_active gauge\n");
+            AppendFormat(out, "kanchonet_sessions_active %zu\n", mSessionManager->GetSessionCount());
+            AppendFormat(out, "# TYPE kanchonet_sessions_max gauge\n");
+            AppendFormat(out, "kanchonet_sessions_max %zu\n", mSessionManager->GetMaxSessions());
+        }
+
+        const HugePageArena* arena = mSessionManager ? mSessionManager->GetArena() : nullptr;
+        if (arena)
+        {
+            ArenaStats stats = arena->GetStats();
+            AppendFormat(out, "# TYPE kanchonet_arena_capacity_bytes gauge\n");
+            AppendFormat(out, "kanchonet_arena_capacity_bytes{pages=\"%s\"} %zu\n",
+                         HugePageArena::GetPageModeName(stats.mPageMode), stats.mCapacity);
+            AppendFormat(out, "# TYPE kanchonet_arena_used_bytes gauge\n");
+            AppendFormat(out, "kanchonet_arena_used_bytes %zu\n", stats.mUsedBytes);
+            AppendFormat(out, "# TYPE kanchonet_arena_peak_used_bytes gauge\n");
+            AppendFormat(out, "kanchonet_arena_peak_used_bytes %zu\n", stats.mPeakUsedBytes);
+            AppendFormat(out, "# TYPE kanchonet_arena_committed_bytes gauge\n");
+            AppendFormat(out, "kanchonet_arena_committed_bytes %zu\n", stats.mCommittedBytes);
+            AppendFormat(out, "# TYPE kanchonet_arena_failures_total counter\n");
+            AppendFormat(out, "kanchonet_arena_failures_total %llu\n", static_cast<unsigned long long>(stats.mFailures));
+        }
+
+        AppendFormat(out, "# TYPE kanchonet_buffer_pool_free gauge\n");
+        for (const PoolEntry& entry : mBufferPools)
+        {
+            AppendFormat(out, "kanchonet_buffer_pool_free{pool=\"%s\"} %zu\n",
+                         entry.mName.c_str(), entry.mPool->GetPoolSize());
+        }
+
+        AppendFormat(out, "# TYPE kanchonet_buffer_pool_allocated_total counter\n");
+        for (const PoolEntry& entry : mBufferPools)
+        {
+            AppendFormat(out, "kanchonet_buffer_pool_allocated_total{pool=\"%s\"} %zu\n",
+                         entry.mName.c_str(), entry.mPool->GetTotalAllocated());
+        }
+
+        AppendFormat(out, "# TYPE kanchonet_buffer_pool_buffer_bytes gauge\n");
+        for (const PoolEntry& entry : mBufferPools)
+        {
+            AppendFormat(out, "kanchonet_buffer_pool_buffer_bytes{pool=\"%s\"} %zu\n",
+                         entry.mName.c_str(), entry.mPool->GetBufferSize());
+        }
+
+        AppendFormat(out, "# TYPE kanchonet_metrics_scrapes_total counter\n");
+        AppendFormat(out, "kanchonet_metrics_scrapes_total %llu\n", static_cast<unsigned long long>(mScrapeCount));
+    }
+
+    void MetricsHttpServer::RenderJson(PacketBuffer& out) const
+    {
+        AppendFormat(out, "{\"engine\":{\"model\":\"%s\"", mModelName.c_str());
+
+        if (mMetrics)
+        {
+            MetricsSnapshot snapshot = mMetrics->GetSnapshot();
+
+            AppendFormat(out, ",\"counters\":{");
+            for (size_t i = 0; i < METRIC_COUNTER_COUNT; ++i)
+            {
+                AppendFormat(out, "%s\"%s\":%llu", (i > 0) ? "," : "",
+                             NetworkMetrics::GetName(static_cast<MetricCounter>(i)),
+                             static_cast<unsigned long long>(snapshot.mCounters[i]));
+            }
+
+            AppendFormat(out, "},\"latency\":{");
+            for (size_t i = 0; i < METRIC_HISTOGRAM_COUNT; ++i)
+            {
+                const HistogramSnapshot& histogram = snapshot.mHistograms[i];
+
+                AppendFormat(out, "%s\"%s\":{\"count\":%llu,\"sum\":%llu,\"min\":%llu,\"max\":%llu,\"mean\":%.1f",
+                             (i > 0) ? "," : "",
+                             NetworkMetrics::GetName(static_cast<MetricHistogram>(i)),
+                             static_cast<unsigned long long>(histogram.GetCount()),
+                             static_cast<unsigned long long>(histogram.GetSum()),
+                             static_cast<unsigned long long>(histogram.GetMin()),
+                             static_cast<unsigned long long>(histogram.GetMax()),
+                             histogram.GetMean());
+                for (const auto& quantile : sQuantiles)
+                {
+                    AppendFormat(out, ",\"%s\":%llu", quantile.mJsonKey,
+                                 static_cast<unsigned long long>(histogram.GetValueAtPercentile(quantile.mPercentile)));
+                }
+                AppendFormat(out, "}");
+            }
+            AppendFormat(out, "}");
+        }
+        AppendFormat(out, "}");
+
+        if (mSessionManager)
+        {
+            AppendFormat(out, ",\"sessions\":{\"active\":%zu,\"max\":%zu}",
+                         mSessionManager->GetSessionCount(), mSessionManager->GetMaxSessions());
+        }
+
+        const HugePageArena* arena = mSessionManager ? mSessionManager->GetArena() : nullptr;
+        if (arena)
+        {
+            ArenaStats stats = arena->GetStats();
+            AppendFormat(out, ",\"arena\":{\"pages\":\"%s\",\"capacity\":%zu,\"used\":%zu,\"peak_used\":%zu,"
+                              "\"committed\":%zu,\"utilization\":%.4f,\"allocations\":%llu,\"failures\":%llu}",
+                         HugePageArena::GetPageModeName(stats.mPageMode), stats.mCapacity, stats.mUsedBytes,
+                         stats.mPeakUsedBytes, stats.mCommittedBytes, stats.GetUtilization(),
+                         static_cast<unsigned long long>(stats.mAllocations),
+                         static_cast<unsigned long long>(stats.mFailures));
+        }
+
+        AppendFormat(out, ",\"buffer_pools\":[");
+        for (size_t i = 0; i < mBufferPools.size(); ++i)
+        {
+            const PoolEntry& entry = mBufferPools[i];
+            AppendFormat(out, "%s{\"name\":\"%s\",\"free\":%zu,\"allocated\":%zu,\"buffer_size\":%zu}",
+                         (i > 0) ? "," : "", entry.mName.c_str(), entry.mPool->GetPoolSize(),
+                         entry.mPool->GetTotalAllocated(), entry.mPool->GetBufferSize());
+        }
+        AppendFormat(out, "],\"scrapes\":%llu}\n", static_cast<unsigned long long>(mScrapeCount));
+    }
+
+    uint32_t MetricsHttpServer::ReceiveRequest(Connection& connection, SocketHandle socket)
+    {
+        while (true)
+        {
+            size_t space = MAX_REQUEST_SIZE - 1 - connection.mRequestLength;
+            if (space == 0)
+            {
+                // 헤더가 너무 큼
+                BuildResponse(connection);
+                return EVENT_WRITE;
+            }
+
+            ssize_t bytesRead = recv(socket, connection.mRequest + connection.mRequestLength, space, 0);
+            if (bytesRead > 0)
+            {
+                connection.mRequestLength += static_cast<size_t>(bytesRead);
+                connection.mRequest[connection.mRequestLength] = '\0';
+
+                // 헤더 끝을 받으면 응답 생성 (본문은 사용하지 않음)
+                if (strstr(connection.mRequest, "\r\n\r\n") || strstr(connection.mRequest, "\n\n"))
+                {
+                    BuildResponse(connection);
+                    return EVENT_WRITE;
+                }
+            }
+            else if (bytesRead == 0)
+            {
+                // 요청 완료 전에 연결 종료
+                return 0;
+            }
+            else
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return (errno == EAGAIN || errno == EWOULDBLOCK) ? EVENT_READ : 0;
+            }
+        }
+    }
+
+    uint32_t MetricsHttpServer::SendResponse(Connection& connection, SocketHandle socket)
+    {
+        PacketBuffer& response = *connection.mResponse;
+
+        while (connection.mSendOffset < response.GetSize())
+        {
+            ssize_t bytesSent = send(socket, response.GetData() + connection.mSendOffset,
+                                     response.GetSize() - connection.mSendOffset, MSG_NOSIGNAL);
+            if (bytesSent > 0)
+            {
+                connection.mSendOffset += static_cast<size_t>(bytesSent);
+            }
+            else if (bytesSent < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            else if (bytesSent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                // 소켓 버퍼가 가득 참: 쓰기 가능 이벤트에서 이어서 전송
+                return EVENT_WRITE;
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
+        return 0;
+    }
+
+    void MetricsHttpServer::BuildResponse(Connection& connection)
+    {
+        connection.mResponse = mResponsePool.Allocate();
+        PacketBuffer& response = *connection.mResponse;
+
+        // 헤더 자리를 비워두고 본문을 바로 렌더링 (Content-Length를 알게 된 뒤 헤더를 채움)
+        response.Resize(RESPONSE_HEADER_RESERVE);
+
+        // 요청 라인: "<METHOD> <PATH> HTTP/1.x"
+        char method[8] = {};
+        char path[128] = {};
+        if (sscanf(connection.mRequest, "%7s %127s", method, path) != 2)
+        {
+            AppendFormat(response, "bad request\n");
+            connection.mSendOffset = FinishResponse(response, 400, "Bad Request", "text/plain");
+            return;
+        }
+
+        if (strcmp(method, "GET") != 0)
+        {
+            AppendFormat(response, "method not allowed\n");
+            connection.mSendOffset = FinishResponse(response, 405, "Method Not Allowed", "text/plain");
+            return;
+        }
+
+        // 쿼리 문자열 무시
+        char* query = strchr(path, '?');
+        if (query)
+        {
+            *query = '\0';
+        }
+
+        if (strcmp(path, "/metrics") == 0)
+        {
+            ++mScrapeCount;
+            RenderPrometheus(response);
+            connection.mSendOffset = FinishResponse(response, 200, "OK", "text/plain; version=0.0.4");
+        }
+        else if (strcmp(path, "/metrics.json") == 0)
+        {
+            ++mScrapeCount;
+            RenderJson(response);
+            connection.mSendOffset = FinishResponse(response, 200, "OK", "application/json");
+        }
+        else
+        {
+            AppendFormat(response, "not found (try /metrics or /metrics.json)\n");
+            connection.mSendOffset = FinishResponse(response, 404, "Not Found", "text/plain");
+        }
+    }
+
+    size_t MetricsHttpServer::FinishResponse(PacketBuffer& buffer, int status, const char* reason,
+                                             const char* contentType)
+    {
+        size_t bodySize = buffer.GetSize() - RESPONSE_HEADER_RESERVE;
+
+        char header[RESPONSE_HEADER_RESERVE];
+        int length = snprintf(header, sizeof(header),
+                              "HTTP/1.1 %d %s\r\n"
+                              "Content-Type: %s\r\n"
+                              "Content-Length: %zu\r\n"
+                              "Connection: close\r\n"
+                              "\r\n",
+                              status, reason, contentType, bodySize);
+
+        // 헤더는 항상 예약 공간 안에 들어감 (상태/타입 문자열은 모두 내부 상수)
+        size_t headerSize = static_cast<size_t>(length);
+        size_t offset = RESPONSE_HEADER_RESERVE - headerSize;
+        memcpy(buffer.GetData() + offset, header, headerSize);
+        return offset;
+    }
+
+    void MetricsHttpServer::CloseConnection(SocketHandle socket)
+    {
+        auto it = mConnections.find(socket);
+        if (it == mConnections.end())
+        {
+            return;
+        }
+
+        mResponsePool.Deallocate(std::move(it->second->mResponse));
+        mConnections.erase(it);
+        SocketUtils::CloseSocket(socket);
+    }
+
+} // namespace KanchoNet
+
+#endif // KANCHONET_PLATFORM_LINUX
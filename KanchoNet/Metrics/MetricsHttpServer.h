@@ -0,0 +1,128 @@
+#pragma once
+
+#include "../Platform.h"
+
+// 메트릭 HTTP 엔드포인트는 Linux 네트워크 모델(epoll, io_uring) 전용
+#ifdef KANCHONET_PLATFORM_LINUX
+
+#include "../Types.h"
+#include "../Utils/NonCopyable.h"
+#include "../Buffer/BufferPool.h"
+#include "NetworkMetrics.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace KanchoNet
+{
+    class SessionManager;
+
+    // 메트릭 노출용 최소 HTTP/1.1 서버
+    // 별도 스레드 없이 네트워크 모델의 이벤트 루프(epoll, io_uring)에 소켓을 등록해 처리
+    // 모델은 소켓 준비 상태만 전달하고, 요청 파싱/응답 렌더링/논블로킹 송수신은 이 클래스가 담당
+    //
+    // 경로
+    //   GET /metrics        Prometheus 텍스트 형식 (text/plain; version=0.0.4)
+    //   GET /metrics.json   JSON 스냅샷 (엔진 카운터/지연, 세션, 버퍼 풀)
+    // 응답마다 연결을 닫음 (Connection: close)
+    class MetricsHttpServer : public NonCopyable
+    {
+    public:
+        // public 멤버변수
+        // 준비 상태/관심 이벤트 플래그
+        static constexpr uint32_t EVENT_READ = 0x01;
+        static constexpr uint32_t EVENT_WRITE = 0x02;
+        static constexpr uint32_t EVENT_ERROR = 0x04;
+
+        static constexpr size_t MAX_CONNECTIONS = 16;           // 동시 스크레이프 연결 수 (초과 시 즉시 닫음)
+        static constexpr size_t MAX_REQUEST_SIZE = 2048;        // 요청 헤더 최대 크기
+        static constexpr size_t RESPONSE_BUFFER_SIZE = 16384;   // 풀 버퍼 초기 용량
+        static constexpr size_t RESPONSE_HEADER_RESERVE = 256;  // 본문 앞에 남겨두는 HTTP 헤더 공간
+
+    private:
+        // private 멤버변수
+        // 스크레이프 연결 상태
+        struct Connection
+        {
+            char mRequest[MAX_REQUEST_SIZE];
+            size_t mRequestLength = 0;
+            std::unique_ptr<PacketBuffer> mResponse;    // 응답 생성 후에만 할당 (mResponsePool)
+            size_t mSendOffset = 0;
+        };
+
+        // 노출할 버퍼 풀
+        struct PoolEntry
+        {
+            std::string mName;
+            const BufferPool* mPool;
+        };
+
+        SocketHandle mListenSocket;
+        std::string mModelName;
+        const NetworkMetrics* mMetrics;             // nullptr이면 카운터/지연 생략
+        const SessionManager* mSessionManager;
+
+        std::unordered_map<SocketHandle, std::unique_ptr<Connection>> mConnections;
+        std::vector<PoolEntry> mBufferPools;
+        BufferPool mResponsePool;
+        uint64_t mScrapeCount;
+
+        // 연결 상태 보호 (메트릭 소켓 이벤트만 획득하므로 게임 트래픽과 경합하지 않음)
+        mutable std::mutex mMutex;
+
+    public:
+        // 생성자, 파괴자
+        MetricsHttpServer();
+        ~MetricsHttpServer();
+
+    public:
+        // public 함수
+        // 리슨 소켓 생성 (논블로킹, address는 IPv4 문자열)
+        bool Open(const std::string& address, uint16_t port, int backlog);
+
+        // 리슨 소켓과 모든 연결 닫기
+        void Close();
+
+        // 노출 대상 설정 (Open 이후, 이벤트 처리 전에 호출)
+        void SetSources(const char* modelName, const NetworkMetrics* metrics, const SessionManager* sessionManager);
+
+        // 버퍼 풀 등록 (StartListen 이전에 호출, 풀은 서버보다 오래 살아 있어야 함)
+        void AddBufferPool(const std::string& name, const BufferPool* pool);
+
+        SocketHandle GetListenSocket() const { return mListenSocket; }
+        bool IsOpen() const { return mListenSocket != INVALID_SOCKET_HANDLE; }
+
+        // 리슨 소켓이 읽기 가능할 때 반복 호출
+        // 수락한 연결 소켓 반환 (더 없으면 INVALID_SOCKET_HANDLE), 모델은 EVENT_READ로 등록
+        SocketHandle Accept();
+
+        // 연결 소켓 이벤트 처리 (events: EVENT_* 조합)
+        // 반환값: 다음에 기다릴 이벤트 (0이면 연결이 닫혔으므로 다시 등록하지 않음)
+        uint32_t HandleEvent(SocketHandle socket, uint32_t events);
+
+        // 렌더링 (풀 버퍼 등에 이어 쓰기)
+        void RenderPrometheus(PacketBuffer& out) const;
+        void RenderJson(PacketBuffer& out) const;
+
+    private:
+        // private 함수
+        // 요청 수신 (반환값: 0 = 닫힘, EVENT_READ = 더 필요, EVENT_WRITE = 응답 준비됨)
+        uint32_t ReceiveRequest(Connection& connection, SocketHandle socket);
+
+        // 응답 송신 (반환값: 0 = 완료 또는 에러, EVENT_WRITE = 재시도 필요)
+        uint32_t SendResponse(Connection& connection, SocketHandle socket);
+
+        // 요청 라인을 해석해 응답 생성
+        void BuildResponse(Connection& connection);
+
+        // 예약해 둔 공간의 끝에 HTTP 헤더를 채움 (반환값: 응답 시작 오프셋)
+        size_t FinishResponse(PacketBuffer& buffer, int status, const char* reason, const char* contentType);
+
+        void CloseConnection(SocketHandle socket);
+    };
+
+} // namespace KanchoNet
+
+#endif // KANCHONET_PLATFORM_LINUX
@@ -0,0 +1,152 @@
+#include "NetworkMetrics.h"
+#include <vector>
+
+namespace KanchoNet
+{
+    thread_local NetworkMetrics::SlotCache NetworkMetrics::tLastSlot = { 0, nullptr };
+
+    // 레지스트리 ID 발급 (0은 "캐시 없음"으로 사용)
+    static std::atomic<uint64_t> sNextRegistryID(1);
+
+    NetworkMetrics::ThreadSlot::ThreadSlot()
+        : mShared(false)
+    {
+        for (auto& counter : mCounters)
+        {
+            counter.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    NetworkMetrics::NetworkMetrics()
+        : mRegistryID(sNextRegistryID.fetch_add(1, std::memory_order_relaxed))
+        , mSlotCount(0)
+    {
+        for (auto& slot : mSlots)
+        {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    NetworkMetrics::~NetworkMetrics()
+    {
+        for (auto& slot : mSlots)
+        {
+            delete slot.load(std::memory_order_relaxed);
+        }
+    }
+
+    NetworkMetrics::ThreadSlot* NetworkMetrics::GetThreadSlotSlow()
+    {
+        // 스레드가 사용한 적 있는 레지스트리별 슬롯 목록
+        static thread_local std::vector<SlotCache> tSlots;
+
+        for (const SlotCache& cache : tSlots)
+        {
+            if (cache.mRegistryID == mRegistryID)
+            {
+                tLastSlot = cache;
+                return cache.mSlot;
+            }
+        }
+
+        // 새 슬롯 할당
+        ThreadSlot* slot = nullptr;
+        size_t index = mSlotCount.fetch_add(1, std::memory_order_relaxed);
+        if (index < MAX_THREAD_SLOTS - 1)
+        {
+            slot = new ThreadSlot();
+            mSlots[index].store(slot, std::memory_order_release);
+        }
+        else
+        {
+            // 슬롯 부족: 마지막 슬롯을 공유 (원자적 증가 사용)
+            ThreadSlot* shared = mSlots[MAX_THREAD_SLOTS - 1].load(std::memory_order_acquire);
+            if (!shared)
+            {
+                ThreadSlot* created = new ThreadSlot();
+                created->mShared = true;
+                if (mSlots[MAX_THREAD_SLOTS - 1].compare_exchange_strong(shared, created,
+                                                                         std::memory_order_acq_rel))
+                {
+                    shared = created;
+                }
+                else
+                {
+                    delete created;
+                }
+            }
+            slot = shared;
+        }
+
+        SlotCache cache = { mRegistryID, slot };
+        tSlots.push_back(cache);
+        tLastSlot = cache;
+        return slot;
+    }
+
+    MetricsSnapshot NetworkMetrics::GetSnapshot() const
+    {
+        MetricsSnapshot snapshot;
+
+        for (const auto& slotPtr : mSlots)
+        {
+            const ThreadSlot* slot = slotPtr.load(std::memory_order_acquire);
+            if (!slot)
+            {
+                continue;
+            }
+
+            for (size_t i = 0; i < METRIC_COUNTER_COUNT; ++i)
+            {
+                snapshot.mCounters[i] += slot->mCounters[i].load(std::memory_order_relaxed);
+            }
+
+            for (size_t i = 0; i < METRIC_HISTOGRAM_COUNT; ++i)
+            {
+                slot->mHistograms[i].CopyTo(snapshot.mHistograms[i]);
+            }
+        }
+
+        return snapshot;
+    }
+
+    const char* NetworkMetrics::GetName(MetricCounter counter)
+    {
+        switch (counter)
+        {
+        case MetricCounter::Accepts:        return "accepts";
+        case MetricCounter::AcceptRejects:  return "accept_rejects";
+        case MetricCounter::Disconnects:    return "disconnects";
+        case MetricCounter::BytesReceived:  return "bytes_received";
+        case MetricCounter::BytesSent:      return "bytes_sent";
+        case MetricCounter::ReceiveOps:     return "receive_ops";
+        case MetricCounter::SendOps:        return "send_ops";
+        case MetricCounter::SendOverflows:  return "send_overflows";
+        case MetricCounter::PollWakeups:    return "poll_wakeups";
+        case MetricCounter::PollEvents:     return "poll_events";
+        case MetricCounter::AcceptMisses:   return "accept_misses";
+        case MetricCounter::DispatchCollisions: return "dispatch_collisions";
+        case MetricCounter::ReadBudgetExhausted: return "read_budget_exhausted";
+        case MetricCounter::BusyPollSleeps: return "busy_poll_sleeps";
+        case MetricCounter::RateLimitPauses: return "rate_limit_pauses";
+        case MetricCounter::RateLimitDrops: return "rate_limit_drops";
+        case MetricCounter::RateLimitDisconnects: return "rate_limit_disconnects";
+        case MetricCounter::ConnectionRateRejects: return "connection_rate_rejects";
+        case MetricCounter::Overloads: return "overloads";
+        case MetricCounter::OverloadSheds: return "overload_sheds";
+        default:                            return "unknown";
+        }
+    }
+
+    const char* NetworkMetrics::GetName(MetricHistogram histogram)
+    {
+        switch (histogram)
+        {
+        case MetricHistogram::ReceiveCallback:      return "receive_callback_ns";
+        case MetricHistogram::SendQueueResidency:   return "send_queue_residency_ns";
+        default:                                    return "unknown";
+        }
+    }
+
+} // namespace KanchoNet
+
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "../Types.h"
+#include "../Utils/NonCopyable.h"
+#include "LatencyHistogram.h"
+#include <atomic>
+#include <chrono>
+
+namespace KanchoNet
+{
+    // 카운터 종류
+    enum class MetricCounter : uint32_t
+    {
+        Accepts = 0,            // 수락된 연결 수
+        AcceptRejects,          // 세션 한도 등으로 거부된 연결 수
+        Disconnects,            // 종료된 연결 수
+        BytesReceived,          // 수신 바이트
+        BytesSent,              // 송신 바이트
+        ReceiveOps,             // recv 호출/수신 완료 수
+        SendOps,                // send/sendmsg 호출/송신 완료 수
+        SendOverflows,          // 송신 버퍼/큐 초과로 실패한 Send 수
+        PollWakeups,            // epoll_wait/io_uring 대기에서 깨어난 횟수
+        PollEvents,             // 처리한 이벤트/완료 수
+        AcceptMisses,           // 깨어났지만 받을 연결이 없던 리슨 이벤트 수 (다른 스레드가 먼저 수락)
+        DispatchCollisions,     // 다른 스레드가 이미 처리 중이던 세션의 이벤트 수 (처리 중인 스레드에 넘김)
+        ReadBudgetExhausted,    // 읽기 예산을 다 써서 다음 회차로 미룬 수신 수
+        BusyPollSleeps,         // 바쁜 대기 중 유휴 시간이 지나 커널 대기로 전환한 횟수
+        RateLimitPauses,        // 수신 속도 제한으로 읽기를 멈춘 횟수
+        RateLimitDrops,         // 수신 속도 제한으로 버린 수신 수
+        RateLimitDisconnects,   // 수신 속도 제한으로 종료한 연결 수
+        ConnectionRateRejects,  // 출발지 IP별 연결 속도 제한으로 닫은 연결 수
+        Overloads,              // 과부하로 전환한 횟수 (새 연결 수락 중지)
+        OverloadSheds,          // 과부하 중 낮은 우선순위 세션의 수신을 제한한 횟수
+
+        Count
+    };
+
+    // 히스토그램 종류 (단위: 나노초)
+    enum class MetricHistogram : uint32_t
+    {
+        ReceiveCallback = 0,    // OnReceive 콜백 실행 시간
+        SendQueueResidency,     // 송신 큐가 비어있지 않았던 시간 (첫 큐잉 ~ 커널에 모두 전달)
+
+        Count
+    };
+
+    constexpr size_t METRIC_COUNTER_COUNT = static_cast<size_t>(MetricCounter::Count);
+    constexpr size_t METRIC_HISTOGRAM_COUNT = static_cast<size_t>(MetricHistogram::Count);
+
+    // 메트릭 스냅샷 (모든 스레드 값을 합산한 결과)
+    struct MetricsSnapshot
+    {
+        uint64_t mCounters[METRIC_COUNTER_COUNT] = {};
+        HistogramSnapshot mHistograms[METRIC_HISTOGRAM_COUNT];
+
+        uint64_t Get(MetricCounter counter) const { return mCounters[static_cast<size_t>(counter)]; }
+        const HistogramSnapshot& Get(MetricHistogram histogram) const { return mHistograms[static_cast<size_t>(histogram)]; }
+    };
+
+    // 네트워크 메트릭 레지스트리
+    // 스레드마다 캐시 라인 정렬된 전용 슬롯에 기록하고 (공유 캐시 라인 경합 없음)
+    // 조회 시에만 모든 슬롯을 합산
+    // 기록 비용: 스레드 슬롯 확인(thread_local 비교 1회) + relaxed load/store
+    class NetworkMetrics : public NonCopyable
+    {
+    public:
+        // public 멤버변수
+        static constexpr size_t MAX_THREAD_SLOTS = 64;  // 초과하는 스레드는 마지막 슬롯을 원자적 연산으로 공유
+
+    private:
+        // private 멤버변수
+        // 스레드별 슬롯
+        struct alignas(CACHE_LINE_SIZE) ThreadSlot
+        {
+            std::atomic<uint64_t> mCounters[METRIC_COUNTER_COUNT];
+            LatencyHistogram mHistograms[METRIC_HISTOGRAM_COUNT];
+            bool mShared;   // 여러 스레드가 공유하는 슬롯 여부
+
+            ThreadSlot();
+        };
+
+        // 스레드별 슬롯 캐시 항목
+        struct SlotCache
+        {
+            uint64_t mRegistryID;
+            ThreadSlot* mSlot;
+        };
+
+        uint64_t mRegistryID;   // 레지스트리 고유 ID (재사용되지 않음)
+        std::atomic<ThreadSlot*> mSlots[MAX_THREAD_SLOTS];
+        std::atomic<size_t> mSlotCount;
+
+    public:
+        // 생성자, 파괴자
+        NetworkMetrics();
+        ~NetworkMetrics();
+
+    public:
+        // public 함수
+        // 카운터 증가
+        void Add(MetricCounter counter, uint64_t value = 1)
+        {
+            ThreadSlot* slot = GetThreadSlot();
+            std::atomic<uint64_t>& target = slot->mCounters[static_cast<size_t>(counter)];
+
+            if (slot->mShared)
+            {
+                target.fetch_add(value, std::memory_order_relaxed);
+            }
+            else
+            {
+                target.store(target.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+            }
+        }
+
+        // 지연 시간 기록 (나노초)
+        void Record(MetricHistogram histogram, uint64_t nanoseconds)
+        {
+            ThreadSlot* slot = GetThreadSlot();
+            slot->mHistograms[static_cast<size_t>(histogram)].Record(nanoseconds, slot->mShared);
+        }
+
+        // 전체 합산 스냅샷
+        MetricsSnapshot GetSnapshot() const;
+
+        // 카운터/히스토그램 이름 (snake_case, 노출용)
+        static const char* GetName(MetricCounter counter);
+        static const char* GetName(MetricHistogram histogram);
+
+        // 지연 측정용 시각 (나노초, steady_clock)
+        static int64_t Now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+    private:
+        // private 함수
+        ThreadSlot* GetThreadSlot()
+        {
+            // 가장 최근에 사용한 레지스트리의 슬롯은 바로 반환
+            if (tLastSlot.mRegistryID == mRegistryID)
+            {
+                return tLastSlot.mSlot;
+            }
+            return GetThreadSlotSlow();
+        }
+
+        ThreadSlot* GetThreadSlotSlow();
+
+        static thread_local SlotCache tLastSlot;
+    };
+
+} // namespace KanchoNet
+
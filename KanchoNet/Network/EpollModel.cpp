@@ -6,14 +6,36 @@
 #include "../Utils/Logger.h"
 #include <unistd.h>
 #include <cstring>
+#include <climits>
+#include <algorithm>
 
 namespace KanchoNet
 {
+    static_assert(SendChain::MAX_IOV_COUNT <= IOV_MAX, "SendChain::MAX_IOV_COUNT exceeds IOV_MAX");
+
+#ifndef EPOLLEXCLUSIVE
+    // glibc 헤더가 오래된 경우 (커널 4.5 이상에서 지원)
+    #define EPOLLEXCLUSIVE (1u << 28)
+#endif
+
+    // 수신 버퍼 (ProcessIO를 여러 스레드에서 호출하므로 스레드마다 따로 둠)
+    static thread_local uint8_t tReceiveBuffer[DEFAULT_BUFFER_SIZE];
+
+    // 이번 회차에 이어 읽을 세션 (모델의 읽기 대기 목록과 교환해 메모리를 재사용)
+    static thread_local std::vector<Session*> tReadableSessions;
+
+    // 바쁜 대기 모드에서 마지막으로 이벤트를 받은 시각 (스레드마다 따로 유휴 여부를 판단, ns)
+    static thread_local int64_t tLastActivityTime = 0;
+
     EpollModel::EpollModel()
         : mInitialized(false)
         , mRunning(false)
+        , mAccepting(false)
+        , mAcceptPaused(false)
         , mListenSocket(INVALID_SOCKET_HANDLE)
         , mEpollFd(-1)
+        , mRateLimited(false)
+        , mNextResumeTime(INT64_MAX)
     {
     }
 
@@ -32,6 +54,16 @@ namespace KanchoNet
 
         mConfig = config;
 
+        // 수신 속도 제한
+        mByteLimit.Configure(mConfig.mRateLimitBytesPerSec, mConfig.mRateLimitBytesBurst);
+        mMessageLimit.Configure(mConfig.mRateLimitMessagesPerSec, mConfig.mRateLimitMessagesBurst);
+        mConnectionLimiter.Configure(mConfig.mRateLimitConnectionsPerSec, mConfig.mRateLimitConnectionsBurst);
+        mRateLimited = mByteLimit.IsEnabled() || mMessageLimit.IsEnabled();
+
+        // 과부하 감지
+        mLoadMonitor.Configure(mConfig.mOverloadLoopLagUs, mConfig.mOverloadReadyDepth, mConfig.mOverloadSendBacklogBytes,
+                               mConfig.mOverloadRecoverPercent, mConfig.mOverloadHoldMs);
+
         // 네트워크 초기화
         if (!SocketUtils::InitializeNetwork())
         {
@@ -47,30 +79,64 @@ namespace KanchoNet
             return false;
         }
 
-        // 리슨 소켓 생성
-        mListenSocket = SocketUtils::CreateTCPSocket();
-        if (mListenSocket == INVALID_SOCKET_HANDLE)
+        if (mConfig.mInheritedListenSocket != INVALID_SOCKET_HANDLE)
         {
-            close(mEpollFd);
-            SocketUtils::CleanupNetwork();
-            return false;
+            // 이전 프로세스가 넘긴 리슨 소켓 (옵션/bind/listen은 이전 프로세스에서 이미 적용됨)
+            mListenSocket = mConfig.mInheritedListenSocket;
+            SocketUtils::SetNonBlocking(mListenSocket, true);
+            LOG_INFO("Using inherited listen socket. Socket: %d", mListenSocket);
         }
+        else
+        {
+            // 리슨 소켓 생성
+            mListenSocket = SocketUtils::CreateTCPSocket();
+            if (mListenSocket == INVALID_SOCKET_HANDLE)
+            {
+                close(mEpollFd);
+                SocketUtils::CleanupNetwork();
+                return false;
+            }
 
-        // 소켓 옵션 설정
-        SocketUtils::SetSocketOption(mListenSocket, mConfig);
-        SocketUtils::SetNonBlocking(mListenSocket, true);
+            // 소켓 옵션 설정
+            SocketUtils::SetSocketOption(mListenSocket, mConfig);
+            SocketUtils::SetListenOption(mListenSocket, mConfig);
+            SocketUtils::SetNonBlocking(mListenSocket, true);
 
-        // 소켓 바인드
-        if (!SocketUtils::BindSocket(mListenSocket, mConfig.mPort))
-        {
-            SocketUtils::CloseSocket(mListenSocket);
-            close(mEpollFd);
-            SocketUtils::CleanupNetwork();
-            return false;
+            // 소켓 바인드
+            if (!SocketUtils::BindSocket(mListenSocket, mConfig.mPort))
+            {
+                SocketUtils::CloseSocket(mListenSocket);
+                close(mEpollFd);
+                SocketUtils::CleanupNetwork();
+                return false;
+            }
         }
 
         // 세션 매니저 생성
-        mSessionManager = std::make_unique<SessionManager>(mConfig.mMaxSessions);
+        mSessionManager = std::make_unique<SessionManager>(mConfig.mMaxSessions, mConfig.mBufferArenaSize, mConfig.mArenaHugePages);
+
+        // 메트릭
+        if (mConfig.mEnableMetrics)
+        {
+            mMetrics = std::make_unique<NetworkMetrics>();
+        }
+
+        // 메트릭 HTTP 엔드포인트 (같은 epoll 인스턴스에서 처리)
+        if (mConfig.mMetricsPort != 0)
+        {
+            mMetricsServer = std::make_unique<MetricsHttpServer>();
+            if (!mMetricsServer->Open(mConfig.mMetricsBindAddress, mConfig.mMetricsPort, 16))
+            {
+                mMetricsServer.reset();
+                mMetrics.reset();
+                mSessionManager.reset();
+                SocketUtils::CloseSocket(mListenSocket);
+                close(mEpollFd);
+                SocketUtils::CleanupNetwork();
+                return false;
+            }
+            mMetricsServer->SetSources("epoll", mMetrics.get(), mSessionManager.get());
+        }
 
         mInitialized = true;
         LOG_INFO("EpollModel initialized successfully. Port: %u", mConfig.mPort);
@@ -98,25 +164,119 @@ namespace KanchoNet
             return false;
         }
 
+        if (!RegisterListenSocket())
+        {
+            return false;
+        }
+
+        // 메트릭 리슨 소켓 등록 (Edge-Triggered, 이벤트마다 대기 중인 연결을 모두 수락)
+        if (mMetricsServer)
+        {
+            struct epoll_event metricsEv;
+            metricsEv.events = EPOLLIN | EPOLLET;
+            metricsEv.data.u64 = (static_cast<uint64_t>(mMetricsServer->GetListenSocket()) << 1) | METRICS_EVENT_TAG;
+
+            if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mMetricsServer->GetListenSocket(), &metricsEv) < 0)
+            {
+                LOG_ERROR("Failed to add metrics socket to epoll. Error: %d",
+                         SocketUtils::GetLastSocketError());
+                return false;
+            }
+        }
+
+        mAcceptPaused.store(false, std::memory_order_release);
+        mAccepting.store(true, std::memory_order_release);
+        mRunning = true;
+        LOG_INFO("EpollModel started listening%s", mConfig.mEpollOneShot ? " (one-shot dispatch)" : "");
+        
+        return true;
+    }
+
+    bool EpollModel::RegisterListenSocket()
+    {
         // epoll에 리슨 소켓 등록 (EPOLLIN: 읽기 이벤트, EPOLLET: Edge-Triggered)
+        // 다중 대기 모드에서는 EPOLLEXCLUSIVE로 연결 하나에 대기 중인 스레드 하나만 깨움
+        // 등록할 때 이미 대기 중인 연결이 있으면 바로 이벤트가 옴 (과부하 회복 후 재등록)
         struct epoll_event ev;
-        ev.events = EPOLLIN | EPOLLET;
-        ev.data.ptr = nullptr; // 리슨 소켓은 nullptr로 표시
-        ev.data.fd = mListenSocket;
+        ev.events = EPOLLIN | EPOLLET | (mConfig.mEpollOneShot ? static_cast<uint32_t>(EPOLLEXCLUSIVE) : 0u);
+        ev.data.ptr = nullptr; // 리슨 소켓은 nullptr로 표시 (data는 union이므로 fd를 함께 쓰면 안 됨)
+
+        int result = epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mListenSocket, &ev);
+        if (result < 0 && errno == EINVAL && (ev.events & EPOLLEXCLUSIVE))
+        {
+            LOG_WARNING("EPOLLEXCLUSIVE is not supported by this kernel. Listen socket is registered without it");
+            ev.events &= ~EPOLLEXCLUSIVE;
+            result = epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mListenSocket, &ev);
+        }
 
-        if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mListenSocket, &ev) < 0)
+        if (result < 0)
         {
             LOG_ERROR("Failed to add listen socket to epoll. Error: %d", 
                      SocketUtils::GetLastSocketError());
             return false;
         }
 
-        mRunning = true;
-        LOG_INFO("EpollModel started listening");
-        
         return true;
     }
 
+    void EpollModel::SetAcceptPaused(bool paused)
+    {
+        SpinLockGuard lock(mAcceptLock);
+
+        // 상태가 그대로이거나 StopAccepting으로 이미 멈췄으면 리슨 소켓은 건드리지 않음
+        if (mAcceptPaused.exchange(paused, std::memory_order_acq_rel) == paused ||
+            !mAccepting.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        // 제거하는 동안 받아 둔 리슨 소켓 이벤트는 ProcessAccept가 mAcceptPaused를 보고 무시
+        // (남은 연결은 리슨 소켓 큐에 두었다가 회복하면 수락, 큐가 차면 커널이 새 SYN을 버림)
+        if (paused)
+        {
+            if (epoll_ctl(mEpollFd, EPOLL_CTL_DEL, mListenSocket, nullptr) < 0)
+            {
+                LOG_ERROR("Failed to remove listen socket from epoll. Error: %d", SocketUtils::GetLastSocketError());
+            }
+        }
+        else
+        {
+            RegisterListenSocket();
+        }
+    }
+
+    void EpollModel::RecordLoad(int64_t wakeTime, uint32_t readyDepth)
+    {
+        const int64_t now = NetworkMetrics::Now();
+        LoadSnapshot load;
+        if (!mLoadMonitor.RecordCycle(now - wakeTime, readyDepth, now, load))
+        {
+            return;
+        }
+
+        if (load.mOverloaded)
+        {
+            LOG_WARNING("Overloaded. Stop accepting. Loop lag: %lld us, Ready depth: %u, Send backlog: %lld bytes",
+                       static_cast<long long>(load.mLoopLagNs / 1000), load.mReadyDepth,
+                       static_cast<long long>(load.mSendBacklogBytes));
+            if (mMetrics)
+            {
+                mMetrics->Add(MetricCounter::Overloads);
+            }
+        }
+        else
+        {
+            LOG_INFO("Recovered from overload. Resume accepting");
+        }
+
+        SetAcceptPaused(load.mOverloaded);
+
+        if (mOnOverload)
+        {
+            mOnOverload(load);
+        }
+    }
+
     bool EpollModel::ProcessIO(uint32_t timeoutMs)
     {
         if (!mRunning)
@@ -124,17 +284,61 @@ namespace KanchoNet
             return false;
         }
 
+        // 지난 회차에 읽기 예산을 다 쓴 세션은 이번 회차의 이벤트를 모두 처리한 뒤 이어 읽음
+        std::vector<Session*>& readable = tReadableSessions;
+        {
+            SpinLockGuard lock(mReadableLock);
+            readable.swap(mReadableSessions);
+            for (Session* session : readable)
+            {
+                session->SetReadBacklogged(false);
+            }
+        }
+
+        // 이어 읽을 세션이 있으면 기다리지 않음
+        int waitMs = readable.empty() ? static_cast<int>(timeoutMs) : 0;
+
+        // 속도 제한/과부하 제한으로 멈춘 세션은 시각이 되면 다시 읽기 등록 (그 시각을 넘겨 잠들지 않음)
+        const bool monitorLoad = mLoadMonitor.IsEnabled();
+        if (mRateLimited || monitorLoad)
+        {
+            const int64_t resumeTime = mNextResumeTime.load(std::memory_order_acquire);
+            if (resumeTime != INT64_MAX)
+            {
+                const int64_t now = NetworkMetrics::Now();
+                if (resumeTime <= now)
+                {
+                    ResumePausedSessions(now);
+                }
+                else if (waitMs > 0)
+                {
+                    waitMs = static_cast<int>(std::min<int64_t>(waitMs, (resumeTime - now + 999999) / 1000000));
+                }
+            }
+        }
+
         struct epoll_event events[MAX_EVENTS];
-        int nfds = epoll_wait(mEpollFd, events, MAX_EVENTS, timeoutMs);
+        int nfds = WaitEvents(events, waitMs);
 
         if (nfds < 0)
         {
-            if (errno == EINTR)
+            if (errno != EINTR)
             {
-                return true; // 인터럽트는 에러가 아님
+                LOG_ERROR("epoll_wait failed. Error: %d", SocketUtils::GetLastSocketError());
+                ProcessReadable(readable);
+                return false;
             }
-            LOG_ERROR("epoll_wait failed. Error: %d", SocketUtils::GetLastSocketError());
-            return false;
+            nfds = 0; // 인터럽트는 에러가 아님
+        }
+
+        // 부하 측정: 깨어난 시각부터 회차를 마칠 때까지의 시간과 이번 회차에 처리할 준비 항목 수
+        const int64_t wakeTime = monitorLoad ? NetworkMetrics::Now() : 0;
+        const uint32_t readyDepth = static_cast<uint32_t>(nfds + readable.size());
+
+        if (mMetrics)
+        {
+            mMetrics->Add(MetricCounter::PollWakeups);
+            mMetrics->Add(MetricCounter::PollEvents, static_cast<uint64_t>(nfds));
         }
 
         // 이벤트 처리
@@ -143,40 +347,165 @@ namespace KanchoNet
             struct epoll_event& ev = events[i];
 
             // 리슨 소켓 이벤트
-            if (ev.data.fd == mListenSocket)
+            Session* session = static_cast<Session*>(ev.data.ptr);
+            if (!session)
             {
                 ProcessAccept();
                 continue;
             }
 
-            // 클라이언트 소켓 이벤트
-            Session* session = static_cast<Session*>(ev.data.ptr);
-            if (!session)
+            // 메트릭 엔드포인트 이벤트
+            if (ev.data.u64 & METRICS_EVENT_TAG)
             {
+                ProcessMetricsEvent(ev);
                 continue;
             }
 
-            // 에러 또는 연결 종료
-            if (ev.events & (EPOLLERR | EPOLLHUP))
+            if (mConfig.mEpollOneShot)
             {
-                ProcessDisconnect(session);
-                continue;
+                DispatchOneShot(session, ev.events);
             }
+            else
+            {
+                DispatchEvents(session, ev.events);
+            }
+        }
+
+        ProcessReadable(readable);
+
+        if (monitorLoad)
+        {
+            RecordLoad(wakeTime, readyDepth);
+        }
+        return true;
+    }
 
-            // 읽기 이벤트
-            if (ev.events & EPOLLIN)
+    int EpollModel::WaitEvents(struct epoll_event* events, int timeoutMs)
+    {
+        if (!mConfig.mBusyPoll || timeoutMs == 0)
+        {
+            return epoll_wait(mEpollFd, events, MAX_EVENTS, timeoutMs);
+        }
+
+        // 커널에서 잠들고 깨어나는 지연 없이 바로 이벤트를 받도록 회전
+        const int64_t idleLimit = static_cast<int64_t>(mConfig.mBusyPollIdleUs) * 1000;
+        const int64_t deadline = NetworkMetrics::Now() + static_cast<int64_t>(timeoutMs) * 1000000;
+        while (true)
+        {
+            int nfds = epoll_wait(mEpollFd, events, MAX_EVENTS, 0);
+            const int64_t now = NetworkMetrics::Now();
+            if (nfds != 0)
+            {
+                if (nfds > 0)
+                {
+                    tLastActivityTime = now;
+                }
+                return nfds;
+            }
+
+            if (now >= deadline)
             {
-                ProcessReceive(session);
+                return 0;
             }
 
-            // 쓰기 이벤트
-            if (ev.events & EPOLLOUT)
+            // 유휴 시간이 지나면 남은 시간 동안 잠들어 코어를 양보 (다음 이벤트를 받으면 다시 회전)
+            if (idleLimit != 0 && now - tLastActivityTime >= idleLimit)
             {
-                ProcessSend(session);
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::BusyPollSleeps);
+                }
+
+                const int remainingMs = static_cast<int>((deadline - now + 999999) / 1000000);
+                nfds = epoll_wait(mEpollFd, events, MAX_EVENTS, remainingMs);
+                if (nfds > 0)
+                {
+                    tLastActivityTime = NetworkMetrics::Now();
+                }
+                return nfds;
             }
+
+            CpuRelax();
         }
+    }
 
-        return true;
+    void EpollModel::DispatchEvents(Session* session, uint32_t events)
+    {
+        // 에러 또는 연결 종료
+        if (events & (EPOLLERR | EPOLLHUP))
+        {
+            ProcessDisconnect(session);
+            return;
+        }
+
+        // 읽기 이벤트
+        // 읽기 예산을 다 썼으면 남은 데이터는 다음 회차에 이어 읽음
+        // (EPOLLONESHOT 모드는 재등록할 때 커널이 읽을 데이터가 남은 소켓을 준비 목록 끝에 다시 넣으므로 목록을 쓰지 않음)
+        if ((events & EPOLLIN) && ProcessReceive(session) && !mConfig.mEpollOneShot)
+        {
+            QueueReadable(session);
+        }
+
+        // 쓰기 이벤트
+        if (events & EPOLLOUT)
+        {
+            ProcessSend(session);
+        }
+    }
+
+    void EpollModel::DispatchOneShot(Session* session, uint32_t events)
+    {
+        {
+            SpinLockGuard lock(session->GetLock());
+
+            // 종료된 세션에 남아있던 이벤트
+            if (!session->IsConnected())
+            {
+                return;
+            }
+
+            // 보통은 EPOLLONESHOT으로 한 스레드만 받지만, 송신 요청이 재등록과 겹치면 두 번째 이벤트가 올 수 있음
+            // 처리 중인 스레드가 이어서 처리하도록 넘기고 바로 반환
+            if (session->IsDispatching())
+            {
+                session->AddPendingEvents(events);
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::DispatchCollisions);
+                }
+                return;
+            }
+
+            session->SetDispatching(true);
+
+            // 처리 중 다른 스레드가 세션을 제거해도 슬롯이 재사용되지 않도록 참조 유지
+            session->AddRef();
+        }
+
+        while (true)
+        {
+            DispatchEvents(session, events);
+
+            SpinLockGuard lock(session->GetLock());
+
+            // 종료되었으면 소켓이 이미 닫혔으므로 재등록하지 않음
+            if (session->IsConnected())
+            {
+                events = session->TakePendingEvents();
+                if (events != 0)
+                {
+                    continue;
+                }
+
+                // 처리 중 쌓인 송신 요청까지 반영해 재등록
+                ModifySocket(session, GetSessionInterest(session));
+            }
+
+            session->SetDispatching(false);
+            break;
+        }
+
+        mSessionManager->ReleaseSession(session);
     }
 
     bool EpollModel::Send(Session* session, const PacketBuffer& buffer)
@@ -187,22 +516,157 @@ namespace KanchoNet
         }
 
         SpinLockGuard lock(session->GetLock());
+
+        // 종료 처리와 같은 락 안에서 확인 (닫힌 소켓 번호가 재사용된 뒤 잘못 등록하는 것 방지)
+        if (!session->IsConnected())
+        {
+            return false;
+        }
         
-        // 송신 버퍼에 데이터 추가
-        size_t written = session->GetSendBuffer().Write(buffer.GetData(), buffer.GetSize());
-        if (written < buffer.GetSize())
+        if (mConfig.mUseSendChain)
+        {
+            // 세그먼트 송신 큐에 복사 (작은 패킷은 마지막 세그먼트에 이어붙임)
+            if (!session->GetSendChain().Append(buffer.GetData(), buffer.GetSize()))
+            {
+                LOG_WARNING("Send queue overflow. SessionID: %llu", session->GetID());
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::SendOverflows);
+                }
+                return false;
+            }
+        }
+        else
+        {
+            // 송신 버퍼에 데이터 추가
+            size_t written = session->GetSendBuffer().Write(buffer.GetData(), buffer.GetSize());
+            if (written < buffer.GetSize())
+            {
+                LOG_WARNING("Send buffer overflow. SessionID: %llu", session->GetID());
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::SendOverflows);
+                }
+                return false;
+            }
+        }
+
+        mLoadMonitor.AddSendBacklog(static_cast<int64_t>(buffer.GetSize()));
+        RequestSend(session);
+        return true;
+    }
+
+    bool EpollModel::SendShared(Session* session, const SharedPacketBuffer* packets, size_t count)
+    {
+        if (!session || !packets || count == 0)
         {
-            LOG_WARNING("Send buffer overflow. SessionID: %llu", session->GetID());
             return false;
         }
 
-        // 소켓을 쓰기 가능 이벤트로 등록
-        if (!session->IsSending())
+        SpinLockGuard lock(session->GetLock());
+
+        if (!session->IsConnected())
         {
-            session->SetSending(true);
-            ModifySocket(session->GetSocket(), EPOLLIN | EPOLLOUT | EPOLLET);
+            return false;
+        }
+
+        size_t totalSize = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            totalSize += packets[i] ? packets[i]->GetSize() : 0;
         }
 
+        if (mConfig.mUseSendChain)
+        {
+            // 참조만 추가 (복사 없음)
+            if (!session->GetSendChain().Append(packets, count))
+            {
+                LOG_WARNING("Send queue overflow. SessionID: %llu", session->GetID());
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::SendOverflows);
+                }
+                return false;
+            }
+        }
+        else
+        {
+            // RingBuffer 모드에서는 전체가 들어갈 공간이 있을 때만 복사
+            RingBuffer& sendBuffer = session->GetSendBuffer();
+            if (totalSize > sendBuffer.GetAvailableWrite())
+            {
+                LOG_WARNING("Send buffer overflow. SessionID: %llu", session->GetID());
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::SendOverflows);
+                }
+                return false;
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (packets[i])
+                {
+                    sendBuffer.Write(packets[i]->GetData(), packets[i]->GetSize());
+                }
+            }
+        }
+
+        mLoadMonitor.AddSendBacklog(static_cast<int64_t>(totalSize));
+        RequestSend(session);
+        return true;
+    }
+
+    RingBuffer* EpollModel::BeginSend(Session* session)
+    {
+        if (!session || mConfig.mUseSendChain)
+        {
+            return nullptr;
+        }
+
+        session->GetLock().lock();
+
+        if (!session->IsConnected())
+        {
+            session->GetLock().unlock();
+            return nullptr;
+        }
+
+        return &session->GetSendBuffer();
+    }
+
+    void EpollModel::EndSend(Session* session, size_t bytes)
+    {
+        if (bytes > 0)
+        {
+            mLoadMonitor.AddSendBacklog(static_cast<int64_t>(bytes));
+            RequestSend(session);
+        }
+
+        session->GetLock().unlock();
+    }
+
+    bool EpollModel::StopAccepting()
+    {
+        if (!mRunning)
+        {
+            return false;
+        }
+
+        SpinLockGuard lock(mAcceptLock);
+        if (!mAccepting.exchange(false, std::memory_order_acq_rel))
+        {
+            return true;
+        }
+
+        // 이미 받아 둔 리슨 소켓 이벤트는 ProcessAccept가 mAccepting을 보고 무시 (과부하로 이미 제거했으면 그대로 둠)
+        if (!mAcceptPaused.load(std::memory_order_acquire) &&
+            epoll_ctl(mEpollFd, EPOLL_CTL_DEL, mListenSocket, nullptr) < 0)
+        {
+            LOG_ERROR("Failed to remove listen socket from epoll. Error: %d", SocketUtils::GetLastSocketError());
+        }
+
+        LOG_INFO("EpollModel stopped accepting");
         return true;
     }
 
@@ -214,17 +678,45 @@ namespace KanchoNet
         }
 
         mRunning = false;
+        mAccepting.store(false, std::memory_order_release);
+
+        // 세션 정리
+        if (mSessionManager)
+        {
+            // 읽기 대기 목록이 잡고 있던 참조 반환
+            {
+                SpinLockGuard lock(mReadableLock);
+                for (Session* session : mReadableSessions)
+                {
+                    session->SetReadBacklogged(false);
+                    mSessionManager->ReleaseSession(session);
+                }
+                mReadableSessions.clear();
+            }
+
+            // 읽기를 멈춘 세션 목록이 잡고 있던 참조 반환
+            {
+                SpinLockGuard lock(mPausedLock);
+                for (auto& paused : mPausedSessions)
+                {
+                    mSessionManager->ReleaseSession(paused.second);
+                }
+                mPausedSessions.clear();
+                mNextResumeTime.store(INT64_MAX, std::memory_order_release);
+            }
 
-        // 세션 정리
-        if (mSessionManager)
-        {
             mSessionManager->ForEachSession([this](Session* session) {
                 CloseSession(session);
             });
             mSessionManager->Clear();
         }
 
-        mSocketToSession.clear();
+        // 메트릭 엔드포인트 닫기
+        if (mMetricsServer)
+        {
+            mMetricsServer->Close();
+            mMetricsServer.reset();
+        }
 
         // 리슨 소켓 닫기
         if (mListenSocket != INVALID_SOCKET_HANDLE)
@@ -267,83 +759,269 @@ namespace KanchoNet
         mOnError = callback;
     }
 
+    void EpollModel::SetOverloadCallback(std::function<void(const LoadSnapshot&)> callback)
+    {
+        mOnOverload = callback;
+    }
+
     void EpollModel::ProcessAccept()
     {
+        // 출발지 IP별 연결 한도를 쓸 때만 주소를 받음
+        const bool limitConnections = mConnectionLimiter.IsEnabled();
+        struct sockaddr_storage address;
+        socklen_t addressLength;
+
+        SocketHandle sockets[ACCEPT_BATCH];
+        Session* sessions[ACCEPT_BATCH];
+        SessionConfig sessionConfig;
+        size_t acceptedCount = 0;
+        bool drained = false;
+
         // Edge-Triggered 모드에서는 모든 연결을 처리해야 함
-        while (true)
+        // ACCEPT_BATCH개씩 모아 세션 슬롯을 한 번의 락으로 확보
+        // 수락을 중지하면 남은 연결은 리슨 소켓 큐에 그대로 둠 (인계받은 프로세스나 과부하에서 회복한 뒤 이어서 수락)
+        while (!drained && mAccepting.load(std::memory_order_acquire) && !mAcceptPaused.load(std::memory_order_acquire))
         {
-            struct sockaddr_in clientAddr;
-            socklen_t addrLen = sizeof(clientAddr);
-            
-            SocketHandle clientSocket = accept(mListenSocket, 
-                                               (struct sockaddr*)&clientAddr, 
-                                               &addrLen);
-            
-            if (clientSocket < 0)
+            size_t count = 0;
+            while (count < ACCEPT_BATCH)
             {
+                // 논블로킹/close-on-exec을 accept와 함께 설정 (fcntl 호출 없음)
+                // TCP_NODELAY, Keep-Alive, 버퍼 크기는 리슨 소켓 설정을 상속하므로 따로 설정하지 않음
+                addressLength = sizeof(address);
+                SocketHandle clientSocket = limitConnections
+                    ? accept4(mListenSocket, reinterpret_cast<struct sockaddr*>(&address), &addressLength, SOCK_NONBLOCK | SOCK_CLOEXEC)
+                    : accept4(mListenSocket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                if (clientSocket >= 0)
+                {
+                    // 한도를 넘은 출발지의 연결은 세션을 만들지 않고 바로 닫음
+                    if (limitConnections &&
+                        !mConnectionLimiter.TryAcquire(SocketUtils::GetAddressKey(reinterpret_cast<struct sockaddr*>(&address)), NetworkMetrics::Now()))
+                    {
+                        close(clientSocket);
+                        if (mMetrics)
+                        {
+                            mMetrics->Add(MetricCounter::ConnectionRateRejects);
+                        }
+                        continue;
+                    }
+
+                    sockets[count++] = clientSocket;
+                    continue;
+                }
+
+                // 시그널 인터럽트, 대기 중 끊긴 연결은 다음 연결로 진행
+                if (errno == EINTR || errno == ECONNABORTED)
+                {
+                    continue;
+                }
+
                 if (errno == EAGAIN || errno == EWOULDBLOCK)
                 {
-                    // 더 이상 받을 연결이 없음
-                    break;
+                    // 더 이상 받을 연결이 없음 (하나도 못 받았으면 다른 스레드가 먼저 수락한 것)
+                    if (acceptedCount == 0 && count == 0 && mMetrics)
+                    {
+                        mMetrics->Add(MetricCounter::AcceptMisses);
+                    }
+                }
+                else
+                {
+                    LOG_ERROR("accept failed. Error: %d", SocketUtils::GetLastSocketError());
                 }
-                LOG_ERROR("accept failed. Error: %d", SocketUtils::GetLastSocketError());
+                drained = true;
                 break;
             }
 
-            // Non-blocking 설정
-            SocketUtils::SetNonBlocking(clientSocket, true);
-
-            // 세션 생성
-            SessionConfig sessionConfig;
-            Session* session = mSessionManager->AddSession(clientSocket, sessionConfig);
-            if (!session)
+            if (count == 0)
             {
-                LOG_WARNING("Failed to add session. Session limit reached.");
-                close(clientSocket);
-                continue;
+                break;
             }
 
-            session->SetState(SessionState::Connected);
-            mSocketToSession[clientSocket] = session;
-
-            // epoll에 클라이언트 소켓 등록
-            if (!RegisterSocket(clientSocket, session, EPOLLIN | EPOLLET))
+            // 세션 생성 (한도를 넘은 연결은 닫음)
+            size_t added = mSessionManager->AddSessions(sockets, count, sessionConfig, sessions);
+            if (added < count)
             {
-                CloseSession(session);
-                continue;
+                LOG_WARNING("Failed to add session. Session limit reached.");
+                for (size_t i = added; i < count; ++i)
+                {
+                    close(sockets[i]);
+                    if (mMetrics)
+                    {
+                        mMetrics->Add(MetricCounter::AcceptRejects);
+                    }
+                }
             }
 
-            // Accept 콜백 호출
-            if (mOnAccept)
+            acceptedCount += added;
+            for (size_t i = 0; i < added; ++i)
             {
-                mOnAccept(session);
+                AcceptSession(sessions[i]);
             }
-
-            LOG_DEBUG("Client accepted. SessionID: %llu", session->GetID());
         }
     }
 
-    void EpollModel::ProcessReceive(Session* session)
+    void EpollModel::AcceptSession(Session* session)
     {
-        if (!session || !session->IsConnected())
+        session->SetState(SessionState::Connected);
+        session->SetRateLimit(mByteLimit, mMessageLimit);
+
+        // 등록 전까지는 이 스레드가 디스패치 중인 것으로 표시 (OnAccept에서 보낸 송신은 등록할 때 함께 반영)
+        session->SetDispatching(true);
+
+        if (mMetrics)
+        {
+            mMetrics->Add(MetricCounter::Accepts);
+        }
+
+        // Accept 콜백 호출 (등록 전에 호출해야 다른 I/O 스레드의 수신 콜백보다 먼저 실행됨)
+        if (mOnAccept)
         {
+            mOnAccept(session);
+        }
+
+        // epoll에 클라이언트 소켓 등록
+        bool registered;
+        {
+            SpinLockGuard lock(session->GetLock());
+            registered = RegisterSocket(session->GetSocket(), session, GetSessionInterest(session));
+            session->SetDispatching(false);
+        }
+
+        if (!registered)
+        {
+            ProcessDisconnect(session);
             return;
         }
 
-        // Edge-Triggered 모드에서는 버퍼가 빌 때까지 읽어야 함
+        LOG_DEBUG("Client accepted. SessionID: %llu", session->GetID());
+    }
+
+    bool EpollModel::ProcessReceive(Session* session)
+    {
+        // 읽기를 멈춘 세션 (멈추기 전에 이미 받아 둔 이벤트나 읽기 대기 목록)
+        if (!session || !session->IsConnected() || session->IsReadPaused())
+        {
+            return false;
+        }
+
+        // 과부하 중에는 낮은 우선순위 세션의 수신부터 제한
+        bool shed = false;
+        if (mLoadMonitor.IsOverloaded() && session->GetPriority() < mConfig.mOverloadShedBelow)
+        {
+            if (mMetrics)
+            {
+                mMetrics->Add(MetricCounter::OverloadSheds);
+            }
+
+            if (mConfig.mOverloadShedAction == RateLimitAction::Disconnect)
+            {
+                ProcessDisconnect(session);
+                return false;
+            }
+
+            if (mConfig.mOverloadShedAction == RateLimitAction::Pause)
+            {
+                // 읽지 않고 멈춤 (데이터는 커널 버퍼에 남음, 과부하가 끝났는지는 주기적으로 다시 확인)
+                PauseReading(session, NetworkMetrics::Now() + static_cast<int64_t>(LoadMonitor::SHED_RECHECK_MS) * 1000000);
+                return false;
+            }
+
+            // Drop: 읽어서 버림
+            shed = true;
+        }
+
+        const uint32_t maxBytes = mConfig.mReadBudgetBytes;
+        const uint32_t maxCount = mConfig.mReadBudgetCount;
+        size_t totalBytes = 0;
+        uint32_t readCount = 0;
+
+        // Edge-Triggered 모드에서는 버퍼가 빌 때까지 읽어야 함 (예산을 다 쓰면 호출자가 다음 회차에 이어 읽게 함)
         while (true)
         {
             ssize_t bytesRead = recv(session->GetSocket(), 
-                                     mReceiveBuffer, 
-                                     sizeof(mReceiveBuffer), 
+                                     tReceiveBuffer, 
+                                     sizeof(tReceiveBuffer), 
                                      0);
 
             if (bytesRead > 0)
             {
                 // 데이터 수신 성공
-                if (mOnReceive)
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::ReceiveOps);
+                    mMetrics->Add(MetricCounter::BytesReceived, static_cast<uint64_t>(bytesRead));
+                }
+
+                // 수신 속도 제한 (세션 수신은 한 스레드만 처리하므로 버킷은 락 없이 갱신)
+                bool deliver = !shed;
+                bool overLimit = false;
+                if (mRateLimited &&
+                    !session->ConsumeReceiveRate(static_cast<size_t>(bytesRead), NetworkMetrics::Now(), mConfig.mRateLimitAction))
+                {
+                    if (mConfig.mRateLimitAction == RateLimitAction::Disconnect)
+                    {
+                        LOG_WARNING("Receive rate limit exceeded. Disconnecting SessionID: %llu", session->GetID());
+                        if (mMetrics)
+                        {
+                            mMetrics->Add(MetricCounter::RateLimitDisconnects);
+                        }
+                        ProcessDisconnect(session);
+                        return false;
+                    }
+
+                    if (mConfig.mRateLimitAction == RateLimitAction::Drop)
+                    {
+                        if (mMetrics)
+                        {
+                            mMetrics->Add(MetricCounter::RateLimitDrops);
+                        }
+                        deliver = false;
+                    }
+                    else
+                    {
+                        // Pause: 이미 읽은 데이터는 넘기고 읽기를 멈춤
+                        overLimit = true;
+                    }
+                }
+
+                if (deliver && mOnReceive)
+                {
+                    if (mMetrics)
+                    {
+                        int64_t start = NetworkMetrics::Now();
+                        mOnReceive(session, tReceiveBuffer, bytesRead);
+                        mMetrics->Record(MetricHistogram::ReceiveCallback, NetworkMetrics::Now() - start);
+                    }
+                    else
+                    {
+                        mOnReceive(session, tReceiveBuffer, bytesRead);
+                    }
+                }
+
+                if (overLimit)
                 {
-                    mOnReceive(session, mReceiveBuffer, bytesRead);
+                    if (mMetrics)
+                    {
+                        mMetrics->Add(MetricCounter::RateLimitPauses);
+                    }
+                    PauseReading(session, session->GetReadResumeTime());
+                    return false;
+                }
+
+                // 한 세션이 I/O 스레드를 독점하지 않도록 예산 확인
+                totalBytes += static_cast<size_t>(bytesRead);
+                ++readCount;
+                if ((maxBytes != 0 && totalBytes >= maxBytes) || (maxCount != 0 && readCount >= maxCount))
+                {
+                    if (!session->IsConnected())
+                    {
+                        return false;
+                    }
+
+                    if (mMetrics)
+                    {
+                        mMetrics->Add(MetricCounter::ReadBudgetExhausted);
+                    }
+                    return true;
                 }
             }
             else if (bytesRead == 0)
@@ -367,6 +1045,102 @@ namespace KanchoNet
                 break;
             }
         }
+
+        return false;
+    }
+
+    void EpollModel::QueueReadable(Session* session)
+    {
+        SpinLockGuard lock(mReadableLock);
+        if (session->IsReadBacklogged())
+        {
+            return;
+        }
+
+        // 목록에 있는 동안 세션이 제거되어도 슬롯이 재사용되지 않도록 참조 유지
+        session->SetReadBacklogged(true);
+        session->AddRef();
+        mReadableSessions.push_back(session);
+    }
+
+    void EpollModel::ProcessReadable(std::vector<Session*>& sessions)
+    {
+        // 목록 순서대로 한 번씩 (예산을 또 다 쓴 세션은 목록 끝으로 돌아가 다음 회차에 다시 읽음)
+        for (Session* session : sessions)
+        {
+            if (mRunning && ProcessReceive(session))
+            {
+                QueueReadable(session);
+            }
+            mSessionManager->ReleaseSession(session);
+        }
+        sessions.clear();
+    }
+
+    void EpollModel::PauseReading(Session* session, int64_t resumeTime)
+    {
+        {
+            SpinLockGuard lock(session->GetLock());
+            if (!session->IsConnected())
+            {
+                return;
+            }
+
+            // EPOLLIN을 빼고 재등록 (EPOLLONESHOT 모드에서 디스패치 중이면 디스패치를 마칠 때 EPOLLIN 없이 재등록됨)
+            session->SetReadPaused(true);
+            UpdateInterest(session);
+        }
+
+        {
+            SpinLockGuard lock(mPausedLock);
+
+            // 목록에 있는 동안 세션이 제거되어도 슬롯이 재사용되지 않도록 참조 유지
+            session->AddRef();
+            mPausedSessions.emplace_back(resumeTime, session);
+            if (resumeTime < mNextResumeTime.load(std::memory_order_relaxed))
+            {
+                mNextResumeTime.store(resumeTime, std::memory_order_release);
+            }
+        }
+    }
+
+    void EpollModel::ResumePausedSessions(int64_t now)
+    {
+        std::vector<Session*> resumed;
+        {
+            SpinLockGuard lock(mPausedLock);
+
+            int64_t nextTime = INT64_MAX;
+            size_t kept = 0;
+            for (auto& paused : mPausedSessions)
+            {
+                if (paused.first <= now)
+                {
+                    resumed.push_back(paused.second);
+                }
+                else
+                {
+                    nextTime = std::min(nextTime, paused.first);
+                    mPausedSessions[kept++] = paused;
+                }
+            }
+            mPausedSessions.resize(kept);
+            mNextResumeTime.store(nextTime, std::memory_order_release);
+        }
+
+        // EPOLLIN을 다시 등록하면 커널에 남아있던 데이터가 있을 때 바로 읽기 이벤트가 옴
+        for (Session* session : resumed)
+        {
+            {
+                SpinLockGuard lock(session->GetLock());
+                if (session->IsConnected())
+                {
+                    session->SetReadPaused(false);
+                    UpdateInterest(session);
+                }
+            }
+            mSessionManager->ReleaseSession(session);
+        }
     }
 
     void EpollModel::ProcessSend(Session* session)
@@ -376,8 +1150,28 @@ namespace KanchoNet
             return;
         }
 
-        SpinLockGuard lock(session->GetLock());
+        bool connected;
+        {
+            SpinLockGuard lock(session->GetLock());
+
+            // 같은 이벤트의 수신 처리에서 이미 연결이 종료된 경우 (소켓이 닫혔으므로 송신하지 않음)
+            if (!session->IsConnected())
+            {
+                return;
+            }
+
+            connected = mConfig.mUseSendChain ? FlushSendChain(session) : FlushSendBuffer(session);
+        }
+
+        // 연결 종료는 세션 락을 놓은 뒤 처리 (ProcessDisconnect가 같은 락을 잡음)
+        if (!connected)
+        {
+            ProcessDisconnect(session);
+        }
+    }
 
+    bool EpollModel::FlushSendBuffer(Session* session)
+    {
         // Edge-Triggered 모드에서는 버퍼가 빌 때까지 쓰기
         while (true)
         {
@@ -386,9 +1180,10 @@ namespace KanchoNet
             {
                 // 더 이상 보낼 데이터가 없음
                 session->SetSending(false);
+                RecordSendQueueResidency(session);
                 // EPOLLOUT 제거
-                ModifySocket(session->GetSocket(), EPOLLIN | EPOLLET);
-                break;
+                UpdateInterest(session);
+                return true;
             }
 
             // 버퍼에서 데이터 읽기
@@ -401,26 +1196,129 @@ namespace KanchoNet
             {
                 // 송신 성공
                 session->GetSendBuffer().Skip(bytesSent);
+                mLoadMonitor.AddSendBacklog(-static_cast<int64_t>(bytesSent));
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::SendOps);
+                    mMetrics->Add(MetricCounter::BytesSent, static_cast<uint64_t>(bytesSent));
+                }
             }
             else if (bytesSent == 0)
             {
                 // 연결 종료
-                ProcessDisconnect(session);
-                break;
+                return false;
             }
             else
             {
                 if (errno == EAGAIN || errno == EWOULDBLOCK)
                 {
                     // 더 이상 쓸 수 없음, 나중에 EPOLLOUT 이벤트로 재시도
-                    break;
+                    return true;
                 }
                 
                 // 에러
                 LOG_ERROR("send failed. SessionID: %llu, Error: %d", 
                          session->GetID(), SocketUtils::GetLastSocketError());
-                ProcessDisconnect(session);
-                break;
+                return false;
+            }
+        }
+    }
+
+    void EpollModel::RequestSend(Session* session)
+    {
+        // 소켓을 쓰기 가능 이벤트로 등록
+        if (!session->IsSending())
+        {
+            session->SetSending(true);
+            if (mMetrics)
+            {
+                session->SetSendQueuedTime(NetworkMetrics::Now());
+            }
+            UpdateInterest(session);
+        }
+    }
+
+    uint32_t EpollModel::GetSessionInterest(Session* session) const
+    {
+        uint32_t events = EPOLLET;
+        if (!session->IsReadPaused())
+        {
+            events |= EPOLLIN;
+        }
+        if (session->IsSending())
+        {
+            events |= EPOLLOUT;
+        }
+        if (mConfig.mEpollOneShot)
+        {
+            events |= EPOLLONESHOT;
+        }
+        return events;
+    }
+
+    void EpollModel::UpdateInterest(Session* session)
+    {
+        if (session->IsDispatching())
+        {
+            return;
+        }
+
+        ModifySocket(session, GetSessionInterest(session));
+    }
+
+    bool EpollModel::FlushSendChain(Session* session)
+    {
+        SendChain& sendChain = session->GetSendChain();
+        struct iovec iov[SendChain::MAX_IOV_COUNT];
+
+        // Edge-Triggered 모드에서는 큐가 빌 때까지 쓰기 (한 번에 최대 IOV_MAX개 세그먼트)
+        while (true)
+        {
+            size_t iovCount = sendChain.FillIOVec(iov, SendChain::MAX_IOV_COUNT);
+            if (iovCount == 0)
+            {
+                // 더 이상 보낼 데이터가 없음
+                session->SetSending(false);
+                RecordSendQueueResidency(session);
+                // EPOLLOUT 제거
+                UpdateInterest(session);
+                return true;
+            }
+
+            struct msghdr msg = {};
+            msg.msg_iov = iov;
+            msg.msg_iovlen = iovCount;
+
+            ssize_t bytesSent = sendmsg(session->GetSocket(), &msg, MSG_NOSIGNAL);
+
+            if (bytesSent > 0)
+            {
+                // 송신 완료된 세그먼트 해제
+                sendChain.Consume(static_cast<size_t>(bytesSent));
+                mLoadMonitor.AddSendBacklog(-static_cast<int64_t>(bytesSent));
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::SendOps);
+                    mMetrics->Add(MetricCounter::BytesSent, static_cast<uint64_t>(bytesSent));
+                }
+            }
+            else if (bytesSent == 0)
+            {
+                // 연결 종료
+                return false;
+            }
+            else
+            {
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                {
+                    // 더 이상 쓸 수 없음, 나중에 EPOLLOUT 이벤트로 재시도
+                    return true;
+                }
+
+                // 에러
+                LOG_ERROR("sendmsg failed. SessionID: %llu, Error: %d", 
+                         session->GetID(), SocketUtils::GetLastSocketError());
+                return false;
             }
         }
     }
@@ -432,12 +1330,26 @@ namespace KanchoNet
             return;
         }
 
-        if (session->IsDisconnected())
         {
-            return;
+            // 송신 스레드(태스크 워커 등)가 상태를 확인하는 락과 같은 락으로 전환
+            SpinLockGuard lock(session->GetLock());
+            if (session->IsDisconnected())
+            {
+                return;
+            }
+
+            session->SetState(SessionState::Disconnected);
+
+            // 보내지 못하고 버리는 송신 큐 (이후의 Send/송신 처리는 연결 상태를 보고 건너뜀)
+            mLoadMonitor.AddSendBacklog(-static_cast<int64_t>(mConfig.mUseSendChain
+                ? session->GetSendChain().GetTotalBytes()
+                : session->GetSendBuffer().GetAvailableRead()));
         }
 
-        session->SetState(SessionState::Disconnected);
+        if (mMetrics)
+        {
+            mMetrics->Add(MetricCounter::Disconnects);
+        }
 
         // Disconnect 콜백 호출
         if (mOnDisconnect)
@@ -449,7 +1361,6 @@ namespace KanchoNet
 
         // 소켓 제거
         SocketHandle socket = session->GetSocket();
-        mSocketToSession.erase(socket);
         UnregisterSocket(socket);
         SocketUtils::CloseSocket(socket);
 
@@ -457,12 +1368,79 @@ namespace KanchoNet
         mSessionManager->RemoveSession(session->GetID());
     }
 
+    void EpollModel::ProcessMetricsEvent(const struct epoll_event& ev)
+    {
+        SocketHandle socket = static_cast<SocketHandle>(ev.data.u64 >> 1);
+
+        if (socket == mMetricsServer->GetListenSocket())
+        {
+            // 연결 소켓은 EPOLLONESHOT으로 등록해 한 번에 한 스레드만 처리
+            SocketHandle client;
+            while ((client = mMetricsServer->Accept()) != INVALID_SOCKET_HANDLE)
+            {
+                if (!ArmMetricsSocket(client, MetricsHttpServer::EVENT_READ, EPOLL_CTL_ADD))
+                {
+                    mMetricsServer->HandleEvent(client, MetricsHttpServer::EVENT_ERROR);
+                }
+            }
+            return;
+        }
+
+        uint32_t events = 0;
+        if (ev.events & EPOLLIN)
+        {
+            events |= MetricsHttpServer::EVENT_READ;
+        }
+        if (ev.events & EPOLLOUT)
+        {
+            events |= MetricsHttpServer::EVENT_WRITE;
+        }
+        if (ev.events & EPOLLERR)
+        {
+            events |= MetricsHttpServer::EVENT_ERROR;
+        }
+
+        // 0이면 연결이 닫혔으므로 (close가 epoll에서 자동 제거) 다시 등록하지 않음
+        uint32_t interest = mMetricsServer->HandleEvent(socket, events);
+        if (interest != 0 && !ArmMetricsSocket(socket, interest, EPOLL_CTL_MOD))
+        {
+            mMetricsServer->HandleEvent(socket, MetricsHttpServer::EVENT_ERROR);
+        }
+    }
+
+    bool EpollModel::ArmMetricsSocket(SocketHandle socket, uint32_t interest, int op)
+    {
+        struct epoll_event ev;
+        ev.events = EPOLLONESHOT;
+        ev.events |= (interest & MetricsHttpServer::EVENT_READ) ? static_cast<uint32_t>(EPOLLIN) : 0u;
+        ev.events |= (interest & MetricsHttpServer::EVENT_WRITE) ? static_cast<uint32_t>(EPOLLOUT) : 0u;
+        ev.data.u64 = (static_cast<uint64_t>(socket) << 1) | METRICS_EVENT_TAG;
+
+        if (epoll_ctl(mEpollFd, op, socket, &ev) < 0)
+        {
+            LOG_ERROR("Failed to arm metrics socket in epoll. Error: %d",
+                     SocketUtils::GetLastSocketError());
+            return false;
+        }
+
+        return true;
+    }
+
+    void EpollModel::RecordSendQueueResidency(Session* session)
+    {
+        if (mMetrics && session->GetSendQueuedTime() != 0)
+        {
+            mMetrics->Record(MetricHistogram::SendQueueResidency,
+                             NetworkMetrics::Now() - session->GetSendQueuedTime());
+            session->SetSendQueuedTime(0);
+        }
+    }
+
     bool EpollModel::RegisterSocket(SocketHandle socket, Session* session, uint32_t events)
     {
         struct epoll_event ev;
         ev.events = events;
         ev.data.ptr = session;
-        ev.data.fd = socket;
 
         if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, socket, &ev) < 0)
         {
@@ -474,20 +1452,13 @@ namespace KanchoNet
         return true;
     }
 
-    bool EpollModel::ModifySocket(SocketHandle socket, uint32_t events)
+    bool EpollModel::ModifySocket(Session* session, uint32_t events)
     {
-        auto it = mSocketToSession.find(socket);
-        if (it == mSocketToSession.end())
-        {
-            return false;
-        }
-
         struct epoll_event ev;
         ev.events = events;
-        ev.data.ptr = it->second;
-        ev.data.fd = socket;
+        ev.data.ptr = session;
 
-        if (epoll_ctl(mEpollFd, EPOLL_CTL_MOD, socket, &ev) < 0)
+        if (epoll_ctl(mEpollFd, EPOLL_CTL_MOD, session->GetSocket(), &ev) < 0)
         {
             LOG_ERROR("Failed to modify socket in epoll. Error: %d", 
                      SocketUtils::GetLastSocketError());
@@ -517,7 +1488,6 @@ namespace KanchoNet
         }
 
         SocketHandle socket = session->GetSocket();
-        mSocketToSession.erase(socket);
         UnregisterSocket(socket);
         SocketUtils::ShutdownSocket(socket);
         SocketUtils::CloseSocket(socket);
@@ -7,11 +7,16 @@
 
 #include "../Core/INetworkModel.h"
 #include "../Session/SessionManager.h"
+#include "../Metrics/MetricsHttpServer.h"
+#include "../Metrics/LoadMonitor.h"
 #include "../Utils/NonCopyable.h"
+#include "../Utils/SpinLock.h"
+#include "../Utils/RateLimiter.h"
 #include <sys/epoll.h>
+#include <atomic>
 #include <functional>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 namespace KanchoNet
 {
@@ -25,23 +30,50 @@ namespace KanchoNet
         // private 멤버변수
         bool mInitialized;
         bool mRunning;
+        std::atomic<bool> mAccepting;   // StopAccepting 전까지 true (다른 스레드에서 내릴 수 있음)
+        std::atomic<bool> mAcceptPaused;    // 과부하로 수락을 잠시 멈춤 (회복하면 다시 등록)
+        SpinLock mAcceptLock;               // 리슨 소켓 등록/제거 (StopAccepting과 과부하 전환이 겹치지 않도록)
         
         EngineConfig mConfig;
         SocketHandle mListenSocket;
         int mEpollFd;
         
         std::unique_ptr<SessionManager> mSessionManager;
-        std::unordered_map<SocketHandle, Session*> mSocketToSession;
+        std::unique_ptr<NetworkMetrics> mMetrics;   // EngineConfig::mEnableMetrics가 false면 nullptr
+        std::unique_ptr<MetricsHttpServer> mMetricsServer;  // EngineConfig::mMetricsPort가 0이면 nullptr
+
+        // 읽기 예산을 다 써서 다음 ProcessIO 회차에 이어 읽을 세션 (세션마다 참조 1 보유, EPOLLONESHOT 모드에서는 사용하지 않음)
+        SpinLock mReadableLock;
+        std::vector<Session*> mReadableSessions;
+
+        // 수신 속도 제한 (EngineConfig::mRateLimit*)
+        bool mRateLimited;                          // 세션 바이트/횟수 한도 중 하나라도 사용
+        TokenBucket mByteLimit;                     // 수락한 세션에 복사해 넣을 버킷
+        TokenBucket mMessageLimit;
+        KeyedRateLimiter mConnectionLimiter;        // 출발지 IP별 연결 한도
+
+        // 한도를 넘어 읽기를 멈춘 세션과 다시 읽을 시각 (세션마다 참조 1 보유)
+        SpinLock mPausedLock;
+        std::vector<std::pair<int64_t, Session*>> mPausedSessions;
+        std::atomic<int64_t> mNextResumeTime;       // 목록에서 가장 이른 시각 (비어있으면 INT64_MAX, 락 없이 확인용)
+
+        // 과부하 감지 (EngineConfig::mOverload*)
+        LoadMonitor mLoadMonitor;
         
         // 콜백 함수들
         std::function<void(Session*)> mOnAccept;
         std::function<void(Session*, const uint8_t*, size_t)> mOnReceive;
         std::function<void(Session*)> mOnDisconnect;
         std::function<void(Session*, ErrorCode)> mOnError;
+        std::function<void(const LoadSnapshot&)> mOnOverload;
         
+        // 메트릭 엔드포인트 소켓 표시 (epoll data의 최하위 비트, 나머지 비트는 fd)
+        // 세션 포인터는 캐시 라인 정렬이므로 최하위 비트가 항상 0
+        static constexpr uint64_t METRICS_EVENT_TAG = 1;
+
         // 버퍼
         static constexpr size_t MAX_EVENTS = 128;
-        uint8_t mReceiveBuffer[DEFAULT_BUFFER_SIZE];
+        static constexpr size_t ACCEPT_BATCH = 32;  // 세션 매니저 락 한 번에 추가하는 최대 연결 수
         
     public:
         // 생성자, 파괴자
@@ -55,13 +87,23 @@ namespace KanchoNet
         bool StartListen() override;
         bool ProcessIO(uint32_t timeoutMs = 0) override;
         bool Send(Session* session, const PacketBuffer& buffer) override;
+        bool SendShared(Session* session, const SharedPacketBuffer* packets, size_t count) override;
+        RingBuffer* BeginSend(Session* session) override;
+        void EndSend(Session* session, size_t bytes) override;
         void Shutdown() override;
+        bool StopAccepting() override;
+        SocketHandle GetListenSocket() const override { return mListenSocket; }
+        const NetworkMetrics* GetMetrics() const override { return mMetrics.get(); }
+        MetricsHttpServer* GetMetricsServer() override { return mMetricsServer.get(); }
+        SessionManager* GetSessionManager() override { return mSessionManager.get(); }
+        LoadSnapshot GetLoad() const override { return mLoadMonitor.GetSnapshot(); }
 
         // 콜백 설정
         void SetAcceptCallback(std::function<void(Session*)> callback) override;
         void SetReceiveCallback(std::function<void(Session*, const uint8_t*, size_t)> callback) override;
         void SetDisconnectCallback(std::function<void(Session*)> callback) override;
         void SetErrorCallback(std::function<void(Session*, ErrorCode)> callback) override;
+        void SetOverloadCallback(std::function<void(const LoadSnapshot&)> callback) override;
 
         // 상태 확인
         bool IsInitialized() const { return mInitialized; }
@@ -69,15 +111,66 @@ namespace KanchoNet
 
     private:
         // private 함수
+        // 이벤트 대기 (바쁜 대기 모드면 timeout 0으로 회전하다가 유휴 시간이 지나면 남은 시간 동안 잠듦)
+        int WaitEvents(struct epoll_event* events, int timeoutMs);
+
+        // 리슨 소켓을 epoll에 등록 (시작할 때, 과부하에서 회복할 때)
+        bool RegisterListenSocket();
+
+        // 과부하 진입/회복에 따라 리슨 소켓 제거/재등록 (StopAccepting으로 멈췄으면 재등록하지 않음)
+        void SetAcceptPaused(bool paused);
+
+        // ProcessIO 한 회차의 부하 기록 (과부하 상태가 바뀌면 수락 중지/재개 후 콜백 호출)
+        void RecordLoad(int64_t wakeTime, uint32_t readyDepth);
+
         // epoll 이벤트 처리
         void ProcessAccept();
-        void ProcessReceive(Session* session);
+        void AcceptSession(Session* session);
+
+        // 세션 이벤트 처리 (에러/종료 -> 수신 -> 송신 순)
+        void DispatchEvents(Session* session, uint32_t events);
+
+        // EPOLLONESHOT 모드: 다른 스레드가 처리 중이면 이벤트만 넘기고, 아니면 처리 후 재등록
+        void DispatchOneShot(Session* session, uint32_t events);
+
+        // 반환값: 읽기 예산을 다 써서 읽을 데이터가 남았을 수 있는지
+        bool ProcessReceive(Session* session);
+
+        // 읽기 대기 목록 추가 / 지난 회차에 목록에 들어간 세션 이어 읽기
+        void QueueReadable(Session* session);
+        void ProcessReadable(std::vector<Session*>& sessions);
         void ProcessSend(Session* session);
         void ProcessDisconnect(Session* session);
+
+        // 수신 속도 제한/과부하 제한: 읽기를 멈추고(EPOLLIN 제거) 목록에 추가 / 시각이 된 세션의 EPOLLIN 재등록
+        void PauseReading(Session* session, int64_t resumeTime);
+        void ResumePausedSessions(int64_t now);
+
+        // 메트릭 엔드포인트 소켓 이벤트 처리 (리슨 소켓 accept 또는 HTTP 연결 처리)
+        void ProcessMetricsEvent(const struct epoll_event& ev);
+        bool ArmMetricsSocket(SocketHandle socket, uint32_t interest, int op);
+
+        // 송신 요청 (EPOLLOUT 등록, 세션 락을 잡은 상태에서 호출)
+        void RequestSend(Session* session);
+
+        // 세션 소켓의 관심 이벤트 (EPOLLIN, 송신 대기 중이면 EPOLLOUT, 모드에 따라 EPOLLONESHOT)
+        uint32_t GetSessionInterest(Session* session) const;
+
+        // 관심 이벤트 갱신 (세션 락을 잡은 상태에서 호출)
+        // 디스패치 중이면 건너뜀 (디스패치를 마치는 스레드가 최종 상태로 재등록)
+        void UpdateInterest(Session* session);
+
+        // 송신 버퍼/세그먼트 송신 큐를 소켓으로 전송 (세션 락을 잡은 상태에서 호출)
+        // 반환값: 연결 유지 여부 (false면 호출자가 락을 놓은 뒤 ProcessDisconnect)
+        bool FlushSendBuffer(Session* session);
+        bool FlushSendChain(Session* session);
+        
+        // 송신 큐가 비었을 때 체류 시간 기록 (세션 락을 잡은 상태에서 호출)
+        void RecordSendQueueResidency(Session* session);
         
         // 소켓 등록/제거
         bool RegisterSocket(SocketHandle socket, Session* session, uint32_t events);
-        bool ModifySocket(SocketHandle socket, uint32_t events);
+        bool ModifySocket(Session* session, uint32_t events);
         bool UnregisterSocket(SocketHandle socket);
         
         // 세션 관리
@@ -51,6 +51,7 @@ namespace KanchoNet
         bool ProcessIO(uint32_t timeoutMs = 0) override;
         bool Send(Session* session, const PacketBuffer& buffer) override;
         void Shutdown() override;
+        SessionManager* GetSessionManager() override { return mSessionManager.get(); }
 
         // 콜백 설정
         void SetAcceptCallback(std::function<void(Session*)> callback) override;
@@ -5,7 +5,9 @@
 #include "SocketUtils.h"
 #include "../Utils/Logger.h"
 #include <unistd.h>
+#include <poll.h>
 #include <cstring>
+#include <algorithm>
 
 namespace KanchoNet
 {
@@ -15,8 +17,16 @@ namespace KanchoNet
     IOUringModel::IOUringModel()
         : mInitialized(false)
         , mRunning(false)
+        , mAccepting(false)
+        , mAcceptContext(nullptr)
+        , mAcceptCancelSubmitted(false)
+        , mAcceptPaused(false)
         , mListenSocket(INVALID_SOCKET_HANDLE)
         , mRingInitialized(false)
+        , mReadRound(0)
+        , mRateLimited(false)
+        , mNextResumeTime(INT64_MAX)
+        , mLastActivityTime(0)
     {
         memset(&mRing, 0, sizeof(mRing));
     }
@@ -47,6 +57,16 @@ namespace KanchoNet
 
         mConfig = config;
 
+        // 수신 속도 제한
+        mByteLimit.Configure(mConfig.mRateLimitBytesPerSec, mConfig.mRateLimitBytesBurst);
+        mMessageLimit.Configure(mConfig.mRateLimitMessagesPerSec, mConfig.mRateLimitMessagesBurst);
+        mConnectionLimiter.Configure(mConfig.mRateLimitConnectionsPerSec, mConfig.mRateLimitConnectionsBurst);
+        mRateLimited = mByteLimit.IsEnabled() || mMessageLimit.IsEnabled();
+
+        // 과부하 감지
+        mLoadMonitor.Configure(mConfig.mOverloadLoopLagUs, mConfig.mOverloadReadyDepth, mConfig.mOverloadSendBacklogBytes,
+                               mConfig.mOverloadRecoverPercent, mConfig.mOverloadHoldMs);
+
         // 네트워크 초기화
         if (!SocketUtils::InitializeNetwork())
         {
@@ -60,30 +80,65 @@ namespace KanchoNet
             return false;
         }
 
-        // 리슨 소켓 생성
-        mListenSocket = SocketUtils::CreateTCPSocket();
-        if (mListenSocket == INVALID_SOCKET_HANDLE)
+        if (mConfig.mInheritedListenSocket != INVALID_SOCKET_HANDLE)
         {
-            io_uring_queue_exit(&mRing);
-            SocketUtils::CleanupNetwork();
-            return false;
+            // 이전 프로세스가 넘긴 리슨 소켓 (옵션/bind/listen은 이전 프로세스에서 이미 적용됨)
+            mListenSocket = mConfig.mInheritedListenSocket;
+            SocketUtils::SetNonBlocking(mListenSocket, true);
+            LOG_INFO("Using inherited listen socket. Socket: %d", mListenSocket);
         }
+        else
+        {
+            // 리슨 소켓 생성
+            mListenSocket = SocketUtils::CreateTCPSocket();
+            if (mListenSocket == INVALID_SOCKET_HANDLE)
+            {
+                io_uring_queue_exit(&mRing);
+                SocketUtils::CleanupNetwork();
+                return false;
+            }
 
-        // 소켓 옵션 설정
-        SocketUtils::SetSocketOption(mListenSocket, mConfig);
-        SocketUtils::SetNonBlocking(mListenSocket, true);
+            // 소켓 옵션 설정
+            SocketUtils::SetSocketOption(mListenSocket, mConfig);
+            SocketUtils::SetListenOption(mListenSocket, mConfig);
+            SocketUtils::SetNonBlocking(mListenSocket, true);
 
-        // 소켓 바인드
-        if (!SocketUtils::BindSocket(mListenSocket, mConfig.mPort))
-        {
-            SocketUtils::CloseSocket(mListenSocket);
-            io_uring_queue_exit(&mRing);
-            SocketUtils::CleanupNetwork();
-            return false;
+            // 소켓 바인드
+            if (!SocketUtils::BindSocket(mListenSocket, mConfig.mPort))
+            {
+                SocketUtils::CloseSocket(mListenSocket);
+                io_uring_queue_exit(&mRing);
+                SocketUtils::CleanupNetwork();
+                return false;
+            }
         }
 
         // 세션 매니저 생성
-        mSessionManager = std::make_unique<SessionManager>(mConfig.mMaxSessions);
+        mSessionManager = std::make_unique<SessionManager>(mConfig.mMaxSessions, mConfig.mBufferArenaSize, mConfig.mArenaHugePages);
+
+        // 메트릭
+        if (mConfig.mEnableMetrics)
+        {
+            mMetrics = std::make_unique<NetworkMetrics>();
+        }
+
+        // 메트릭 HTTP 엔드포인트 (같은 링에서 poll 요청으로 처리)
+        if (mConfig.mMetricsPort != 0)
+        {
+            mMetricsServer = std::make_unique<MetricsHttpServer>();
+            if (!mMetricsServer->Open(mConfig.mMetricsBindAddress, mConfig.mMetricsPort, 16))
+            {
+                mMetricsServer.reset();
+                mMetrics.reset();
+                mSessionManager.reset();
+                SocketUtils::CloseSocket(mListenSocket);
+                io_uring_queue_exit(&mRing);
+                mRingInitialized = false;
+                SocketUtils::CleanupNetwork();
+                return false;
+            }
+            mMetricsServer->SetSources("io_uring", mMetrics.get(), mSessionManager.get());
+        }
 
         mInitialized = true;
         LOG_INFO("IOUringModel initialized successfully. Port: %u", mConfig.mPort);
@@ -112,7 +167,17 @@ namespace KanchoNet
         }
 
         // Accept 요청 제출
+        mAccepting.store(true, std::memory_order_release);
+        mAcceptCancelSubmitted = false;
+        mAcceptPaused = false;
         if (!SubmitAccept())
+        {
+            mAccepting.store(false, std::memory_order_release);
+            return false;
+        }
+
+        // 메트릭 리슨 소켓 대기
+        if (mMetricsServer && !SubmitMetricsPoll(mMetricsServer->GetListenSocket(), MetricsHttpServer::EVENT_READ))
         {
             return false;
         }
@@ -130,26 +195,55 @@ namespace KanchoNet
             return false;
         }
 
-        struct __kernel_timespec ts;
-        ts.tv_sec = timeoutMs / 1000;
-        ts.tv_nsec = (timeoutMs % 1000) * 1000000;
-
         struct io_uring_cqe* cqe;
         int ret;
 
-        if (timeoutMs > 0)
+        // 수락을 중지했으면 대기 중인 Accept 요청 취소 (링은 ProcessIO 스레드에서만 다룸)
+        if (mAcceptContext && !mAcceptCancelSubmitted && (mAcceptPaused || !mAccepting.load(std::memory_order_acquire)))
         {
-            ret = io_uring_wait_cqe_timeout(&mRing, &cqe, &ts);
+            SubmitAcceptCancel();
+        }
+
+        // 수신 예산 회차 (지난 회차에 예산을 다 쓴 세션이 있으면 기다리지 않음)
+        ++mReadRound;
+
+        // 속도 제한으로 미룬 수신은 시각이 되면 등록 (그 시각을 넘겨 잠들지 않음)
+        if (mNextResumeTime != INT64_MAX)
+        {
+            const int64_t now = NetworkMetrics::Now();
+            if (mNextResumeTime <= now)
+            {
+                ResumePausedSessions(now);
+            }
+            else if (timeoutMs > 0)
+            {
+                timeoutMs = static_cast<uint32_t>(std::min<int64_t>(timeoutMs, (mNextResumeTime - now + 999999) / 1000000));
+            }
+        }
+
+        if (timeoutMs > 0 && mReadableSessions.empty())
+        {
+            ret = WaitCompletion(&cqe, timeoutMs);
         }
         else
         {
             ret = io_uring_peek_cqe(&mRing, &cqe);
         }
 
+        // 부하 측정: 깨어난 시각부터 회차를 마칠 때까지의 시간과 이번 회차에 처리할 준비 항목 수
+        const bool monitorLoad = mLoadMonitor.IsEnabled();
+        const int64_t wakeTime = monitorLoad ? NetworkMetrics::Now() : 0;
+        const size_t readableCount = mReadableSessions.size();
+
         if (ret < 0)
         {
             if (ret == -ETIME || ret == -EAGAIN)
             {
+                ProcessReadable();
+                if (monitorLoad)
+                {
+                    RecordLoad(wakeTime, static_cast<uint32_t>(readableCount));
+                }
                 return true; // 타임아웃은 에러가 아님
             }
             LOG_ERROR("io_uring_wait_cqe failed. Error: %d", -ret);
@@ -160,11 +254,11 @@ namespace KanchoNet
         unsigned head;
         unsigned count = 0;
         
+        // 완료 항목은 루프가 끝난 뒤 한 번에 반환 (io_uring_cqe_seen과 함께 쓰면 두 번 전진함)
         io_uring_for_each_cqe(&mRing, head, cqe)
         {
             ++count;
             ProcessCompletion(cqe);
-            io_uring_cqe_seen(&mRing, cqe);
         }
 
         if (count > 0)
@@ -172,9 +266,65 @@ namespace KanchoNet
             io_uring_cq_advance(&mRing, count);
         }
 
+        ProcessReadable();
+
+        if (mMetrics)
+        {
+            mMetrics->Add(MetricCounter::PollWakeups);
+            mMetrics->Add(MetricCounter::PollEvents, count);
+        }
+
+        if (monitorLoad)
+        {
+            RecordLoad(wakeTime, static_cast<uint32_t>(count + readableCount));
+        }
+
         return true;
     }
 
+    void IOUringModel::RecordLoad(int64_t wakeTime, uint32_t readyDepth)
+    {
+        const int64_t now = NetworkMetrics::Now();
+        LoadSnapshot load;
+        if (!mLoadMonitor.RecordCycle(now - wakeTime, readyDepth, now, load))
+        {
+            return;
+        }
+
+        mAcceptPaused = load.mOverloaded;
+        if (load.mOverloaded)
+        {
+            LOG_WARNING("Overloaded. Stop accepting. Loop lag: %lld us, Ready depth: %u, Send backlog: %lld bytes",
+                       static_cast<long long>(load.mLoopLagNs / 1000), load.mReadyDepth,
+                       static_cast<long long>(load.mSendBacklogBytes));
+            if (mMetrics)
+            {
+                mMetrics->Add(MetricCounter::Overloads);
+            }
+
+            // 대기 중인 Accept 요청 취소 (남은 연결은 리슨 소켓 큐에 두었다가 회복하면 수락)
+            if (mAcceptContext && !mAcceptCancelSubmitted)
+            {
+                SubmitAcceptCancel();
+            }
+        }
+        else
+        {
+            LOG_INFO("Recovered from overload. Resume accepting");
+
+            // 취소가 아직 완료되지 않았으면 완료 처리에서 다시 제출
+            if (!mAcceptContext && mAccepting.load(std::memory_order_acquire))
+            {
+                SubmitAccept();
+            }
+        }
+
+        if (mOnOverload)
+        {
+            mOnOverload(load);
+        }
+    }
+
     bool IOUringModel::Send(Session* session, const PacketBuffer& buffer)
     {
         if (!session || buffer.IsEmpty())
@@ -183,15 +333,111 @@ namespace KanchoNet
         }
 
         SpinLockGuard lock(session->GetLock());
+
+        // 종료 처리와 같은 락 안에서 확인 (닫힌 소켓 번호가 재사용된 뒤 잘못 등록하는 것 방지)
+        if (!session->IsConnected())
+        {
+            return false;
+        }
         
-        // 송신 버퍼에 데이터 추가
-        size_t written = session->GetSendBuffer().Write(buffer.GetData(), buffer.GetSize());
-        if (written < buffer.GetSize())
+        if (mConfig.mUseSendChain)
+        {
+            // 세그먼트 송신 큐에 복사 (작은 패킷은 마지막 세그먼트에 이어붙임)
+            if (!session->GetSendChain().Append(buffer.GetData(), buffer.GetSize()))
+            {
+                LOG_WARNING("Send queue overflow. SessionID: %llu", session->GetID());
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::SendOverflows);
+                }
+                return false;
+            }
+        }
+        else
+        {
+            // 송신 버퍼에 데이터 추가
+            size_t written = session->GetSendBuffer().Write(buffer.GetData(), buffer.GetSize());
+            if (written < buffer.GetSize())
+            {
+                LOG_WARNING("Send buffer overflow. SessionID: %llu", session->GetID());
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::SendOverflows);
+                }
+                return false;
+            }
+        }
+
+        mLoadMonitor.AddSendBacklog(static_cast<int64_t>(buffer.GetSize()));
+
+        // 이미 송신 중이면 큐에만 추가
+        if (session->IsSending())
+        {
+            return true;
+        }
+
+        // 송신 시작
+        return SubmitSend(session);
+    }
+
+    bool IOUringModel::SendShared(Session* session, const SharedPacketBuffer* packets, size_t count)
+    {
+        if (!session || !packets || count == 0)
+        {
+            return false;
+        }
+
+        SpinLockGuard lock(session->GetLock());
+
+        if (!session->IsConnected())
         {
-            LOG_WARNING("Send buffer overflow. SessionID: %llu", session->GetID());
             return false;
         }
 
+        size_t totalSize = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            totalSize += packets[i] ? packets[i]->GetSize() : 0;
+        }
+
+        if (mConfig.mUseSendChain)
+        {
+            // 참조만 추가 (복사 없음)
+            if (!session->GetSendChain().Append(packets, count))
+            {
+                LOG_WARNING("Send queue overflow. SessionID: %llu", session->GetID());
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::SendOverflows);
+                }
+                return false;
+            }
+        }
+        else
+        {
+            // RingBuffer 모드에서는 전체가 들어갈 공간이 있을 때만 복사
+            RingBuffer& sendBuffer = session->GetSendBuffer();
+            if (totalSize > sendBuffer.GetAvailableWrite())
+            {
+                LOG_WARNING("Send buffer overflow. SessionID: %llu", session->GetID());
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::SendOverflows);
+                }
+                return false;
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (packets[i])
+                {
+                    sendBuffer.Write(packets[i]->GetData(), packets[i]->GetSize());
+                }
+            }
+        }
+
+        mLoadMonitor.AddSendBacklog(static_cast<int64_t>(totalSize));
+
         // 이미 송신 중이면 큐에만 추가
         if (session->IsSending())
         {
@@ -202,6 +448,55 @@ namespace KanchoNet
         return SubmitSend(session);
     }
 
+    RingBuffer* IOUringModel::BeginSend(Session* session)
+    {
+        if (!session || mConfig.mUseSendChain)
+        {
+            return nullptr;
+        }
+
+        session->GetLock().lock();
+
+        if (!session->IsConnected())
+        {
+            session->GetLock().unlock();
+            return nullptr;
+        }
+
+        return &session->GetSendBuffer();
+    }
+
+    void IOUringModel::EndSend(Session* session, size_t bytes)
+    {
+        if (bytes > 0)
+        {
+            mLoadMonitor.AddSendBacklog(static_cast<int64_t>(bytes));
+
+            // 이미 송신 중이면 완료 시 이어서 전송
+            if (!session->IsSending())
+            {
+                SubmitSend(session);
+            }
+        }
+
+        session->GetLock().unlock();
+    }
+
+    bool IOUringModel::StopAccepting()
+    {
+        if (!mRunning)
+        {
+            return false;
+        }
+
+        // 링 조작은 ProcessIO 스레드에서 (다음 ProcessIO 호출에서 Accept 요청 취소)
+        if (mAccepting.exchange(false, std::memory_order_acq_rel))
+        {
+            LOG_INFO("IOUringModel stopped accepting");
+        }
+        return true;
+    }
+
     void IOUringModel::Shutdown()
     {
         if (!mInitialized)
@@ -210,10 +505,28 @@ namespace KanchoNet
         }
 
         mRunning = false;
+        mAccepting.store(false, std::memory_order_release);
+        mAcceptContext = nullptr;
 
         // 세션 정리
         if (mSessionManager)
         {
+            // 읽기 대기 목록이 잡고 있던 참조 반환
+            for (Session* session : mReadableSessions)
+            {
+                session->SetReadBacklogged(false);
+                mSessionManager->ReleaseSession(session);
+            }
+            mReadableSessions.clear();
+
+            // 수신을 미룬 세션 목록이 잡고 있던 참조 반환
+            for (auto& paused : mPausedSessions)
+            {
+                mSessionManager->ReleaseSession(paused.second);
+            }
+            mPausedSessions.clear();
+            mNextResumeTime = INT64_MAX;
+
             mSessionManager->ForEachSession([this](Session* session) {
                 CloseSession(session);
             });
@@ -236,6 +549,13 @@ namespace KanchoNet
             mRingInitialized = false;
         }
 
+        // 메트릭 엔드포인트 닫기 (대기 중인 poll 요청이 링과 함께 정리된 후)
+        if (mMetricsServer)
+        {
+            mMetricsServer->Close();
+            mMetricsServer.reset();
+        }
+
         // 네트워크 정리
         SocketUtils::CleanupNetwork();
 
@@ -263,6 +583,11 @@ namespace KanchoNet
         mOnError = callback;
     }
 
+    void IOUringModel::SetOverloadCallback(std::function<void(const LoadSnapshot&)> callback)
+    {
+        mOnOverload = callback;
+    }
+
     bool IOUringModel::IsIOUringSupported()
     {
         if (mIOUringSupportChecked)
@@ -290,8 +615,27 @@ namespace KanchoNet
 
     bool IOUringModel::CreateIOUring()
     {
+        struct io_uring_params params;
+        memset(&params, 0, sizeof(params));
+
+        // 바쁜 대기 모드: 커널 SQ 스레드가 제출 큐를 확인하므로 제출에 io_uring_enter 시스템 콜이 필요 없음
+        // SQ 스레드도 mBusyPollIdleUs 동안 제출이 없으면 잠듦 (liburing이 제출 시 깨움)
+        if (mConfig.mBusyPoll)
+        {
+            params.flags |= IORING_SETUP_SQPOLL;
+            params.sq_thread_idle = (std::max)(1u, mConfig.mBusyPollIdleUs / 1000);
+        }
+
         // io_uring 초기화 (queue depth: 256)
-        int ret = io_uring_queue_init(256, &mRing, 0);
+        int ret = io_uring_queue_init_params(256, &mRing, &params);
+        if (ret < 0 && (params.flags & IORING_SETUP_SQPOLL))
+        {
+            // 권한(커널 5.11 미만은 CAP_SYS_ADMIN) 등으로 SQPOLL을 쓸 수 없으면 일반 제출로 진행 (완료 큐 회전은 유지)
+            LOG_WARNING("IORING_SETUP_SQPOLL unavailable. Error: %d. Falling back to normal submission", -ret);
+            memset(&params, 0, sizeof(params));
+            ret = io_uring_queue_init_params(256, &mRing, &params);
+        }
+
         if (ret < 0)
         {
             LOG_ERROR("Failed to initialize io_uring. Error: %d", -ret);
@@ -299,10 +643,64 @@ namespace KanchoNet
         }
 
         mRingInitialized = true;
-        LOG_INFO("io_uring initialized successfully");
+        LOG_INFO("io_uring initialized successfully. SQPOLL: %s", (params.flags & IORING_SETUP_SQPOLL) ? "on" : "off");
         return true;
     }
 
+    int IOUringModel::WaitCompletion(struct io_uring_cqe** cqe, uint32_t timeoutMs)
+    {
+        struct __kernel_timespec ts;
+        if (!mConfig.mBusyPoll)
+        {
+            ts.tv_sec = timeoutMs / 1000;
+            ts.tv_nsec = (timeoutMs % 1000) * 1000000;
+            return io_uring_wait_cqe_timeout(&mRing, cqe, &ts);
+        }
+
+        // 완료 큐는 커널과 공유하는 메모리이므로 시스템 콜 없이 회전하며 확인
+        const int64_t idleLimit = static_cast<int64_t>(mConfig.mBusyPollIdleUs) * 1000;
+        const int64_t deadline = NetworkMetrics::Now() + static_cast<int64_t>(timeoutMs) * 1000000;
+        while (true)
+        {
+            int ret = io_uring_peek_cqe(&mRing, cqe);
+            const int64_t now = NetworkMetrics::Now();
+            if (ret != -EAGAIN)
+            {
+                if (ret == 0)
+                {
+                    mLastActivityTime = now;
+                }
+                return ret;
+            }
+
+            if (now >= deadline)
+            {
+                return -ETIME;
+            }
+
+            // 유휴 시간이 지나면 남은 시간 동안 잠들어 코어를 양보 (다음 완료를 받으면 다시 회전)
+            if (idleLimit != 0 && now - mLastActivityTime >= idleLimit)
+            {
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::BusyPollSleeps);
+                }
+
+                const int64_t remaining = deadline - now;
+                ts.tv_sec = remaining / 1000000000;
+                ts.tv_nsec = remaining % 1000000000;
+                ret = io_uring_wait_cqe_timeout(&mRing, cqe, &ts);
+                if (ret == 0)
+                {
+                    mLastActivityTime = NetworkMetrics::Now();
+                }
+                return ret;
+            }
+
+            CpuRelax();
+        }
+    }
+
     bool IOUringModel::SubmitAccept()
     {
         struct io_uring_sqe* sqe = io_uring_get_sqe(&mRing);
@@ -318,10 +716,9 @@ namespace KanchoNet
         ctx->buffer = nullptr;
         ctx->bufferSize = 0;
 
-        struct sockaddr_in clientAddr;
-        socklen_t addrLen = sizeof(clientAddr);
-
-        io_uring_prep_accept(sqe, mListenSocket, (struct sockaddr*)&clientAddr, &addrLen, 0);
+        // 주소는 사용하지 않으므로 받지 않음 (비동기 완료 시점에 스택 변수를 가리키지 않도록)
+        // 논블로킹/close-on-exec은 accept와 함께 설정, 나머지 소켓 옵션은 리슨 소켓에서 상속
+        io_uring_prep_accept(sqe, mListenSocket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
         io_uring_sqe_set_data(sqe, ctx);
 
         int ret = io_uring_submit(&mRing);
@@ -332,9 +729,32 @@ namespace KanchoNet
             return false;
         }
 
+        mAcceptContext = ctx;
         return true;
     }
 
+    void IOUringModel::SubmitAcceptCancel()
+    {
+        struct io_uring_sqe* sqe = io_uring_get_sqe(&mRing);
+        if (!sqe)
+        {
+            return; // 다음 ProcessIO에서 다시 시도
+        }
+
+        // 취소 요청 자체의 완료는 컨텍스트 없이 무시됨 (Accept 요청은 -ECANCELED로 완료)
+        io_uring_prep_cancel(sqe, mAcceptContext, 0);
+        io_uring_sqe_set_data(sqe, nullptr);
+
+        int ret = io_uring_submit(&mRing);
+        if (ret < 0)
+        {
+            LOG_ERROR("Failed to submit accept cancel. Error: %d", -ret);
+            return;
+        }
+
+        mAcceptCancelSubmitted = true;
+    }
+
     bool IOUringModel::SubmitReceive(Session* session)
     {
         struct io_uring_sqe* sqe = io_uring_get_sqe(&mRing);
@@ -344,11 +764,13 @@ namespace KanchoNet
             return false;
         }
 
+        // 완료될 때까지 슬롯이 재사용되지 않도록 요청마다 참조 1 보유 (ProcessCompletion에서 반환)
         IOUringContext* ctx = AllocateContext();
         ctx->operation = IOOperation::Receive;
         ctx->session = session;
         ctx->buffer = new uint8_t[DEFAULT_BUFFER_SIZE];
         ctx->bufferSize = DEFAULT_BUFFER_SIZE;
+        session->AddRef();
 
         io_uring_prep_recv(sqe, session->GetSocket(), ctx->buffer, ctx->bufferSize, 0);
         io_uring_sqe_set_data(sqe, ctx);
@@ -357,6 +779,7 @@ namespace KanchoNet
         if (ret < 0)
         {
             LOG_ERROR("Failed to submit receive. Error: %d", -ret);
+            mSessionManager->ReleaseSession(session);
             DeallocateContext(ctx);
             return false;
         }
@@ -366,11 +789,16 @@ namespace KanchoNet
 
     bool IOUringModel::SubmitSend(Session* session)
     {
+        // 호출자(Send, ProcessSendCompletion)가 세션 락을 잡고 있음
+        if (mMetrics && !session->IsSending())
+        {
+            session->SetSendQueuedTime(NetworkMetrics::Now());
+        }
         session->SetSending(true);
 
-        SpinLockGuard lock(session->GetLock());
-
-        size_t dataSize = session->GetSendBuffer().GetAvailableRead();
+        size_t dataSize = mConfig.mUseSendChain
+            ? session->GetSendChain().GetTotalBytes()
+            : session->GetSendBuffer().GetAvailableRead();
         if (dataSize == 0)
         {
             session->SetSending(false);
@@ -385,9 +813,17 @@ namespace KanchoNet
             return false;
         }
 
+        // 완료될 때까지 슬롯이 재사용되지 않도록 요청마다 참조 1 보유 (ProcessCompletion에서 반환)
         IOUringContext* ctx = AllocateContext();
         ctx->operation = IOOperation::Send;
         ctx->session = session;
+        session->AddRef();
+
+        if (mConfig.mUseSendChain)
+        {
+            return SubmitSendChain(session, sqe, ctx);
+        }
+
         ctx->bufferSize = (dataSize > DEFAULT_BUFFER_SIZE) ? DEFAULT_BUFFER_SIZE : dataSize;
         ctx->buffer = new uint8_t[ctx->bufferSize];
 
@@ -401,6 +837,66 @@ namespace KanchoNet
         {
             LOG_ERROR("Failed to submit send. Error: %d", -ret);
             session->SetSending(false);
+            mSessionManager->ReleaseSession(session);
+            DeallocateContext(ctx);
+            return false;
+        }
+
+        return true;
+    }
+
+    bool IOUringModel::SubmitSendChain(Session* session, struct io_uring_sqe* sqe, IOUringContext* ctx)
+    {
+        // 세그먼트들을 iovec 배열로 묶어 sendmsg 한 번으로 송신 (완료 시까지 세그먼트는 체인이 유지)
+        SendChain& sendChain = session->GetSendChain();
+        size_t iovCount = (std::min)(sendChain.GetSegmentCount(), SendChain::MAX_IOV_COUNT);
+
+        ctx->iov = new struct iovec[iovCount];
+        iovCount = sendChain.FillIOVec(ctx->iov, iovCount);
+
+        ctx->message.msg_iov = ctx->iov;
+        ctx->message.msg_iovlen = iovCount;
+
+        io_uring_prep_sendmsg(sqe, session->GetSocket(), &ctx->message, MSG_NOSIGNAL);
+        io_uring_sqe_set_data(sqe, ctx);
+
+        int ret = io_uring_submit(&mRing);
+        if (ret < 0)
+        {
+            LOG_ERROR("Failed to submit sendmsg. Error: %d", -ret);
+            session->SetSending(false);
+            mSessionManager->ReleaseSession(session);
+            DeallocateContext(ctx);
+            return false;
+        }
+
+        return true;
+    }
+
+    bool IOUringModel::SubmitMetricsPoll(SocketHandle socket, uint32_t interest)
+    {
+        struct io_uring_sqe* sqe = io_uring_get_sqe(&mRing);
+        if (!sqe)
+        {
+            LOG_ERROR("Failed to get SQE for metrics poll");
+            return false;
+        }
+
+        IOUringContext* ctx = AllocateContext();
+        ctx->operation = IOOperation::Poll;
+        ctx->socket = socket;
+
+        unsigned pollMask = 0;
+        pollMask |= (interest & MetricsHttpServer::EVENT_READ) ? POLLIN : 0;
+        pollMask |= (interest & MetricsHttpServer::EVENT_WRITE) ? POLLOUT : 0;
+
+        io_uring_prep_poll_add(sqe, socket, pollMask);
+        io_uring_sqe_set_data(sqe, ctx);
+
+        int ret = io_uring_submit(&mRing);
+        if (ret < 0)
+        {
+            LOG_ERROR("Failed to submit metrics poll. Error: %d", -ret);
             DeallocateContext(ctx);
             return false;
         }
@@ -432,29 +928,61 @@ namespace KanchoNet
             ProcessSendCompletion(ctx, result);
             break;
 
+        case IOOperation::Poll:
+            ProcessMetricsPollCompletion(ctx, result);
+            break;
+
         default:
             LOG_WARNING("Unknown I/O operation: %d", (int)ctx->operation);
             break;
         }
 
+        // 수신/송신 요청이 잡고 있던 참조 반환 (처리 중에 연결이 끊겼으면 여기서 슬롯이 풀로 돌아감)
+        if (ctx->session)
+        {
+            mSessionManager->ReleaseSession(ctx->session);
+        }
+
         DeallocateContext(ctx);
     }
 
     void IOUringModel::ProcessAcceptCompletion(IOUringContext* ctx, int result)
     {
-        // 다음 Accept 등록
-        SubmitAccept();
+        // 다음 Accept 등록 (수락을 중지했거나 과부하 중이면 남은 연결은 리슨 소켓 큐에 그대로 둠)
+        mAcceptContext = nullptr;
+        mAcceptCancelSubmitted = false;
+        if (!mAcceptPaused && mAccepting.load(std::memory_order_acquire))
+        {
+            SubmitAccept();
+        }
 
         if (result < 0)
         {
-            LOG_ERROR("Accept failed. Error: %d", -result);
+            if (result != -ECANCELED)
+            {
+                LOG_ERROR("Accept failed. Error: %d", -result);
+            }
             return;
         }
 
         SocketHandle clientSocket = result;
 
-        // Non-blocking 설정
-        SocketUtils::SetNonBlocking(clientSocket, true);
+        // 출발지 IP별 연결 한도 (비동기 accept에는 주소를 받지 않으므로 한도를 쓸 때만 조회)
+        if (mConnectionLimiter.IsEnabled())
+        {
+            struct sockaddr_storage address;
+            socklen_t addressLength = sizeof(address);
+            if (getpeername(clientSocket, reinterpret_cast<struct sockaddr*>(&address), &addressLength) == 0 &&
+                !mConnectionLimiter.TryAcquire(SocketUtils::GetAddressKey(reinterpret_cast<struct sockaddr*>(&address)), NetworkMetrics::Now()))
+            {
+                close(clientSocket);
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::ConnectionRateRejects);
+                }
+                return;
+            }
+        }
 
         // 세션 생성
         SessionConfig sessionConfig;
@@ -463,10 +991,15 @@ namespace KanchoNet
         {
             LOG_WARNING("Failed to add session. Session limit reached.");
             close(clientSocket);
+            if (mMetrics)
+            {
+                mMetrics->Add(MetricCounter::AcceptRejects);
+            }
             return;
         }
 
         session->SetState(SessionState::Connected);
+        session->SetRateLimit(mByteLimit, mMessageLimit);
         mSocketToSession[clientSocket] = session;
 
         // 수신 시작
@@ -476,6 +1009,11 @@ namespace KanchoNet
             return;
         }
 
+        if (mMetrics)
+        {
+            mMetrics->Add(MetricCounter::Accepts);
+        }
+
         // Accept 콜백 호출
         if (mOnAccept)
         {
@@ -496,13 +1034,103 @@ namespace KanchoNet
         if (result > 0)
         {
             // 데이터 수신 성공
-            if (mOnReceive)
+            if (mMetrics)
+            {
+                mMetrics->Add(MetricCounter::ReceiveOps);
+                mMetrics->Add(MetricCounter::BytesReceived, static_cast<uint64_t>(result));
+            }
+
+            // 과부하 중에는 낮은 우선순위 세션의 수신부터 제한 (이미 받은 데이터는 Pause면 넘기고 Drop이면 버림)
+            bool shed = false;
+            if (mLoadMonitor.IsOverloaded() && session->GetPriority() < mConfig.mOverloadShedBelow)
             {
-                mOnReceive(session, ctx->buffer, result);
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::OverloadSheds);
+                }
+
+                if (mConfig.mOverloadShedAction == RateLimitAction::Disconnect)
+                {
+                    ProcessDisconnect(session);
+                    return;
+                }
+                shed = true;
             }
 
-            // 다음 수신 등록
-            SubmitReceive(session);
+            // 수신 속도 제한 (세션 수신은 ProcessIO 스레드만 처리하므로 버킷은 락 없이 갱신)
+            bool deliver = !(shed && mConfig.mOverloadShedAction == RateLimitAction::Drop);
+            bool overLimit = false;
+            if (mRateLimited &&
+                !session->ConsumeReceiveRate(static_cast<size_t>(result), NetworkMetrics::Now(), mConfig.mRateLimitAction))
+            {
+                if (mConfig.mRateLimitAction == RateLimitAction::Disconnect)
+                {
+                    LOG_WARNING("Receive rate limit exceeded. Disconnecting SessionID: %llu", session->GetID());
+                    if (mMetrics)
+                    {
+                        mMetrics->Add(MetricCounter::RateLimitDisconnects);
+                    }
+                    ProcessDisconnect(session);
+                    return;
+                }
+
+                if (mConfig.mRateLimitAction == RateLimitAction::Drop)
+                {
+                    if (mMetrics)
+                    {
+                        mMetrics->Add(MetricCounter::RateLimitDrops);
+                    }
+                    deliver = false;
+                }
+                else
+                {
+                    // Pause: 이미 받은 데이터는 넘기고 다음 수신 등록을 미룸
+                    overLimit = true;
+                }
+            }
+
+            if (deliver && mOnReceive)
+            {
+                if (mMetrics)
+                {
+                    int64_t start = NetworkMetrics::Now();
+                    mOnReceive(session, ctx->buffer, result);
+                    mMetrics->Record(MetricHistogram::ReceiveCallback, NetworkMetrics::Now() - start);
+                }
+                else
+                {
+                    mOnReceive(session, ctx->buffer, result);
+                }
+            }
+
+            // 다음 수신 등록 (속도 제한을 넘었으면 버킷이 찰 때까지,
+            // 이번 회차의 읽기 예산을 다 썼으면 다른 세션을 먼저 처리하도록 다음 회차로 미룸)
+            if (overLimit)
+            {
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::RateLimitPauses);
+                }
+                PauseReading(session, session->GetReadResumeTime());
+            }
+            else if (shed && mConfig.mOverloadShedAction == RateLimitAction::Pause)
+            {
+                // 과부하가 끝났는지는 주기적으로 다시 확인
+                PauseReading(session, NetworkMetrics::Now() + static_cast<int64_t>(LoadMonitor::SHED_RECHECK_MS) * 1000000);
+            }
+            else if (session->ConsumeReadBudget(mReadRound, static_cast<size_t>(result),
+                                           mConfig.mReadBudgetBytes, mConfig.mReadBudgetCount))
+            {
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::ReadBudgetExhausted);
+                }
+                QueueReadable(session);
+            }
+            else
+            {
+                SubmitReceive(session);
+            }
         }
         else if (result == 0)
         {
@@ -518,6 +1146,81 @@ namespace KanchoNet
         }
     }
 
+    void IOUringModel::QueueReadable(Session* session)
+    {
+        if (session->IsReadBacklogged())
+        {
+            return;
+        }
+
+        // 목록에 있는 동안 세션이 제거되어도 슬롯이 재사용되지 않도록 참조 유지
+        session->SetReadBacklogged(true);
+        session->AddRef();
+        mReadableSessions.push_back(session);
+    }
+
+    void IOUringModel::ProcessReadable()
+    {
+        if (mReadableSessions.empty())
+        {
+            return;
+        }
+
+        // 목록 순서대로 수신 등록 (완료는 다음 회차에 처리되며 그때 예산을 새로 받음)
+        mReadableScratch.swap(mReadableSessions);
+        for (Session* session : mReadableScratch)
+        {
+            session->SetReadBacklogged(false);
+            if (mRunning && session->IsConnected())
+            {
+                SubmitReceive(session);
+            }
+            mSessionManager->ReleaseSession(session);
+        }
+        mReadableScratch.clear();
+    }
+
+    void IOUringModel::PauseReading(Session* session, int64_t resumeTime)
+    {
+        if (!session->IsConnected())
+        {
+            return;
+        }
+
+        // 목록에 있는 동안 세션이 제거되어도 슬롯이 재사용되지 않도록 참조 유지
+        session->SetReadPaused(true);
+        session->AddRef();
+        mPausedSessions.emplace_back(resumeTime, session);
+        mNextResumeTime = std::min(mNextResumeTime, resumeTime);
+    }
+
+    void IOUringModel::ResumePausedSessions(int64_t now)
+    {
+        int64_t nextTime = INT64_MAX;
+        size_t kept = 0;
+        for (size_t i = 0; i < mPausedSessions.size(); ++i)
+        {
+            auto paused = mPausedSessions[i];
+            if (paused.first > now)
+            {
+                nextTime = std::min(nextTime, paused.first);
+                mPausedSessions[kept++] = paused;
+                continue;
+            }
+
+            Session* session = paused.second;
+            session->SetReadPaused(false);
+            if (mRunning && session->IsConnected())
+            {
+                SubmitReceive(session);
+            }
+            mSessionManager->ReleaseSession(session);
+        }
+
+        mPausedSessions.resize(kept);
+        mNextResumeTime = nextTime;
+    }
+
     void IOUringModel::ProcessSendCompletion(IOUringContext* ctx, int result)
     {
         Session* session = ctx->session;
@@ -526,33 +1229,110 @@ namespace KanchoNet
             return;
         }
 
-        SpinLockGuard lock(session->GetLock());
-
-        if (result > 0)
         {
-            // 송신 성공
-            session->GetSendBuffer().Skip(result);
+            SpinLockGuard lock(session->GetLock());
 
-            // 남은 데이터가 있으면 계속 송신
-            if (session->GetSendBuffer().GetAvailableRead() > 0)
+            if (result > 0)
             {
-                SubmitSend(session);
+                // 송신 성공
+                if (mMetrics)
+                {
+                    mMetrics->Add(MetricCounter::SendOps);
+                    mMetrics->Add(MetricCounter::BytesSent, static_cast<uint64_t>(result));
+                }
+
+                // 종료할 때 남은 큐를 이미 뺐으므로 연결 중일 때만 반영
+                if (session->IsConnected())
+                {
+                    mLoadMonitor.AddSendBacklog(-static_cast<int64_t>(result));
+                }
+
+                size_t remaining;
+                if (mConfig.mUseSendChain)
+                {
+                    session->GetSendChain().Consume(result);
+                    remaining = session->GetSendChain().GetTotalBytes();
+                }
+                else
+                {
+                    session->GetSendBuffer().Skip(result);
+                    remaining = session->GetSendBuffer().GetAvailableRead();
+                }
+
+                // 남은 데이터가 있으면 계속 송신 (종료된 세션은 닫힌 소켓에 다시 보내지 않음)
+                if (remaining > 0 && session->IsConnected())
+                {
+                    SubmitSend(session);
+                }
+                else
+                {
+                    session->SetSending(false);
+                    RecordSendQueueResidency(session);
+                }
             }
             else
             {
+                // 에러
                 session->SetSending(false);
+                LOG_ERROR("Send failed. SessionID: %llu, Error: %d", 
+                         session->GetID(), -result);
             }
         }
-        else
+
+        // 연결 종료는 세션 락을 놓은 뒤 처리 (ProcessDisconnect가 같은 락을 잡음)
+        if (result <= 0)
         {
-            // 에러
-            session->SetSending(false);
-            LOG_ERROR("Send failed. SessionID: %llu, Error: %d", 
-                     session->GetID(), -result);
             ProcessDisconnect(session);
         }
     }
 
+    void IOUringModel::ProcessMetricsPollCompletion(IOUringContext* ctx, int result)
+    {
+        if (!mMetricsServer)
+        {
+            return;
+        }
+
+        SocketHandle socket = ctx->socket;
+
+        if (socket == mMetricsServer->GetListenSocket())
+        {
+            // 대기 중인 연결을 모두 수락하고 리슨 소켓 poll 재등록
+            SocketHandle client;
+            while ((client = mMetricsServer->Accept()) != INVALID_SOCKET_HANDLE)
+            {
+                if (!SubmitMetricsPoll(client, MetricsHttpServer::EVENT_READ))
+                {
+                    mMetricsServer->HandleEvent(client, MetricsHttpServer::EVENT_ERROR);
+                }
+            }
+
+            if (result != -ECANCELED)
+            {
+                SubmitMetricsPoll(socket, MetricsHttpServer::EVENT_READ);
+            }
+            return;
+        }
+
+        uint32_t events = 0;
+        if (result < 0 || (result & POLLERR))
+        {
+            events |= MetricsHttpServer::EVENT_ERROR;
+        }
+        else
+        {
+            events |= (result & POLLIN) ? MetricsHttpServer::EVENT_READ : 0;
+            events |= (result & POLLOUT) ? MetricsHttpServer::EVENT_WRITE : 0;
+        }
+
+        // 0이면 연결이 닫혔으므로 다시 등록하지 않음
+        uint32_t interest = mMetricsServer->HandleEvent(socket, events);
+        if (interest != 0 && !SubmitMetricsPoll(socket, interest))
+        {
+            mMetricsServer->HandleEvent(socket, MetricsHttpServer::EVENT_ERROR);
+        }
+    }
+
     void IOUringModel::ProcessDisconnect(Session* session)
     {
         if (!session)
@@ -560,12 +1340,26 @@ namespace KanchoNet
             return;
         }
 
-        if (session->IsDisconnected())
         {
-            return;
+            // 송신 스레드(태스크 워커 등)가 상태를 확인하는 락과 같은 락으로 전환
+            SpinLockGuard lock(session->GetLock());
+            if (session->IsDisconnected())
+            {
+                return;
+            }
+
+            session->SetState(SessionState::Disconnected);
+
+            // 보내지 못하고 버리는 송신 큐 (이후의 Send/송신 완료는 연결 상태를 보고 반영하지 않음)
+            mLoadMonitor.AddSendBacklog(-static_cast<int64_t>(mConfig.mUseSendChain
+                ? session->GetSendChain().GetTotalBytes()
+                : session->GetSendBuffer().GetAvailableRead()));
         }
 
-        session->SetState(SessionState::Disconnected);
+        if (mMetrics)
+        {
+            mMetrics->Add(MetricCounter::Disconnects);
+        }
 
         // Disconnect 콜백 호출
         if (mOnDisconnect)
@@ -576,14 +1370,27 @@ namespace KanchoNet
         LOG_DEBUG("Client disconnected. SessionID: %llu", session->GetID());
 
         // 소켓 제거
+        // 닫기 전에 shutdown으로 대기 중인 recv/send를 바로 완료시킴 (요청이 파일 참조를 잡고 있어 close만으로는 끝나지 않음)
+        // 늦게 오는 완료는 요청이 잡은 참조 덕분에 같은 (종료된) 세션에서 처리되고 무시됨
         SocketHandle socket = session->GetSocket();
         mSocketToSession.erase(socket);
+        SocketUtils::ShutdownSocket(socket);
         SocketUtils::CloseSocket(socket);
 
         // 세션 제거
         mSessionManager->RemoveSession(session->GetID());
     }
 
+    void IOUringModel::RecordSendQueueResidency(Session* session)
+    {
+        if (mMetrics && session->GetSendQueuedTime() != 0)
+        {
+            mMetrics->Record(MetricHistogram::SendQueueResidency,
+                             NetworkMetrics::Now() - session->GetSendQueuedTime());
+            session->SetSendQueuedTime(0);
+        }
+    }
+
     void IOUringModel::CloseSession(Session* session)
     {
         if (!session)
@@ -604,6 +1411,9 @@ namespace KanchoNet
         ctx->session = nullptr;
         ctx->buffer = nullptr;
         ctx->bufferSize = 0;
+        memset(&ctx->message, 0, sizeof(ctx->message));
+        ctx->iov = nullptr;
+        ctx->socket = INVALID_SOCKET_HANDLE;
         return ctx;
     }
 
@@ -615,6 +1425,10 @@ namespace KanchoNet
             {
                 delete[] ctx->buffer;
             }
+            if (ctx->iov)
+            {
+                delete[] ctx->iov;
+            }
             delete ctx;
         }
     }
@@ -7,11 +7,16 @@
 
 #include "../Core/INetworkModel.h"
 #include "../Session/SessionManager.h"
+#include "../Metrics/MetricsHttpServer.h"
+#include "../Metrics/LoadMonitor.h"
 #include "../Utils/NonCopyable.h"
+#include "../Utils/RateLimiter.h"
 #include <liburing.h>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace KanchoNet
 {
@@ -23,8 +28,14 @@ namespace KanchoNet
         
     private:
         // private 멤버변수
+        struct IOUringContext;
+
         bool mInitialized;
         bool mRunning;
+        std::atomic<bool> mAccepting;           // StopAccepting 전까지 true (다른 스레드에서 내릴 수 있음)
+        IOUringContext* mAcceptContext;         // 제출된 Accept 요청 (없으면 nullptr, ProcessIO 스레드 전용)
+        bool mAcceptCancelSubmitted;            // 수락 중지 후 Accept 취소 요청을 제출했는지
+        bool mAcceptPaused;                     // 과부하로 수락을 잠시 멈춤 (ProcessIO 스레드 전용, 회복하면 Accept 다시 제출)
         
         EngineConfig mConfig;
         SocketHandle mListenSocket;
@@ -34,12 +45,35 @@ namespace KanchoNet
         
         std::unique_ptr<SessionManager> mSessionManager;
         std::unordered_map<SocketHandle, Session*> mSocketToSession;
+        std::unique_ptr<NetworkMetrics> mMetrics;   // EngineConfig::mEnableMetrics가 false면 nullptr
+        std::unique_ptr<MetricsHttpServer> mMetricsServer;  // EngineConfig::mMetricsPort가 0이면 nullptr
+
+        // 수신 공정성 (ProcessIO 스레드 전용)
+        // 한 회차에 읽기 예산을 다 쓴 세션은 다음 수신 등록을 미뤄 두었다가 다음 회차 끝에 등록 (세션마다 참조 1 보유)
+        uint32_t mReadRound;                        // ProcessIO 호출마다 증가
+        std::vector<Session*> mReadableSessions;
+        std::vector<Session*> mReadableScratch;     // 처리 중인 목록 (메모리 재사용)
+
+        // 수신 속도 제한 (EngineConfig::mRateLimit*)
+        // 한도를 넘은 세션은 다음 수신 등록을 버킷이 다시 찰 때까지 미룸 (ProcessIO 스레드 전용, 세션마다 참조 1 보유)
+        bool mRateLimited;                          // 세션 바이트/횟수 한도 중 하나라도 사용
+        TokenBucket mByteLimit;                     // 수락한 세션에 복사해 넣을 버킷
+        TokenBucket mMessageLimit;
+        KeyedRateLimiter mConnectionLimiter;        // 출발지 IP별 연결 한도
+        std::vector<std::pair<int64_t, Session*>> mPausedSessions;
+        int64_t mNextResumeTime;                    // 목록에서 가장 이른 시각 (비어있으면 INT64_MAX)
+
+        // 과부하 감지 (EngineConfig::mOverload*)
+        LoadMonitor mLoadMonitor;
+
+        int64_t mLastActivityTime;                  // 바쁜 대기 모드에서 마지막으로 완료를 받은 시각 (ns)
         
         // 콜백 함수들
         std::function<void(Session*)> mOnAccept;
         std::function<void(Session*, const uint8_t*, size_t)> mOnReceive;
         std::function<void(Session*)> mOnDisconnect;
         std::function<void(Session*, ErrorCode)> mOnError;
+        std::function<void(const LoadSnapshot&)> mOnOverload;
         
         // io_uring 지원 여부
         static bool mIOUringSupportChecked;
@@ -57,13 +91,23 @@ namespace KanchoNet
         bool StartListen() override;
         bool ProcessIO(uint32_t timeoutMs = 0) override;
         bool Send(Session* session, const PacketBuffer& buffer) override;
+        bool SendShared(Session* session, const SharedPacketBuffer* packets, size_t count) override;
+        RingBuffer* BeginSend(Session* session) override;
+        void EndSend(Session* session, size_t bytes) override;
         void Shutdown() override;
+        bool StopAccepting() override;
+        SocketHandle GetListenSocket() const override { return mListenSocket; }
+        const NetworkMetrics* GetMetrics() const override { return mMetrics.get(); }
+        MetricsHttpServer* GetMetricsServer() override { return mMetricsServer.get(); }
+        SessionManager* GetSessionManager() override { return mSessionManager.get(); }
+        LoadSnapshot GetLoad() const override { return mLoadMonitor.GetSnapshot(); }
 
         // 콜백 설정
         void SetAcceptCallback(std::function<void(Session*)> callback) override;
         void SetReceiveCallback(std::function<void(Session*, const uint8_t*, size_t)> callback) override;
         void SetDisconnectCallback(std::function<void(Session*)> callback) override;
         void SetErrorCallback(std::function<void(Session*, ErrorCode)> callback) override;
+        void SetOverloadCallback(std::function<void(const LoadSnapshot&)> callback) override;
 
         // 상태 확인
         bool IsInitialized() const { return mInitialized; }
@@ -79,18 +123,43 @@ namespace KanchoNet
             Session* session;
             uint8_t* buffer;
             size_t bufferSize;
+            struct msghdr message;  // 세그먼트 체인 송신용 (sendmsg)
+            struct iovec* iov;
+            SocketHandle socket;    // Poll 대상 소켓 (메트릭 엔드포인트)
         };
 
         // 내부 함수들
         bool CreateIOUring();
+
+        // 완료 대기 (바쁜 대기 모드면 완료 큐를 회전하며 확인하다가 유휴 시간이 지나면 남은 시간 동안 잠듦)
+        int WaitCompletion(struct io_uring_cqe** cqe, uint32_t timeoutMs);
         bool SubmitAccept();
+        void SubmitAcceptCancel();              // 수락 중지/과부하 후 대기 중인 Accept 요청 취소
         bool SubmitReceive(Session* session);
-        bool SubmitSend(Session* session);
+        bool SubmitSend(Session* session);      // 세션 락을 잡은 상태에서 호출
+        bool SubmitSendChain(Session* session, struct io_uring_sqe* sqe, IOUringContext* ctx);
+        bool SubmitMetricsPoll(SocketHandle socket, uint32_t interest);    // 메트릭 소켓 준비 상태 대기 (1회성)
         
         void ProcessCompletion(struct io_uring_cqe* cqe);
         void ProcessAcceptCompletion(IOUringContext* ctx, int result);
         void ProcessReceiveCompletion(IOUringContext* ctx, int result);
         void ProcessSendCompletion(IOUringContext* ctx, int result);
+        void ProcessMetricsPollCompletion(IOUringContext* ctx, int result);
+        void ProcessDisconnect(Session* session);
+
+        // 읽기 대기 목록 추가 / 지난 회차에 목록에 들어간 세션 수신 등록
+        void QueueReadable(Session* session);
+        void ProcessReadable();
+
+        // 수신 속도 제한/과부하 제한: 수신 등록을 미루고 목록에 추가 / 시각이 된 세션 수신 등록
+        void PauseReading(Session* session, int64_t resumeTime);
+        void ResumePausedSessions(int64_t now);
+
+        // ProcessIO 한 회차의 부하 기록 (과부하 상태가 바뀌면 Accept 요청 취소/재제출 후 콜백 호출)
+        void RecordLoad(int64_t wakeTime, uint32_t readyDepth);
+        
+        // 송신 큐가 비었을 때 체류 시간 기록 (세션 락을 잡은 상태에서 호출)
+        void RecordSendQueueResidency(Session* session);
         
         void CloseSession(Session* session);
         
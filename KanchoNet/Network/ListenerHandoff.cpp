@@ -0,0 +1,264 @@
+#include "ListenerHandoff.h"
+
+#ifdef KANCHONET_PLATFORM_LINUX
+
+#include "../Utils/Logger.h"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace KanchoNet
+{
+    // sockaddr_un 채우기 (경로가 너무 길면 false)
+    static bool MakeUnixAddress(const std::string& path, struct sockaddr_un& address)
+    {
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(address.sun_path))
+        {
+            LOG_ERROR("Invalid handoff socket path: %s", path.c_str());
+            return false;
+        }
+
+        memcpy(address.sun_path, path.c_str(), path.size());
+        return true;
+    }
+
+    ListenerHandoff::ListenerHandoff()
+        : mListenFd(-1)
+        , mPeerFd(-1)
+    {
+    }
+
+    ListenerHandoff::~ListenerHandoff()
+    {
+        Close();
+    }
+
+    bool ListenerHandoff::Listen(const std::string& path)
+    {
+        Close();
+
+        struct sockaddr_un address;
+        if (!MakeUnixAddress(path, address))
+        {
+            return false;
+        }
+
+        mListenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (mListenFd < 0)
+        {
+            LOG_ERROR("Failed to create handoff socket. Error: %d", errno);
+            return false;
+        }
+
+        // 이전 실행이 남긴 파일 제거
+        unlink(path.c_str());
+
+        if (bind(mListenFd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) < 0 ||
+            listen(mListenFd, 1) < 0)
+        {
+            LOG_ERROR("Failed to listen on handoff socket %s. Error: %d", path.c_str(), errno);
+            Close();
+            return false;
+        }
+
+        mPath = path;
+        LOG_INFO("Waiting for listener handoff on %s", mPath.c_str());
+        return true;
+    }
+
+    bool ListenerHandoff::Serve(SocketHandle listenSocket, uint32_t timeoutMs, uint32_t readyTimeoutMs)
+    {
+        if (mListenFd < 0 || listenSocket == INVALID_SOCKET_HANDLE)
+        {
+            return false;
+        }
+
+        if (!WaitReadable(mListenFd, timeoutMs))
+        {
+            return false;
+        }
+
+        mPeerFd = accept4(mListenFd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (mPeerFd < 0)
+        {
+            return false;
+        }
+
+        // 인계는 한 번만: 새 프로세스가 같은 경로로 다음 인계를 받을 수 있도록 바로 정리
+        close(mListenFd);
+        mListenFd = -1;
+        unlink(mPath.c_str());
+        mPath.clear();
+
+        // 리슨 소켓 전달
+        char message = MESSAGE_SOCKET;
+        struct iovec iov;
+        iov.iov_base = &message;
+        iov.iov_len = sizeof(message);
+
+        alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+        memset(control, 0, sizeof(control));
+
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(cmsg), &listenSocket, sizeof(int));
+
+        if (sendmsg(mPeerFd, &msg, MSG_NOSIGNAL) != static_cast<ssize_t>(sizeof(message)))
+        {
+            LOG_ERROR("Failed to send listen socket. Error: %d", errno);
+            Close();
+            return false;
+        }
+
+        // 새 프로세스가 수락을 시작할 때까지 대기 (그 전에 응답 없이 끊기면 이전 프로세스가 계속 수락)
+        char reply = 0;
+        const bool ready = WaitReadable(mPeerFd, readyTimeoutMs) &&
+                           recv(mPeerFd, &reply, sizeof(reply), 0) == static_cast<ssize_t>(sizeof(reply)) &&
+                           reply == MESSAGE_READY;
+        Close();
+
+        if (!ready)
+        {
+            LOG_WARNING("Listener handoff was not acknowledged. Keep accepting");
+            return false;
+        }
+
+        LOG_INFO("Listen socket handed off");
+        return true;
+    }
+
+    SocketHandle ListenerHandoff::Connect(const std::string& path, uint32_t timeoutMs)
+    {
+        Close();
+
+        struct sockaddr_un address;
+        if (!MakeUnixAddress(path, address))
+        {
+            return INVALID_SOCKET_HANDLE;
+        }
+
+        mPeerFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (mPeerFd < 0)
+        {
+            return INVALID_SOCKET_HANDLE;
+        }
+
+        if (connect(mPeerFd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) < 0)
+        {
+            // 실행 중인 프로세스가 없음 (새로 시작)
+            LOG_INFO("No listener to take over on %s", path.c_str());
+            Close();
+            return INVALID_SOCKET_HANDLE;
+        }
+
+        if (!WaitReadable(mPeerFd, timeoutMs))
+        {
+            LOG_ERROR("Timed out waiting for listen socket on %s", path.c_str());
+            Close();
+            return INVALID_SOCKET_HANDLE;
+        }
+
+        char message = 0;
+        struct iovec iov;
+        iov.iov_base = &message;
+        iov.iov_len = sizeof(message);
+
+        alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        if (recvmsg(mPeerFd, &msg, MSG_CMSG_CLOEXEC) != static_cast<ssize_t>(sizeof(message)) || message != MESSAGE_SOCKET)
+        {
+            LOG_ERROR("Failed to receive listen socket. Error: %d", errno);
+            Close();
+            return INVALID_SOCKET_HANDLE;
+        }
+
+        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        if (!cmsg || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS ||
+            cmsg->cmsg_len != CMSG_LEN(sizeof(int)))
+        {
+            LOG_ERROR("Handoff message has no listen socket");
+            Close();
+            return INVALID_SOCKET_HANDLE;
+        }
+
+        SocketHandle listenSocket;
+        memcpy(&listenSocket, CMSG_DATA(cmsg), sizeof(int));
+
+        LOG_INFO("Received listen socket from %s. Socket: %d", path.c_str(), listenSocket);
+        return listenSocket;
+    }
+
+    bool ListenerHandoff::NotifyReady()
+    {
+        if (mPeerFd < 0)
+        {
+            return false;
+        }
+
+        char reply = MESSAGE_READY;
+        const bool sent = send(mPeerFd, &reply, sizeof(reply), MSG_NOSIGNAL) == static_cast<ssize_t>(sizeof(reply));
+        Close();
+        return sent;
+    }
+
+    void ListenerHandoff::Close()
+    {
+        if (mPeerFd >= 0)
+        {
+            close(mPeerFd);
+            mPeerFd = -1;
+        }
+
+        if (mListenFd >= 0)
+        {
+            close(mListenFd);
+            mListenFd = -1;
+            unlink(mPath.c_str());
+        }
+        mPath.clear();
+    }
+
+    bool ListenerHandoff::WaitReadable(int fd, uint32_t timeoutMs)
+    {
+        struct pollfd pfd;
+        pfd.fd = fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+
+        while (true)
+        {
+            int result = poll(&pfd, 1, timeoutMs == 0 ? -1 : static_cast<int>(timeoutMs));
+            if (result > 0)
+            {
+                return true;
+            }
+            if (result == 0 || errno != EINTR)
+            {
+                return false;
+            }
+        }
+    }
+
+} // namespace KanchoNet
+
+#endif // KANCHONET_PLATFORM_LINUX
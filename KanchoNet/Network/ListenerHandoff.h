@@ -0,0 +1,78 @@
+#pragma once
+
+#include "../Platform.h"
+
+// 리슨 소켓 인계는 Linux 전용 (유닉스 도메인 소켓 SCM_RIGHTS)
+#ifdef KANCHONET_PLATFORM_LINUX
+
+#include "../Types.h"
+#include "../Utils/NonCopyable.h"
+#include <string>
+
+namespace KanchoNet
+{
+    // 무중단 재시작용 리슨 소켓 인계
+    // 실행 중인(이전) 프로세스가 유닉스 소켓 경로에서 기다리다가, 새 프로세스가 접속하면 리슨 소켓을 SCM_RIGHTS로 넘김
+    // 두 프로세스가 같은 리슨 소켓(커널 수락 큐)을 공유하므로 인계 도중 들어온 연결도 버려지지 않음
+    //
+    // 이전 프로세스                              새 프로세스
+    //   Listen(path)
+    //   Serve(engine.GetListenSocket(), ...)  <-  Connect(path, ...) → 리슨 소켓
+    //                                             config.mInheritedListenSocket = 리슨 소켓
+    //                                             Initialize / Start
+    //   Serve 반환 (true)                     <-  NotifyReady()
+    //   engine.Drain(...)                         (새 연결은 새 프로세스가 수락)
+    //   ProcessIO 스레드 합류 후 engine.Stop()
+    //
+    // 인계는 한 번만 하며, Serve는 새 프로세스가 접속하면 경로를 바로 지워 다음 인계를 위해 새 프로세스가 Listen할 수 있게 함
+    class ListenerHandoff : public NonCopyable
+    {
+    public:
+        // public 멤버변수 (없음)
+
+    private:
+        // private 멤버변수
+        int mListenFd;          // 인계 대기 유닉스 소켓 (이전 프로세스)
+        int mPeerFd;            // 상대 프로세스와의 연결
+        std::string mPath;
+
+        // 메시지 (1바이트)
+        static constexpr char MESSAGE_SOCKET = 'L';     // 리슨 소켓 전달 (SCM_RIGHTS 동봉)
+        static constexpr char MESSAGE_READY = 'R';      // 새 프로세스가 수락을 시작함
+
+    public:
+        // 생성자, 파괴자
+        ListenerHandoff();
+        ~ListenerHandoff();
+
+    public:
+        // public 함수
+        // 이전 프로세스: 인계 요청을 받을 유닉스 소켓 열기 (같은 경로의 남은 파일은 지움)
+        bool Listen(const std::string& path);
+
+        // 이전 프로세스: 새 프로세스 접속을 기다려 리슨 소켓을 넘기고 준비 완료 응답까지 대기
+        // timeoutMs 동안 접속이 없으면 false (0 = 무한 대기), 접속한 뒤에는 응답을 최대 readyTimeoutMs 동안 기다림
+        // 반환값: 새 프로세스가 수락을 시작했는지 (true면 호출자는 StopAccepting/Drain 후 종료)
+        bool Serve(SocketHandle listenSocket, uint32_t timeoutMs, uint32_t readyTimeoutMs = 10000);
+
+        // 새 프로세스: 이전 프로세스에 접속해 리슨 소켓 받기
+        // 반환값: 받은 리슨 소켓 (이전 프로세스가 없거나 실패하면 INVALID_SOCKET_HANDLE, 새로 bind하면 됨)
+        SocketHandle Connect(const std::string& path, uint32_t timeoutMs);
+
+        // 새 프로세스: 엔진 Start 후 호출 (이전 프로세스의 Serve가 반환됨)
+        bool NotifyReady();
+
+        void Close();
+
+        // Listen 이후 인계 요청을 기다리는 중인지 (Serve가 접속을 받은 뒤 실패하면 false, 다시 Listen 필요)
+        bool IsListening() const { return mListenFd >= 0; }
+
+    private:
+        // private 함수
+        // 읽기 가능할 때까지 대기 (0 = 무한)
+        static bool WaitReadable(int fd, uint32_t timeoutMs);
+    };
+
+} // namespace KanchoNet
+
+#endif // KANCHONET_PLATFORM_LINUX
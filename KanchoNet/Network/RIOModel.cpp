@@ -38,6 +38,13 @@ namespace KanchoNet
 
         mConfig = config;
 
+        // 리슨 소켓 인계는 Linux 전용 (SCM_RIGHTS)
+        if (mConfig.mInheritedListenSocket != INVALID_SOCKET_HANDLE)
+        {
+            LOG_ERROR("Inherited listen socket is not supported by RIOModel");
+            return false;
+        }
+
         // RIO 지원 여부 확인
         if (!IsRIOSupported())
         {
@@ -93,7 +100,7 @@ namespace KanchoNet
         }
 
         // 세션 매니저 생성
-        mSessionManager = std::make_unique<SessionManager>(mConfig.mMaxSessions);
+        mSessionManager = std::make_unique<SessionManager>(mConfig.mMaxSessions, mConfig.mBufferArenaSize, mConfig.mArenaHugePages);
 
         mInitialized = true;
         LOG_INFO("RIOModel initialized successfully. Port: %u", mConfig.mPort);
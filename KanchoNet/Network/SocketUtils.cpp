@@ -1,5 +1,6 @@
 #include "SocketUtils.h"
 #include "../Utils/Logger.h"
+#include <cstring>
 
 #ifdef KANCHONET_PLATFORM_WINDOWS
     #include <WS2tcpip.h>
@@ -22,6 +23,19 @@
 #elif defined(KANCHONET_PLATFORM_LINUX)
     #include <sys/ioctl.h>
     #include <netinet/tcp.h>
+
+    // glibc 헤더가 오래된 경우 (커널 3.11 / 5.11 이상에서 지원)
+    #ifndef SO_BUSY_POLL
+        #define SO_BUSY_POLL 46
+    #endif
+
+    #ifndef SO_PREFER_BUSY_POLL
+        #define SO_PREFER_BUSY_POLL 69
+    #endif
+
+    #ifndef SO_INCOMING_CPU
+        #define SO_INCOMING_CPU 49
+    #endif
 #endif
 
 namespace KanchoNet
@@ -230,6 +244,119 @@ namespace KanchoNet
         return result == 0;
     }
 
+    bool SocketUtils::SetListenOption(SocketHandle socket, const EngineConfig& config)
+    {
+        // 첫 데이터가 올 때까지 accept를 미뤄 핸드셰이크만 끝난 연결로 깨어나지 않게 함
+        if (config.mDeferAcceptSec > 0 && !SetDeferAccept(socket, config.mDeferAcceptSec))
+        {
+            LOG_WARNING("Failed to set TCP_DEFER_ACCEPT option");
+        }
+
+        // 재접속 클라이언트는 SYN에 첫 데이터를 실어 보낼 수 있음
+        if (config.mFastOpenQueue > 0 && !SetFastOpen(socket, config.mFastOpenQueue))
+        {
+            LOG_WARNING("Failed to set TCP_FASTOPEN option");
+        }
+
+        // 수락된 소켓이 상속하므로 리슨 소켓에 한 번만 설정
+        if (config.mSocketBusyPollUs > 0 && !SetBusyPoll(socket, config.mSocketBusyPollUs))
+        {
+            LOG_WARNING("Failed to set SO_BUSY_POLL option (CAP_NET_ADMIN may be required)");
+        }
+
+        // 같은 포트를 여러 엔진(리액터)이 나눠 받음
+        if (config.mReusePort && !SetReusePort(socket, true))
+        {
+            LOG_WARNING("Failed to set SO_REUSEPORT option");
+        }
+
+        // 이 CPU에서 수신 처리된 연결이 이 리슨 소켓으로 오도록 함 (SO_REUSEPORT 그룹 안에서 우선 선택)
+        if (config.mIncomingCpu >= 0 && !SetIncomingCpu(socket, config.mIncomingCpu))
+        {
+            LOG_WARNING("Failed to set SO_INCOMING_CPU option");
+        }
+
+        return true;
+    }
+
+    bool SocketUtils::SetDeferAccept(SocketHandle socket, uint32_t seconds)
+    {
+        #ifdef KANCHONET_PLATFORM_WINDOWS
+            (void)socket;
+            (void)seconds;
+            return false;
+        #elif defined(KANCHONET_PLATFORM_LINUX)
+            int optval = static_cast<int>(seconds);
+            int result = setsockopt(socket, IPPROTO_TCP, TCP_DEFER_ACCEPT, 
+                                    &optval, sizeof(optval));
+            return result == 0;
+        #endif
+    }
+
+    bool SocketUtils::SetFastOpen(SocketHandle socket, uint32_t queueLength)
+    {
+        #ifdef KANCHONET_PLATFORM_WINDOWS
+            (void)socket;
+            (void)queueLength;
+            return false;
+        #elif defined(KANCHONET_PLATFORM_LINUX)
+            int optval = static_cast<int>(queueLength);
+            int result = setsockopt(socket, IPPROTO_TCP, TCP_FASTOPEN, 
+                                    &optval, sizeof(optval));
+            return result == 0;
+        #endif
+    }
+
+    bool SocketUtils::SetBusyPoll(SocketHandle socket, uint32_t microseconds)
+    {
+        #ifdef KANCHONET_PLATFORM_WINDOWS
+            (void)socket;
+            (void)microseconds;
+            return false;
+        #elif defined(KANCHONET_PLATFORM_LINUX)
+            int optval = static_cast<int>(microseconds);
+            int result = setsockopt(socket, SOL_SOCKET, SO_BUSY_POLL, 
+                                    &optval, sizeof(optval));
+            if (result != 0)
+            {
+                return false;
+            }
+
+            // epoll 대기에서도 바쁜 대기를 우선 (커널 5.11 이상, 없으면 무시)
+            int prefer = 1;
+            setsockopt(socket, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer, sizeof(prefer));
+            return true;
+        #endif
+    }
+
+    bool SocketUtils::SetReusePort(SocketHandle socket, bool reuse)
+    {
+        #ifdef KANCHONET_PLATFORM_WINDOWS
+            (void)socket;
+            (void)reuse;
+            return false;
+        #elif defined(KANCHONET_PLATFORM_LINUX)
+            int optval = reuse ? 1 : 0;
+            int result = setsockopt(socket, SOL_SOCKET, SO_REUSEPORT, 
+                                    &optval, sizeof(optval));
+            return result == 0;
+        #endif
+    }
+
+    bool SocketUtils::SetIncomingCpu(SocketHandle socket, int32_t cpu)
+    {
+        #ifdef KANCHONET_PLATFORM_WINDOWS
+            (void)socket;
+            (void)cpu;
+            return false;
+        #elif defined(KANCHONET_PLATFORM_LINUX)
+            int optval = cpu;
+            int result = setsockopt(socket, SOL_SOCKET, SO_INCOMING_CPU, 
+                                    &optval, sizeof(optval));
+            return result == 0;
+        #endif
+    }
+
     bool SocketUtils::BindSocket(SocketHandle socket, uint16_t port)
     {
         sockaddr_in addr = {};
@@ -295,6 +422,57 @@ namespace KanchoNet
         }
     }
 
+    void SocketUtils::ShutdownSend(SocketHandle socket)
+    {
+        if (socket != INVALID_SOCKET_HANDLE)
+        {
+            #ifdef KANCHONET_PLATFORM_WINDOWS
+                shutdown(socket, SD_SEND);
+            #elif defined(KANCHONET_PLATFORM_LINUX)
+                shutdown(socket, SHUT_WR);
+            #endif
+        }
+    }
+
+    uint64_t SocketUtils::GetAddressKey(const struct sockaddr* address)
+    {
+        if (!address)
+        {
+            return 0;
+        }
+
+        if (address->sa_family == AF_INET)
+        {
+            const struct sockaddr_in* ipv4 = reinterpret_cast<const struct sockaddr_in*>(address);
+            uint32_t ip;
+            memcpy(&ip, &ipv4->sin_addr, sizeof(ip));
+            return ip;
+        }
+
+        if (address->sa_family == AF_INET6)
+        {
+            const struct sockaddr_in6* ipv6 = reinterpret_cast<const struct sockaddr_in6*>(address);
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&ipv6->sin6_addr);
+
+            // ::ffff:a.b.c.d
+            static const uint8_t MAPPED_PREFIX[12] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF };
+            if (memcmp(bytes, MAPPED_PREFIX, sizeof(MAPPED_PREFIX)) == 0)
+            {
+                uint32_t ip;
+                memcpy(&ip, bytes + 12, sizeof(ip));
+                return ip;
+            }
+
+            uint64_t high;
+            uint64_t low;
+            memcpy(&high, bytes, sizeof(high));
+            memcpy(&low, bytes + 8, sizeof(low));
+            return high ^ (low * 0x9E3779B97F4A7C15ull) ^ (1ull << 63);
+        }
+
+        return 0;
+    }
+
     int SocketUtils::GetLastSocketError()
     {
         #ifdef KANCHONET_PLATFORM_WINDOWS
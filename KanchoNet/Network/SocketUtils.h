@@ -54,6 +54,14 @@ namespace KanchoNet
         static bool SetKeepAlive(SocketHandle socket, bool enable, uint32_t time, uint32_t interval);
         static bool SetSendBufferSize(SocketHandle socket, int size);
         static bool SetRecvBufferSize(SocketHandle socket, int size);
+
+        // 리슨 소켓 전용 설정 (TCP_DEFER_ACCEPT, TCP_FASTOPEN, SO_REUSEPORT 등, bind 전에 호출)
+        static bool SetListenOption(SocketHandle socket, const EngineConfig& config);
+        static bool SetDeferAccept(SocketHandle socket, uint32_t seconds);
+        static bool SetFastOpen(SocketHandle socket, uint32_t queueLength);
+        static bool SetBusyPoll(SocketHandle socket, uint32_t microseconds);
+        static bool SetReusePort(SocketHandle socket, bool reuse);
+        static bool SetIncomingCpu(SocketHandle socket, int32_t cpu);
         
         // 소켓 바인드/리슨
         static bool BindSocket(SocketHandle socket, uint16_t port);
@@ -62,7 +70,11 @@ namespace KanchoNet
         // 소켓 닫기
         static void CloseSocket(SocketHandle socket);
         static void ShutdownSocket(SocketHandle socket);
+        static void ShutdownSend(SocketHandle socket);  // 송신 방향만 닫기 (상대에게 FIN, 수신은 계속)
         
+        // 주소 키 (출발지 IP별 제한용, 포트 제외, IPv4-mapped IPv6는 IPv4와 같은 키)
+        static uint64_t GetAddressKey(const struct sockaddr* address);
+
         // 에러 처리
         static int GetLastSocketError();
         static const char* GetSocketErrorString(int errorCode);
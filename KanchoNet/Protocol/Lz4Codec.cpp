@@ -0,0 +1,369 @@
+#include "Lz4Codec.h"
+#include <cstring>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace KanchoNet
+{
+    namespace
+    {
+        // 일치 실패가 2^SKIP_TRIGGER번 이어질 때마다 탐색 간격을 1바이트씩 늘림
+        constexpr uint32_t SKIP_TRIGGER = 6;
+        constexpr uint32_t MIN_HASH_LOG = 8;
+        constexpr size_t MAX_INPUT_SIZE = 0x7E000000;   // LZ4 블록 형식 한도
+        constexpr size_t RUN_MASK = 15;                 // 토큰의 길이 필드 (4비트) 최댓값
+
+        inline uint32_t Read32(const uint8_t* p)
+        {
+            uint32_t value;
+            memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        inline uint64_t Read64(const uint8_t* p)
+        {
+            uint64_t value;
+            memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        inline uint32_t Hash(uint32_t sequence, uint32_t hashLog)
+        {
+            return (sequence * 2654435761u) >> (32 - hashLog);
+        }
+
+        inline uint32_t CountTrailingZeros(uint64_t value)
+        {
+#ifdef _MSC_VER
+            unsigned long index;
+            _BitScanForward64(&index, value);
+            return static_cast<uint32_t>(index);
+#else
+            return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+        }
+
+        // p와 match가 limit 전까지 같은 바이트 수 (8바이트씩 비교, 리틀 엔디안 CPU 기준)
+        inline size_t CountMatch(const uint8_t* p, const uint8_t* match, const uint8_t* limit)
+        {
+            const uint8_t* const start = p;
+            while (p + sizeof(uint64_t) <= limit)
+            {
+                const uint64_t diff = Read64(p) ^ Read64(match);
+                if (diff != 0)
+                {
+                    return static_cast<size_t>(p - start) + CountTrailingZeros(diff) / 8;
+                }
+                p += sizeof(uint64_t);
+                match += sizeof(uint64_t);
+            }
+
+            while (p < limit && *p == *match)
+            {
+                ++p;
+                ++match;
+            }
+            return static_cast<size_t>(p - start);
+        }
+
+        // 고정 크기 복사 (짧은 리터럴/일치를 memcpy 호출 없이, 양쪽에 COPY_SIZE 이상 남았을 때만)
+        constexpr size_t COPY_SIZE = 16;
+
+        inline void Copy16(uint8_t* dst, const uint8_t* src)
+        {
+            memcpy(dst, src, COPY_SIZE);
+        }
+
+        inline void Copy8(uint8_t* dst, const uint8_t* src)
+        {
+            memcpy(dst, src, sizeof(uint64_t));
+        }
+
+        // 토큰에 다 담지 못한 길이를 쓰는 데 필요한 추가 바이트
+        inline size_t GetLengthBytes(size_t length)
+        {
+            return length >= RUN_MASK ? (length - RUN_MASK) / 255 + 1 : 0;
+        }
+
+        inline uint8_t* WriteLength(uint8_t* op, size_t length)
+        {
+            length -= RUN_MASK;
+            while (length >= 255)
+            {
+                *op++ = 255;
+                length -= 255;
+            }
+            *op++ = static_cast<uint8_t>(length);
+            return op;
+        }
+
+        inline bool ReadLength(const uint8_t*& ip, const uint8_t* iend, size_t& length)
+        {
+            uint8_t value;
+            do
+            {
+                if (ip >= iend)
+                {
+                    return false;
+                }
+                value = *ip++;
+                length += value;
+            } while (value == 255);
+            return true;
+        }
+
+        // 입력 크기에 맞춘 해시 테이블 크기 (작은 메시지마다 16KB를 지우지 않도록)
+        inline uint32_t GetHashLog(size_t srcSize)
+        {
+            uint32_t hashLog = MIN_HASH_LOG;
+            while (hashLog < Lz4Codec::MAX_HASH_LOG && (static_cast<size_t>(1) << hashLog) < srcSize)
+            {
+                ++hashLog;
+            }
+            return hashLog;
+        }
+    }
+
+    size_t Lz4Codec::Compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity)
+    {
+        if ((!src && srcSize > 0) || !dst || srcSize > MAX_INPUT_SIZE)
+        {
+            return 0;
+        }
+
+        // 위치는 src 기준 오프셋으로 저장 (MAX_INPUT_SIZE가 32비트 안에 들어감)
+        thread_local uint32_t hashTable[static_cast<size_t>(1) << MAX_HASH_LOG];
+
+        const uint8_t* ip = src;
+        const uint8_t* anchor = src;
+        const uint8_t* const iend = src + srcSize;
+        uint8_t* op = dst;
+        uint8_t* const oend = dst + dstCapacity;
+
+        if (srcSize > MATCH_FIND_LIMIT)
+        {
+            const uint32_t hashLog = GetHashLog(srcSize);
+            memset(hashTable, 0, sizeof(uint32_t) << hashLog);
+
+            const uint8_t* const mflimit = iend - MATCH_FIND_LIMIT;
+            const uint8_t* const matchLimit = iend - LAST_LITERALS;
+
+            // 비운 테이블은 모두 src[0]을 가리키므로 첫 위치는 등록된 것과 같음
+            ++ip;
+            while (true)
+            {
+                // 일치 찾기 (테이블의 후보는 항상 ip보다 앞)
+                const uint8_t* match = nullptr;
+                uint32_t searchCount = 1u << SKIP_TRIGGER;
+                while (ip <= mflimit)
+                {
+                    const uint32_t hash = Hash(Read32(ip), hashLog);
+                    const uint8_t* candidate = src + hashTable[hash];
+                    hashTable[hash] = static_cast<uint32_t>(ip - src);
+
+                    if (static_cast<size_t>(ip - candidate) <= MAX_DISTANCE && Read32(candidate) == Read32(ip))
+                    {
+                        match = candidate;
+                        break;
+                    }
+
+                    ip += searchCount++ >> SKIP_TRIGGER;
+                }
+
+                if (!match)
+                {
+                    break;
+                }
+
+                // 앞쪽으로 일치 확장
+                while (ip > anchor && match > src && ip[-1] == match[-1])
+                {
+                    --ip;
+                    --match;
+                }
+
+                const size_t literalLength = static_cast<size_t>(ip - anchor);
+                const size_t matchLength = MIN_MATCH + CountMatch(ip + MIN_MATCH, match + MIN_MATCH, matchLimit);
+                const size_t required = 1 + GetLengthBytes(literalLength) + literalLength + 2 + GetLengthBytes(matchLength - MIN_MATCH);
+                if (required > static_cast<size_t>(oend - op))
+                {
+                    return 0;
+                }
+
+                // 시퀀스: [토큰][리터럴 길이 추가][리터럴][오프셋 LE16][일치 길이 추가]
+                uint8_t* token = op++;
+                if (literalLength >= RUN_MASK)
+                {
+                    *token = static_cast<uint8_t>(RUN_MASK << 4);
+                    op = WriteLength(op, literalLength);
+                }
+                else
+                {
+                    *token = static_cast<uint8_t>(literalLength << 4);
+                }
+
+                if (literalLength <= COPY_SIZE && static_cast<size_t>(iend - anchor) >= COPY_SIZE && static_cast<size_t>(oend - op) >= COPY_SIZE)
+                {
+                    Copy16(op, anchor);
+                }
+                else
+                {
+                    memcpy(op, anchor, literalLength);
+                }
+                op += literalLength;
+
+                const size_t offset = static_cast<size_t>(ip - match);
+                *op++ = static_cast<uint8_t>(offset);
+                *op++ = static_cast<uint8_t>(offset >> 8);
+
+                if (matchLength - MIN_MATCH >= RUN_MASK)
+                {
+                    *token |= static_cast<uint8_t>(RUN_MASK);
+                    op = WriteLength(op, matchLength - MIN_MATCH);
+                }
+                else
+                {
+                    *token |= static_cast<uint8_t>(matchLength - MIN_MATCH);
+                }
+
+                ip += matchLength;
+                anchor = ip;
+                if (ip > mflimit)
+                {
+                    break;
+                }
+
+                // 일치 끝 부근도 등록 (이어지는 반복 패턴을 바로 찾도록)
+                hashTable[Hash(Read32(ip - 2), hashLog)] = static_cast<uint32_t>(ip - 2 - src);
+            }
+        }
+
+        // 마지막 리터럴
+        const size_t literalLength = static_cast<size_t>(iend - anchor);
+        if (1 + GetLengthBytes(literalLength) + literalLength > static_cast<size_t>(oend - op))
+        {
+            return 0;
+        }
+
+        if (literalLength >= RUN_MASK)
+        {
+            *op++ = static_cast<uint8_t>(RUN_MASK << 4);
+            op = WriteLength(op, literalLength);
+        }
+        else
+        {
+            *op++ = static_cast<uint8_t>(literalLength << 4);
+        }
+
+        if (literalLength > 0)
+        {
+            memcpy(op, anchor, literalLength);
+            op += literalLength;
+        }
+
+        return static_cast<size_t>(op - dst);
+    }
+
+    bool Lz4Codec::Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize)
+    {
+        if (!src || (!dst && dstSize > 0))
+        {
+            return false;
+        }
+
+        const uint8_t* ip = src;
+        const uint8_t* const iend = src + srcSize;
+        uint8_t* op = dst;
+        uint8_t* const oend = dst + dstSize;
+
+        while (ip < iend)
+        {
+            const uint8_t token = *ip++;
+
+            // 리터럴
+            size_t literalLength = token >> 4;
+            if (literalLength == RUN_MASK && !ReadLength(ip, iend, literalLength))
+            {
+                return false;
+            }
+
+            if (literalLength > static_cast<size_t>(iend - ip) || literalLength > static_cast<size_t>(oend - op))
+            {
+                return false;
+            }
+
+            if (literalLength <= COPY_SIZE && static_cast<size_t>(iend - ip) >= COPY_SIZE && static_cast<size_t>(oend - op) >= COPY_SIZE)
+            {
+                Copy16(op, ip);
+            }
+            else if (literalLength > 0)
+            {
+                memcpy(op, ip, literalLength);
+            }
+            op += literalLength;
+            ip += literalLength;
+
+            // 마지막 시퀀스는 리터럴만 있음
+            if (ip == iend)
+            {
+                return op == oend;
+            }
+
+            // 일치
+            if (iend - ip < 2)
+            {
+                return false;
+            }
+
+            const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+            ip += 2;
+            if (offset == 0 || offset > static_cast<size_t>(op - dst))
+            {
+                return false;
+            }
+
+            size_t matchLength = token & RUN_MASK;
+            if (matchLength == RUN_MASK && !ReadLength(ip, iend, matchLength))
+            {
+                return false;
+            }
+            matchLength += MIN_MATCH;
+
+            if (matchLength > static_cast<size_t>(oend - op))
+            {
+                return false;
+            }
+
+            const uint8_t* match = op - offset;
+            uint8_t* const matchEnd = op + matchLength;
+            if (offset >= sizeof(uint64_t) && static_cast<size_t>(oend - matchEnd) >= sizeof(uint64_t))
+            {
+                // 8바이트 단위로 앞에서부터 복사 (offset이 8 이상이면 읽는 바이트는 이미 다 쓴 것, 끝을 조금 넘겨 써도 되는 경우만)
+                do
+                {
+                    Copy8(op, match);
+                    op += sizeof(uint64_t);
+                    match += sizeof(uint64_t);
+                } while (op < matchEnd);
+            }
+            else if (offset >= matchLength)
+            {
+                memcpy(op, match, matchLength);
+            }
+            else
+            {
+                // 짧은 주기의 반복 패턴: 앞에서부터 한 바이트씩
+                for (uint8_t* out = op; out < matchEnd; ++out)
+                {
+                    *out = *match++;
+                }
+            }
+            op = matchEnd;
+        }
+
+        return false;
+    }
+
+} // namespace KanchoNet
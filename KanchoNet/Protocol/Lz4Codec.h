@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../Types.h"
+
+namespace KanchoNet
+{
+    // LZ4 블록 형식 압축/해제 (외부 라이브러리 없음, 결과는 표준 LZ4 블록과 호환)
+    // 한 번의 해시 조회로 일치를 찾는 빠른 압축 (일치가 없을수록 건너뛰는 간격이 커짐)
+    // 작은 입력은 해시 테이블도 작게 써서 초기화 비용을 줄임
+    class Lz4Codec
+    {
+    public:
+        // public 멤버변수
+        static constexpr size_t MIN_MATCH = 4;
+        static constexpr size_t LAST_LITERALS = 5;      // 블록 끝 5바이트는 항상 리터럴
+        static constexpr size_t MATCH_FIND_LIMIT = 12;  // 마지막 일치는 끝에서 12바이트 앞에서 시작해야 함
+        static constexpr size_t MAX_DISTANCE = 65535;
+        static constexpr uint32_t MAX_HASH_LOG = 12;    // 해시 테이블 최대 4096개 (스레드별 16KB)
+
+    public:
+        // public 함수
+        // 압축 결과가 가질 수 있는 최대 크기 (압축할 수 없는 입력)
+        static constexpr size_t GetMaxCompressedSize(size_t size) { return size + size / 255 + 16; }
+
+        // 압축
+        // 반환값: 압축한 크기 (dstCapacity를 넘으면 0, 원본 전송 여부 판단에 사용)
+        static size_t Compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity);
+
+        // 해제 (원본 크기는 프레임 헤더 등으로 미리 알고 있어야 함)
+        // 반환값: 정확히 dstSize 바이트로 해제되었는지 (손상/악의적인 입력이면 false, 범위를 벗어나 읽거나 쓰지 않음)
+        static bool Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+    };
+
+} // namespace KanchoNet
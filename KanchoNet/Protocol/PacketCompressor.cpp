@@ -0,0 +1,184 @@
+#include "PacketCompressor.h"
+#include "Lz4Codec.h"
+#include <algorithm>
+#include <cstring>
+
+namespace KanchoNet
+{
+    namespace
+    {
+        inline void StoreUInt32(uint8_t* out, uint32_t value)
+        {
+            out[0] = static_cast<uint8_t>(value);
+            out[1] = static_cast<uint8_t>(value >> 8);
+            out[2] = static_cast<uint8_t>(value >> 16);
+            out[3] = static_cast<uint8_t>(value >> 24);
+        }
+
+        inline uint32_t LoadUInt32(const uint8_t* in)
+        {
+            return static_cast<uint32_t>(in[0])
+                | (static_cast<uint32_t>(in[1]) << 8)
+                | (static_cast<uint32_t>(in[2]) << 16)
+                | (static_cast<uint32_t>(in[3]) << 24);
+        }
+    }
+
+    PacketCompressor::PacketCompressor(const CompressionConfig& config, HugePageArena* arena)
+        : mConfig(config)
+        , mPool(config.mPoolBufferSize, config.mPoolInitialCount, arena)
+    {
+        mConfig.mMinSavingsPercent = (std::min)(mConfig.mMinSavingsPercent, 99u);
+    }
+
+    size_t PacketCompressor::Encode(const void* data, size_t size, uint8_t* out, size_t capacity) const
+    {
+        if ((!data && size > 0) || !out || size > MAX_PAYLOAD_SIZE)
+        {
+            return 0;
+        }
+
+        const uint8_t* source = static_cast<const uint8_t*>(data);
+
+        if (ShouldCompress(size) && capacity > COMPRESSED_HEADER_SIZE)
+        {
+            // 압축 프레임이 원본 프레임보다 mMinSavingsPercent 이상 작아야 함
+            // 압축기에 그 한도만 주면 넘는 순간 포기하므로 압축되지 않는 데이터에 끝까지 CPU를 쓰지 않음
+            const size_t rawFrameSize = HEADER_SIZE + size;
+            const size_t maxFrameSize = rawFrameSize - rawFrameSize * mConfig.mMinSavingsPercent / 100;
+            if (maxFrameSize > COMPRESSED_HEADER_SIZE)
+            {
+                const size_t budget = (std::min)(maxFrameSize, capacity) - COMPRESSED_HEADER_SIZE;
+                const size_t compressedSize = Lz4Codec::Compress(source, size, out + COMPRESSED_HEADER_SIZE, budget);
+                if (compressedSize > 0)
+                {
+                    StoreUInt32(out, static_cast<uint32_t>(compressedSize) | COMPRESSED_FLAG);
+                    StoreUInt32(out + HEADER_SIZE, static_cast<uint32_t>(size));
+                    return COMPRESSED_HEADER_SIZE + compressedSize;
+                }
+            }
+        }
+
+        if (capacity < HEADER_SIZE || size > capacity - HEADER_SIZE)
+        {
+            return 0;
+        }
+
+        StoreUInt32(out, static_cast<uint32_t>(size));
+        if (size > 0)
+        {
+            memcpy(out + HEADER_SIZE, source, size);
+        }
+        return HEADER_SIZE + size;
+    }
+
+    bool PacketCompressor::Encode(const void* data, size_t size, PacketBuffer& buffer) const
+    {
+        if (size > MAX_PAYLOAD_SIZE)
+        {
+            return false;
+        }
+
+        // 원본 프레임이 들어갈 만큼 잡고 (압축 프레임은 항상 이보다 작음) 쓴 만큼으로 줄임
+        const size_t offset = buffer.GetSize();
+        buffer.Resize(offset + HEADER_SIZE + size);
+
+        const size_t written = Encode(data, size, buffer.GetData() + offset, HEADER_SIZE + size);
+        buffer.Resize(offset + written);
+        return written > 0;
+    }
+
+    SharedPacketBuffer PacketCompressor::EncodeShared(const void* data, size_t size) const
+    {
+        auto frame = std::make_shared<PacketBuffer>();
+        if (!Encode(data, size, *frame))
+        {
+            return nullptr;
+        }
+
+        return frame;
+    }
+
+    FrameResult PacketCompressor::Decode(RingBuffer& buffer, std::unique_ptr<PacketBuffer>& packet)
+    {
+        uint8_t header[COMPRESSED_HEADER_SIZE];
+        const size_t peeked = buffer.Peek(header, sizeof(header));
+        if (peeked < HEADER_SIZE)
+        {
+            return FrameResult::Incomplete;
+        }
+
+        const uint32_t word = LoadUInt32(header);
+        const bool compressed = (word & COMPRESSED_FLAG) != 0;
+        const size_t payloadSize = word & ~COMPRESSED_FLAG;
+        const size_t headerSize = compressed ? COMPRESSED_HEADER_SIZE : HEADER_SIZE;
+
+        // 버퍼에 다 들어갈 수 없는 프레임은 기다려도 완성되지 않음
+        const size_t frameLimit = buffer.GetCapacity() - 1 - headerSize;
+        if (payloadSize > frameLimit || (!compressed && payloadSize > mConfig.mMaxMessageSize))
+        {
+            return FrameResult::TooLarge;
+        }
+
+        if (peeked < headerSize)
+        {
+            return FrameResult::Incomplete;
+        }
+
+        const size_t originalSize = compressed ? LoadUInt32(header + HEADER_SIZE) : payloadSize;
+        if (originalSize > mConfig.mMaxMessageSize)
+        {
+            return FrameResult::TooLarge;
+        }
+
+        const size_t frameSize = headerSize + payloadSize;
+        if (buffer.GetAvailableRead() < frameSize)
+        {
+            return FrameResult::Incomplete;
+        }
+
+        std::unique_ptr<PacketBuffer> out = mPool.Allocate();
+        out->Resize(originalSize);
+
+        if (!compressed)
+        {
+            buffer.Skip(HEADER_SIZE);
+            buffer.Read(out->GetData(), payloadSize);
+            packet = std::move(out);
+            return FrameResult::Decoded;
+        }
+
+        // 연속 구간이면 수신 버퍼에서 바로, 감싸진 프레임은 작업 버퍼에 모은 뒤 해제
+        const uint8_t* source;
+        if (frameSize <= buffer.GetContiguousReadSize())
+        {
+            source = buffer.GetReadPtr() + headerSize;
+        }
+        else
+        {
+            PacketBuffer& scratch = GetThreadScratch();
+            scratch.Resize(frameSize);
+            buffer.Peek(scratch.GetData(), frameSize);
+            source = scratch.GetData() + headerSize;
+        }
+
+        const bool decompressed = Lz4Codec::Decompress(source, payloadSize, out->GetData(), originalSize);
+        buffer.CommitRead(frameSize);
+
+        if (!decompressed)
+        {
+            mPool.Deallocate(std::move(out));
+            return FrameResult::Corrupted;
+        }
+
+        packet = std::move(out);
+        return FrameResult::Decoded;
+    }
+
+    PacketBuffer& PacketCompressor::GetThreadScratch()
+    {
+        thread_local PacketBuffer scratch;
+        return scratch;
+    }
+
+} // namespace KanchoNet
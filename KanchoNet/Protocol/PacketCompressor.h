@@ -0,0 +1,134 @@
+#pragma once
+
+#include "../Types.h"
+#include "../Buffer/BufferPool.h"
+#include "../Buffer/PacketBuffer.h"
+#include "../Buffer/RingBuffer.h"
+#include "../Utils/NonCopyable.h"
+#include <memory>
+
+namespace KanchoNet
+{
+    class Session;
+
+    // 메시지 압축 설정
+    struct CompressionConfig
+    {
+    public:
+        // public 멤버변수
+        bool mEnabled = true;                   // false면 압축하지 않고 프레이밍만 (수신 측 해제는 항상 가능)
+        size_t mThreshold = 512;                // 이 크기 이상인 메시지만 압축 (작은 메시지는 줄어드는 양보다 CPU가 더 듦)
+        uint32_t mMinSavingsPercent = 10;       // 프레임이 이 비율 이상 줄지 않으면 원본 전송 (압축 도중 한도를 넘으면 바로 포기)
+        size_t mMaxMessageSize = 1024 * 1024;   // 수신 시 허용하는 원본 최대 크기 (해제 결과 크기)
+        size_t mPoolBufferSize = 16 * 1024;     // 해제 버퍼 풀의 버퍼 초기 용량
+        size_t mPoolInitialCount = 16;          // 해제 버퍼 풀의 초기 버퍼 수
+    };
+
+    // 프레임 디코딩 결과
+    enum class FrameResult : uint8_t
+    {
+        Decoded = 0,        // 메시지 하나를 꺼내고 프레임만큼 소비
+        Incomplete,         // 프레임이 아직 다 오지 않음 (소비하지 않음)
+        TooLarge,           // 길이가 한도를 넘음 (소비하지 않음, 보통 연결 종료)
+        Corrupted           // 압축 데이터가 잘못됨 (프레임만큼 소비, 보통 연결 종료)
+    };
+
+    // 메시지 단위 압축 프레이밍 (LZ4 블록, Lz4Codec)
+    // 어플리케이션 패킷(자체 헤더 포함)을 그대로 감싸며, 압축 여부는 프레임 헤더의 최상위 비트로 표시
+    //
+    // 프레임 형식 (리틀 엔디안)
+    // - 원본:  [uint32 본문 길이][본문]
+    // - 압축:  [uint32 본문 길이 | COMPRESSED_FLAG][uint32 원본 길이][LZ4 블록]
+    //
+    // 송신: mThreshold 이상이고 mMinSavingsPercent 이상 줄어드는 메시지만 압축
+    //       브로드캐스트는 EncodeShared로 한 번만 압축해 모든 세션에 SendShared (세션마다 압축하지 않음)
+    // 수신: OnReceive 데이터를 세션 수신 버퍼(session->GetRecvBuffer())에 쌓고 Decode로 한 프레임씩 꺼냄
+    //       결과는 풀 버퍼이며 처리한 뒤 Release로 반환
+    //
+    // 여러 I/O 스레드에서 동시에 사용할 수 있음 (압축 상태는 스레드별, 버퍼 풀은 락으로 보호)
+    class PacketCompressor : public NonCopyable
+    {
+    public:
+        // public 멤버변수
+        static constexpr uint32_t COMPRESSED_FLAG = 0x80000000u;
+        static constexpr size_t MAX_PAYLOAD_SIZE = 0x7FFFFFFFu;
+        static constexpr size_t HEADER_SIZE = 4;
+        static constexpr size_t COMPRESSED_HEADER_SIZE = 8;
+
+    private:
+        // private 멤버변수
+        CompressionConfig mConfig;
+        BufferPool mPool;
+
+    public:
+        // 생성자, 파괴자
+        // arena: 해제 버퍼 풀 저장소를 둘 아레나 (NetworkEngine::GetBufferArena, nullptr이면 일반 힙)
+        explicit PacketCompressor(const CompressionConfig& config = CompressionConfig(), HugePageArena* arena = nullptr);
+        ~PacketCompressor() = default;
+
+    public:
+        // public 함수
+        // 프레임 하나를 out에 기록
+        // 반환값: 쓴 바이트 (capacity가 모자라면 0이며 내용은 의미 없음)
+        size_t Encode(const void* data, size_t size, uint8_t* out, size_t capacity) const;
+
+        // 프레임 하나를 PacketBuffer 끝에 기록
+        bool Encode(const void* data, size_t size, PacketBuffer& buffer) const;
+
+        // 브로드캐스트용: 한 번 압축한 프레임을 여러 세션에 SendShared로 공유 (실패하면 nullptr)
+        SharedPacketBuffer EncodeShared(const void* data, size_t size) const;
+
+        // 세션에 메시지 전송
+        // 압축하지 않는 메시지는 송신 버퍼에 바로 프레이밍 (NetworkEngine::SendInPlace)
+        // 압축할 메시지는 세션 락을 잡기 전에 스레드별 버퍼에 압축한 뒤 Send
+        template<typename TEngine>
+        bool Send(TEngine& engine, Session* session, const void* data, size_t size) const
+        {
+            if (!ShouldCompress(size))
+            {
+                const bool sent = engine.SendInPlace(session, [this, data, size](RingBuffer& buffer) -> size_t {
+                    const size_t written = Encode(data, size, buffer.GetWritePtr(), buffer.GetContiguousWriteSize());
+                    if (written > 0)
+                    {
+                        buffer.CommitWrite(written);
+                    }
+                    return written;
+                });
+                if (sent)
+                {
+                    return true;
+                }
+            }
+
+            PacketBuffer& frame = GetThreadScratch();
+            frame.Clear();
+            return Encode(data, size, frame) && engine.Send(session, frame);
+        }
+
+        template<typename TEngine>
+        bool Send(TEngine& engine, Session* session, const PacketBuffer& packet) const
+        {
+            return Send(engine, session, packet.GetData(), packet.GetSize());
+        }
+
+        // 프레임 하나 디코딩 (원본 메시지를 풀 버퍼에 담아 packet으로 넘김)
+        FrameResult Decode(RingBuffer& buffer, std::unique_ptr<PacketBuffer>& packet);
+
+        // Decode로 받은 버퍼 반환
+        void Release(std::unique_ptr<PacketBuffer> packet) { mPool.Deallocate(std::move(packet)); }
+
+        // 압축 대상 여부 (크기 기준)
+        bool ShouldCompress(size_t size) const { return mConfig.mEnabled && size >= mConfig.mThreshold; }
+
+        const CompressionConfig& GetConfig() const { return mConfig; }
+
+        // 해제 버퍼 풀 (NetworkEngine::RegisterBufferPool로 메트릭에 노출 가능)
+        const BufferPool& GetBufferPool() const { return mPool; }
+
+    private:
+        // private 함수
+        // 호출 스레드 전용 작업 버퍼 (송신 압축, 감싸진 수신 프레임 모으기)
+        static PacketBuffer& GetThreadScratch();
+    };
+
+} // namespace KanchoNet
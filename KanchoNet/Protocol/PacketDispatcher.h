@@ -0,0 +1,204 @@
+#pragma once
+
+#include "../Types.h"
+#include <array>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+namespace KanchoNet
+{
+    // 패킷 디스패치 결과
+    enum class DispatchResult : uint8_t
+    {
+        Handled = 0,        // 핸들러 실행
+        Incomplete,         // 헤더나 헤더에 적힌 크기만큼의 데이터가 아직 없음
+        InvalidSize,        // 헤더에 적힌 크기가 패킷 구조체 크기와 다름
+        UnknownPacket       // 등록되지 않은 패킷 ID
+    };
+
+    // 헤더에서 패킷 ID와 전체 크기(헤더 포함)를 읽는 방법
+    // 기본 구현은 type/size 멤버를 사용하며, 필드 이름이 다른 헤더는 특수화해서 사용
+    template<typename THeader>
+    struct PacketHeaderTraits
+    {
+        static size_t GetID(const THeader& header) { return static_cast<size_t>(header.type); }
+        static size_t GetSize(const THeader& header) { return static_cast<size_t>(header.size); }
+    };
+
+    // 패킷 ID 하나의 핸들러
+    // TPacket: 헤더를 포함한 고정 크기 패킷 구조체 (trivially copyable)
+    // Handler: 멤버 함수 void (C::*)(Session*, const TPacket&) 또는 함수 void (*)(C&, Session*, const TPacket&)
+    template<auto Id, typename TPacket, auto Handler>
+    struct PacketHandler
+    {
+        static_assert(std::is_trivially_copyable<TPacket>::value, "Packet struct must be trivially copyable");
+
+        using Packet = TPacket;
+        static constexpr size_t ID = static_cast<size_t>(Id);
+        static constexpr auto HANDLER = Handler;
+    };
+
+    // 패킷 ID -> 핸들러 점프 테이블
+    // 등록한 핸들러로 컴파일 타임에 ID 인덱스 함수 포인터 표를 만들고, 패킷마다 표 조회 한 번으로 핸들러를 호출
+    // 핸들러를 호출하기 전에 헤더에 적힌 크기가 패킷 구조체 크기와 같은지 확인 (가상 호출/힙 할당 없음)
+    //
+    // using Dispatcher = PacketDispatcher<PacketHeader,
+    //     PacketHandler<PacketType::Login, LoginPacket, &ChatServer::HandleLogin>,
+    //     PacketHandler<PacketType::Message, MessagePacket, &ChatServer::HandleMessage>>;
+    //
+    // Dispatcher::Dispatch(*this, session, data, size);
+    //
+    // 표 크기는 가장 큰 ID + 1이므로 ID는 작은 정수여야 함 (MAX_TABLE_SIZE 이하)
+    template<typename THeader, typename... THandlers>
+    class PacketDispatcher
+    {
+    public:
+        // public 멤버변수
+        static constexpr size_t MAX_TABLE_SIZE = 4096;
+
+    private:
+        // private 멤버변수
+        using Traits = PacketHeaderTraits<THeader>;
+
+        static_assert(sizeof...(THandlers) > 0, "PacketDispatcher needs at least one handler");
+        static_assert(std::is_trivially_copyable<THeader>::value, "Packet header must be trivially copyable");
+
+        static constexpr size_t GetMaxID()
+        {
+            size_t maxID = 0;
+            for (size_t id : { THandlers::ID... })
+            {
+                maxID = id > maxID ? id : maxID;
+            }
+            return maxID;
+        }
+
+        static constexpr bool HasUniqueIDs()
+        {
+            const size_t ids[] = { THandlers::ID... };
+            for (size_t i = 0; i < sizeof...(THandlers); ++i)
+            {
+                for (size_t j = i + 1; j < sizeof...(THandlers); ++j)
+                {
+                    if (ids[i] == ids[j])
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        static constexpr size_t TABLE_SIZE = GetMaxID() + 1;
+
+        static_assert(TABLE_SIZE <= MAX_TABLE_SIZE, "Packet ID is too large for a jump table");
+        static_assert(HasUniqueIDs(), "Duplicate packet ID in PacketDispatcher");
+
+        // 표 항목 (핸들러가 없는 ID는 mInvoke가 nullptr)
+        template<typename TContext>
+        struct Entry
+        {
+            void (*mInvoke)(TContext&, Session*, const uint8_t*);
+            size_t mSize;
+        };
+
+        template<typename TContext>
+        using Table = std::array<Entry<TContext>, TABLE_SIZE>;
+
+    public:
+        // public 함수
+        // 패킷 하나 처리 (data는 패킷 시작, size는 읽을 수 있는 바이트, 뒤에 다음 패킷이 이어져도 됨)
+        // context: 멤버 함수 핸들러의 객체 또는 함수 핸들러의 첫 번째 인자
+        template<typename TContext>
+        static DispatchResult Dispatch(TContext& context, Session* session, const uint8_t* data, size_t size)
+        {
+            if (size < sizeof(THeader))
+            {
+                return DispatchResult::Incomplete;
+            }
+
+            THeader header;
+            memcpy(&header, data, sizeof(header));
+            const size_t id = Traits::GetID(header);
+            const size_t packetSize = Traits::GetSize(header);
+
+            if (packetSize > size)
+            {
+                return DispatchResult::Incomplete;
+            }
+
+            if (id >= TABLE_SIZE || !TABLE<TContext>[id].mInvoke)
+            {
+                return DispatchResult::UnknownPacket;
+            }
+
+            const Entry<TContext>& entry = TABLE<TContext>[id];
+            if (packetSize != entry.mSize)
+            {
+                return DispatchResult::InvalidSize;
+            }
+
+            entry.mInvoke(context, session, data);
+            return DispatchResult::Handled;
+        }
+
+        // 헤더에 적힌 패킷 크기 (헤더가 아직 다 오지 않았으면 0, 스트림에서 패킷 경계를 나눌 때 사용)
+        static size_t GetPacketSize(const uint8_t* data, size_t size)
+        {
+            if (size < sizeof(THeader))
+            {
+                return 0;
+            }
+
+            THeader header;
+            memcpy(&header, data, sizeof(header));
+            return Traits::GetSize(header);
+        }
+
+        // 등록된 ID인지
+        static constexpr bool IsRegistered(size_t id)
+        {
+            for (size_t registered : { THandlers::ID... })
+            {
+                if (registered == id)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+        // private 함수
+        // 핸들러 호출 (정렬이 맞으면 수신 버퍼를 그대로, 아니면 스택에 복사해서 넘김)
+        template<typename TContext, typename THandler>
+        static void Invoke(TContext& context, Session* session, const uint8_t* data)
+        {
+            using Packet = typename THandler::Packet;
+
+            if (reinterpret_cast<uintptr_t>(data) % alignof(Packet) == 0)
+            {
+                std::invoke(THandler::HANDLER, context, session, *reinterpret_cast<const Packet*>(data));
+            }
+            else
+            {
+                Packet packet;
+                memcpy(&packet, data, sizeof(packet));
+                std::invoke(THandler::HANDLER, context, session, static_cast<const Packet&>(packet));
+            }
+        }
+
+        template<typename TContext>
+        static constexpr Table<TContext> BuildTable()
+        {
+            Table<TContext> table{};
+            ((table[THandlers::ID] = Entry<TContext>{ &Invoke<TContext, THandlers>, sizeof(typename THandlers::Packet) }), ...);
+            return table;
+        }
+
+        template<typename TContext>
+        static constexpr Table<TContext> TABLE = BuildTable<TContext>();
+    };
+
+} // namespace KanchoNet
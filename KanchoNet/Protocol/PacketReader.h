@@ -0,0 +1,202 @@
+#pragma once
+
+#include "../Types.h"
+#include "../Buffer/PacketBuffer.h"
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace KanchoNet
+{
+    // 바이너리 패킷 역직렬화 (PacketWriter와 같은 형식)
+    // 모든 읽기는 남은 길이를 확인하며, 한 번 실패하면 이후 읽기도 모두 실패 (끝에서 IsValid()로 한 번만 확인해도 됨)
+    // 문자열은 복사 없이 수신 버퍼를 가리키는 string_view로 읽을 수 있음 (버퍼가 유효한 동안만 사용)
+    //
+    // PacketReader reader(data, size);
+    // PacketHeader header;
+    // std::string_view username, message;
+    // reader.ReadBytes(&header, sizeof(header));
+    // reader.ReadString(username);
+    // reader.ReadString(message);
+    // if (!reader.IsValid()) { /* 잘린 패킷 */ }
+    class PacketReader
+    {
+    public:
+        // public 멤버변수
+        static constexpr size_t MAX_VARINT_SIZE = 10;
+
+    private:
+        // private 멤버변수
+        const uint8_t* mData;
+        size_t mSize;
+        size_t mPosition;
+        bool mValid;
+
+    public:
+        // 생성자, 파괴자
+        PacketReader(const uint8_t* data, size_t size)
+            : mData(data)
+            , mSize(data ? size : 0)
+            , mPosition(0)
+            , mValid(true)
+        {
+        }
+
+        explicit PacketReader(const PacketBuffer& buffer)
+            : PacketReader(buffer.GetData(), buffer.GetSize())
+        {
+        }
+
+        ~PacketReader() = default;
+
+    public:
+        // public 함수
+        // 정수/실수/enum (리틀 엔디안)
+        template<typename T>
+        bool Read(T& value)
+        {
+            static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "PacketReader::Read needs an arithmetic or enum type");
+
+            const uint8_t* in = Consume(sizeof(T));
+            if (!in)
+            {
+                return false;
+            }
+
+            using Bits = typename std::conditional<sizeof(T) == 1, uint8_t,
+                         typename std::conditional<sizeof(T) == 2, uint16_t,
+                         typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type>::type>::type;
+            static_assert(sizeof(Bits) == sizeof(T), "Unsupported primitive size");
+
+            Bits bits = 0;
+            for (size_t i = 0; i < sizeof(T); ++i)
+            {
+                bits |= static_cast<Bits>(static_cast<Bits>(in[i]) << (8 * i));
+            }
+            memcpy(&value, &bits, sizeof(value));
+            return true;
+        }
+
+        // 가변 길이 정수 (10바이트를 넘거나 잘렸으면 실패)
+        bool ReadVarint(uint64_t& value)
+        {
+            value = 0;
+            for (size_t i = 0; i < MAX_VARINT_SIZE; ++i)
+            {
+                const uint8_t* in = Consume(1);
+                if (!in)
+                {
+                    return false;
+                }
+
+                value |= static_cast<uint64_t>(*in & 0x7F) << (7 * i);
+                if ((*in & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+
+            mValid = false;
+            return false;
+        }
+
+        bool ReadVarintSigned(int64_t& value)
+        {
+            uint64_t encoded;
+            if (!ReadVarint(encoded))
+            {
+                return false;
+            }
+
+            value = static_cast<int64_t>(encoded >> 1) ^ -static_cast<int64_t>(encoded & 1);
+            return true;
+        }
+
+        // 원시 바이트 복사
+        bool ReadBytes(void* out, size_t size)
+        {
+            const uint8_t* in = Consume(size);
+            if (!in)
+            {
+                return false;
+            }
+
+            if (size > 0)
+            {
+                memcpy(out, in, size);
+            }
+            return true;
+        }
+
+        // 원시 바이트를 복사 없이 가리킴
+        bool ReadSpan(size_t size, const uint8_t*& out)
+        {
+            out = Consume(size);
+            return out != nullptr;
+        }
+
+        // 문자열 (varint 길이 + 바이트)
+        // maxLength: 허용할 최대 길이 (0이면 남은 길이까지)
+        bool ReadString(std::string_view& value, size_t maxLength = 0)
+        {
+            uint64_t length;
+            if (!ReadVarint(length))
+            {
+                return false;
+            }
+
+            if (maxLength != 0 && length > maxLength)
+            {
+                mValid = false;
+                return false;
+            }
+
+            const uint8_t* in = Consume(length);
+            if (!in)
+            {
+                return false;
+            }
+
+            value = std::string_view(reinterpret_cast<const char*>(in), static_cast<size_t>(length));
+            return true;
+        }
+
+        bool ReadString(std::string& value, size_t maxLength = 0)
+        {
+            std::string_view view;
+            if (!ReadString(view, maxLength))
+            {
+                return false;
+            }
+
+            value.assign(view.data(), view.size());
+            return true;
+        }
+
+        bool Skip(size_t size) { return Consume(size) != nullptr; }
+
+        // 상태
+        bool IsValid() const { return mValid; }
+        size_t GetPosition() const { return mPosition; }
+        size_t GetRemaining() const { return mSize - mPosition; }
+        bool IsEnd() const { return mPosition == mSize; }
+
+    private:
+        // private 함수
+        // size바이트를 읽을 위치 (남은 길이가 모자라면 nullptr, 이후 읽기는 모두 실패)
+        const uint8_t* Consume(uint64_t size)
+        {
+            if (!mValid || size > mSize - mPosition)
+            {
+                mValid = false;
+                return nullptr;
+            }
+
+            const uint8_t* in = mData + mPosition;
+            mPosition += static_cast<size_t>(size);
+            return in;
+        }
+    };
+
+} // namespace KanchoNet
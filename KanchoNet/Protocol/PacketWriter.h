@@ -0,0 +1,248 @@
+#pragma once
+
+#include "../Types.h"
+#include "../Buffer/PacketBuffer.h"
+#include "../Buffer/RingBuffer.h"
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace KanchoNet
+{
+    // 바이너리 패킷 직렬화
+    // 정수/실수/enum은 리틀 엔디안, 가변 길이 정수는 varint(7비트 단위, 부호 있는 값은 zigzag), 문자열은 varint 길이 + 바이트
+    //
+    // 쓰기 대상
+    // - PacketBuffer: 끝에 이어 쓰며 필요한 만큼 늘어남
+    // - 고정 구간 (송신 버퍼의 연속 공간 등): 공간을 넘는 쓰기는 하지 않고 IsValid()가 false가 됨 (이후 쓰기는 모두 무시)
+    //
+    // 헤더처럼 길이를 나중에 알 수 있는 필드는 Reserve로 자리를 잡아두고 Patch로 채움
+    //
+    // PacketWriter writer(buffer);
+    // const size_t header = writer.Reserve(sizeof(PacketHeader));
+    // writer.WriteString(username);
+    // writer.WriteString(message);
+    // writer.Patch<uint16_t>(header, static_cast<uint16_t>(writer.GetSize()));
+    // writer.Patch(header + 2, PacketType::MessageBroadcast);
+    class PacketWriter
+    {
+    public:
+        // public 멤버변수
+        static constexpr size_t MAX_VARINT_SIZE = 10;
+
+    private:
+        // private 멤버변수
+        PacketBuffer* mBuffer;      // PacketBuffer 모드 (고정 구간 모드면 nullptr)
+        size_t mBase;               // PacketBuffer에서 이 writer가 쓰기 시작한 위치
+        uint8_t* mData;             // 고정 구간 모드의 시작
+        size_t mCapacity;
+        size_t mSize;               // 이 writer가 쓴 바이트
+        bool mValid;
+
+    public:
+        // 생성자, 파괴자
+        // PacketBuffer 끝에 이어 쓰기
+        explicit PacketWriter(PacketBuffer& buffer)
+            : mBuffer(&buffer)
+            , mBase(buffer.GetSize())
+            , mData(nullptr)
+            , mCapacity(0)
+            , mSize(0)
+            , mValid(true)
+        {
+        }
+
+        // 고정 구간에 쓰기
+        PacketWriter(uint8_t* data, size_t capacity)
+            : mBuffer(nullptr)
+            , mBase(0)
+            , mData(data)
+            , mCapacity(data ? capacity : 0)
+            , mSize(0)
+            , mValid(true)
+        {
+        }
+
+        ~PacketWriter() = default;
+
+    public:
+        // public 함수
+        // 정수/실수/enum (리틀 엔디안)
+        template<typename T>
+        void Write(T value)
+        {
+            static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "PacketWriter::Write needs an arithmetic or enum type");
+
+            uint8_t* out = Acquire(sizeof(T));
+            if (out)
+            {
+                StoreLittleEndian(out, value);
+            }
+        }
+
+        // 가변 길이 정수 (작은 값일수록 짧음, 0~127은 1바이트)
+        void WriteVarint(uint64_t value)
+        {
+            uint8_t bytes[MAX_VARINT_SIZE];
+            size_t count = 0;
+            while (value >= 0x80)
+            {
+                bytes[count++] = static_cast<uint8_t>(value | 0x80);
+                value >>= 7;
+            }
+            bytes[count++] = static_cast<uint8_t>(value);
+
+            WriteBytes(bytes, count);
+        }
+
+        // 부호 있는 가변 길이 정수 (zigzag: 절댓값이 작은 음수도 짧음)
+        void WriteVarintSigned(int64_t value)
+        {
+            WriteVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+        }
+
+        // 원시 바이트
+        void WriteBytes(const void* data, size_t size)
+        {
+            if (size == 0)
+            {
+                return;
+            }
+
+            uint8_t* out = Acquire(size);
+            if (out)
+            {
+                memcpy(out, data, size);
+            }
+        }
+
+        // 문자열/바이트열 (varint 길이 + 바이트, 종료 문자 없음)
+        void WriteString(std::string_view value)
+        {
+            WriteVarint(value.size());
+            WriteBytes(value.data(), value.size());
+        }
+
+        // size바이트 자리 확보 (0으로 채움)
+        // 반환값: 확보한 위치 (이 writer가 쓰기 시작한 지점 기준, Patch에 사용)
+        size_t Reserve(size_t size)
+        {
+            const size_t offset = mSize;
+            uint8_t* out = Acquire(size);
+            if (out)
+            {
+                memset(out, 0, size);
+            }
+            return offset;
+        }
+
+        // 이미 쓴 위치에 값 덮어쓰기 (Reserve한 헤더 채우기)
+        template<typename T>
+        void Patch(size_t offset, T value)
+        {
+            static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "PacketWriter::Patch needs an arithmetic or enum type");
+
+            if (!mValid || offset + sizeof(T) > mSize)
+            {
+                mValid = false;
+                return;
+            }
+
+            StoreLittleEndian(GetData() + offset, value);
+        }
+
+        void PatchBytes(size_t offset, const void* data, size_t size)
+        {
+            if (!mValid || offset + size > mSize)
+            {
+                mValid = false;
+                return;
+            }
+
+            memcpy(GetData() + offset, data, size);
+        }
+
+        // 쓴 바이트 (공간 부족으로 실패했으면 의미 없음)
+        size_t GetSize() const { return mSize; }
+
+        // 지금까지의 쓰기가 모두 성공했는지
+        bool IsValid() const { return mValid; }
+
+        // 이 writer가 쓴 데이터의 시작
+        uint8_t* GetData() { return mBuffer ? mBuffer->GetData() + mBase : mData; }
+
+        // 세션에 바로 패킷 전송
+        // 송신 버퍼의 연속 공간에 직접 쓰고(NetworkEngine::SendInPlace), 공간이 모자라거나 지원하지 않는 모델이면 PacketBuffer에 써서 Send
+        // build(PacketWriter&)는 대체 경로에서 한 번 더 호출될 수 있으므로 같은 내용을 써야 함
+        template<typename TEngine, typename TBuild>
+        static bool Send(TEngine& engine, Session* session, TBuild&& build)
+        {
+            const bool sent = engine.SendInPlace(session, [&build](RingBuffer& buffer) -> size_t {
+                PacketWriter writer(buffer.GetWritePtr(), buffer.GetContiguousWriteSize());
+                build(writer);
+                if (!writer.IsValid() || writer.GetSize() == 0)
+                {
+                    return 0;
+                }
+
+                buffer.CommitWrite(writer.GetSize());
+                return writer.GetSize();
+            });
+            if (sent)
+            {
+                return true;
+            }
+
+            PacketBuffer packet;
+            PacketWriter writer(packet);
+            build(writer);
+            return writer.IsValid() && engine.Send(session, packet);
+        }
+
+    private:
+        // private 함수
+        // size바이트를 쓸 위치 (실패하면 nullptr, 이후 쓰기는 모두 실패)
+        uint8_t* Acquire(size_t size)
+        {
+            if (!mValid)
+            {
+                return nullptr;
+            }
+
+            const size_t offset = mSize;
+            if (mBuffer)
+            {
+                mBuffer->Resize(mBase + offset + size);
+                mSize += size;
+                return mBuffer->GetData() + mBase + offset;
+            }
+
+            if (size > mCapacity - offset)
+            {
+                mValid = false;
+                return nullptr;
+            }
+
+            mSize += size;
+            return mData + offset;
+        }
+
+        template<typename T>
+        static void StoreLittleEndian(uint8_t* out, T value)
+        {
+            // 실수/enum은 같은 크기의 부호 없는 정수로 옮긴 뒤 하위 바이트부터 기록 (리틀 엔디안 CPU에서는 mov 하나로 최적화됨)
+            using Bits = typename std::conditional<sizeof(T) == 1, uint8_t,
+                         typename std::conditional<sizeof(T) == 2, uint16_t,
+                         typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type>::type>::type;
+            static_assert(sizeof(Bits) == sizeof(T), "Unsupported primitive size");
+
+            Bits bits;
+            memcpy(&bits, &value, sizeof(bits));
+            for (size_t i = 0; i < sizeof(T); ++i)
+            {
+                out[i] = static_cast<uint8_t>(bits >> (8 * i));
+            }
+        }
+    };
+
+} // namespace KanchoNet
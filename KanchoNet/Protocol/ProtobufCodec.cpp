@@ -0,0 +1,254 @@
+#include "ProtobufCodec.h"
+
+#ifdef KANCHONET_HAS_PROTOBUF
+
+#include <google/protobuf/io/coded_stream.h>
+#include <algorithm>
+#include <climits>
+
+namespace KanchoNet
+{
+    RingBufferInputStream::RingBufferInputStream(const RingBuffer& buffer, size_t offset, size_t limit)
+        : mSegments{ nullptr, nullptr }
+        , mSizes{ 0, 0 }
+        , mLimit(0)
+        , mPosition(0)
+    {
+        const uint8_t* segments[2];
+        size_t sizes[2];
+        buffer.GetReadSegments(segments, sizes);
+
+        // 앞의 offset 바이트를 건너뛰고 limit 바이트만 남김
+        for (int i = 0; i < 2; ++i)
+        {
+            const size_t skip = (std::min)(offset, sizes[i]);
+            offset -= skip;
+
+            const size_t take = (std::min)(sizes[i] - skip, limit - mLimit);
+            if (take == 0)
+            {
+                continue;
+            }
+
+            const int index = mSizes[0] == 0 ? 0 : 1;
+            mSegments[index] = segments[i] + skip;
+            mSizes[index] = take;
+            mLimit += take;
+        }
+    }
+
+    bool RingBufferInputStream::Next(const void** data, int* size)
+    {
+        if (mPosition >= mLimit)
+        {
+            return false;
+        }
+
+        if (mPosition < mSizes[0])
+        {
+            *data = mSegments[0] + mPosition;
+            *size = static_cast<int>(mSizes[0] - mPosition);
+        }
+        else
+        {
+            *data = mSegments[1] + (mPosition - mSizes[0]);
+            *size = static_cast<int>(mLimit - mPosition);
+        }
+
+        mPosition += static_cast<size_t>(*size);
+        return true;
+    }
+
+    void RingBufferInputStream::BackUp(int count)
+    {
+        mPosition -= (std::min)(static_cast<size_t>(count), mPosition);
+    }
+
+    bool RingBufferInputStream::Skip(int count)
+    {
+        if (static_cast<size_t>(count) > mLimit - mPosition)
+        {
+            mPosition = mLimit;
+            return false;
+        }
+
+        mPosition += static_cast<size_t>(count);
+        return true;
+    }
+
+    RingBufferOutputStream::RingBufferOutputStream(RingBuffer& buffer)
+        : mLimit(0)
+        , mPosition(0)
+    {
+        buffer.GetWriteSegments(mSegments, mSizes);
+        mLimit = mSizes[0] + mSizes[1];
+    }
+
+    bool RingBufferOutputStream::Next(void** data, int* size)
+    {
+        if (mPosition >= mLimit)
+        {
+            return false;
+        }
+
+        if (mPosition < mSizes[0])
+        {
+            *data = mSegments[0] + mPosition;
+            *size = static_cast<int>(mSizes[0] - mPosition);
+        }
+        else
+        {
+            *data = mSegments[1] + (mPosition - mSizes[0]);
+            *size = static_cast<int>(mLimit - mPosition);
+        }
+
+        mPosition += static_cast<size_t>(*size);
+        return true;
+    }
+
+    void RingBufferOutputStream::BackUp(int count)
+    {
+        mPosition -= (std::min)(static_cast<size_t>(count), mPosition);
+    }
+
+    ProtobufArena::ProtobufArena(size_t blockSize)
+        : mInitialBlock(new char[blockSize])
+        , mArena(MakeOptions(mInitialBlock.get(), blockSize))
+    {
+    }
+
+    ProtobufArena& ProtobufArena::GetThreadArena()
+    {
+        thread_local ProtobufArena arena;
+        return arena;
+    }
+
+    google::protobuf::ArenaOptions ProtobufArena::MakeOptions(char* block, size_t blockSize)
+    {
+        google::protobuf::ArenaOptions options;
+        options.initial_block = block;
+        options.initial_block_size = blockSize;
+
+        // 첫 블록을 넘치면 같은 크기 단위로 추가 (Reset 시 추가 블록만 해제)
+        options.start_block_size = blockSize;
+        options.max_block_size = blockSize;
+        return options;
+    }
+
+    DecodeResult ProtobufCodec::Decode(RingBuffer& buffer, google::protobuf::MessageLite& message, size_t maxMessageSize)
+    {
+        uint32_t length = 0;
+        const int prefixSize = ReadPrefix(buffer, length);
+        if (prefixSize == 0)
+        {
+            return DecodeResult::Incomplete;
+        }
+        if (prefixSize < 0)
+        {
+            return DecodeResult::ParseError;
+        }
+
+        // 버퍼에 다 들어갈 수 없는 프레임은 기다려도 완성되지 않음
+        const size_t frameLimit = buffer.GetCapacity() - 1 - static_cast<size_t>(prefixSize);
+        if (length > (maxMessageSize != 0 ? (std::min)(maxMessageSize, frameLimit) : frameLimit))
+        {
+            return DecodeResult::TooLarge;
+        }
+
+        const size_t frameSize = static_cast<size_t>(prefixSize) + length;
+        if (buffer.GetAvailableRead() < frameSize)
+        {
+            return DecodeResult::Incomplete;
+        }
+
+        bool parsed;
+        if (frameSize <= buffer.GetContiguousReadSize())
+        {
+            parsed = message.ParseFromArray(buffer.GetReadPtr() + prefixSize, static_cast<int>(length));
+        }
+        else
+        {
+            RingBufferInputStream stream(buffer, static_cast<size_t>(prefixSize), length);
+            parsed = message.ParseFromZeroCopyStream(&stream);
+        }
+
+        buffer.CommitRead(frameSize);
+        return parsed ? DecodeResult::Decoded : DecodeResult::ParseError;
+    }
+
+    size_t ProtobufCodec::Encode(RingBuffer& buffer, const google::protobuf::MessageLite& message)
+    {
+        const size_t bodySize = message.ByteSizeLong();
+        if (bodySize > INT_MAX)
+        {
+            return 0;
+        }
+
+        const uint32_t length = static_cast<uint32_t>(bodySize);
+        const size_t frameSize = google::protobuf::io::CodedOutputStream::VarintSize32(length) + bodySize;
+        if (frameSize > buffer.GetAvailableWrite())
+        {
+            return 0;
+        }
+
+        if (frameSize <= buffer.GetContiguousWriteSize())
+        {
+            // 연속 공간이면 배열로 바로 직렬화 (가장 빠른 경로)
+            uint8_t* out = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(length, buffer.GetWritePtr());
+            message.SerializeWithCachedSizesToArray(out);
+        }
+        else
+        {
+            RingBufferOutputStream stream(buffer);
+            google::protobuf::io::CodedOutputStream coded(&stream);
+            coded.WriteVarint32(length);
+            message.SerializeWithCachedSizes(&coded);
+            if (coded.HadError())
+            {
+                return 0;
+            }
+        }
+
+        buffer.CommitWrite(frameSize);
+        return frameSize;
+    }
+
+    bool ProtobufCodec::Encode(const google::protobuf::MessageLite& message, PacketBuffer& buffer)
+    {
+        const size_t bodySize = message.ByteSizeLong();
+        if (bodySize > INT_MAX)
+        {
+            return false;
+        }
+
+        const uint32_t length = static_cast<uint32_t>(bodySize);
+        const size_t offset = buffer.GetSize();
+        buffer.Resize(offset + google::protobuf::io::CodedOutputStream::VarintSize32(length) + bodySize);
+
+        uint8_t* out = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(length, buffer.GetData() + offset);
+        message.SerializeWithCachedSizesToArray(out);
+        return true;
+    }
+
+    int ProtobufCodec::ReadPrefix(const RingBuffer& buffer, uint32_t& length)
+    {
+        uint8_t prefix[MAX_PREFIX_SIZE];
+        const size_t available = buffer.Peek(prefix, sizeof(prefix));
+
+        length = 0;
+        for (size_t i = 0; i < available; ++i)
+        {
+            length |= static_cast<uint32_t>(prefix[i] & 0x7F) << (7 * i);
+            if ((prefix[i] & 0x80) == 0)
+            {
+                // 5번째 바이트는 하위 4비트만 유효
+                return (i == MAX_PREFIX_SIZE - 1 && prefix[i] > 0x0F) ? -1 : static_cast<int>(i + 1);
+            }
+        }
+
+        return available < MAX_PREFIX_SIZE ? 0 : -1;
+    }
+
+} // namespace KanchoNet
+
+#endif // KANCHONET_HAS_PROTOBUF
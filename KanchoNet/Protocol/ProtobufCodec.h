@@ -0,0 +1,168 @@
+#pragma once
+
+#include "../Platform.h"
+
+// Protobuf 연동은 선택 구성 요소
+// CMake: -DKANCHONET_WITH_PROTOBUF=ON (KANCHONET_HAS_PROTOBUF 정의 + libprotobuf 링크)
+// Visual Studio: 전처리기에 KANCHONET_HAS_PROTOBUF를 정의하고 libprotobuf를 링크
+#ifdef KANCHONET_HAS_PROTOBUF
+
+#include "../Types.h"
+#include "../Buffer/RingBuffer.h"
+#include "../Buffer/PacketBuffer.h"
+#include "../Utils/NonCopyable.h"
+#include <google/protobuf/arena.h>
+#include <google/protobuf/io/zero_copy_stream.h>
+#include <google/protobuf/message_lite.h>
+#include <memory>
+
+namespace KanchoNet
+{
+    // RingBuffer의 읽을 수 있는 데이터 중 [offset, offset + limit) 구간을 복사 없이 읽는 스트림
+    // 끝을 넘어 감싼 데이터는 두 번의 Next로 나눠 돌려줌 (읽기 위치는 옮기지 않으므로 다 읽은 뒤 호출자가 CommitRead)
+    class RingBufferInputStream : public google::protobuf::io::ZeroCopyInputStream, public NonCopyable
+    {
+    public:
+        // public 멤버변수 (없음)
+
+    private:
+        // private 멤버변수
+        const uint8_t* mSegments[2];
+        size_t mSizes[2];
+        size_t mLimit;
+        size_t mPosition;
+
+    public:
+        // 생성자, 파괴자
+        RingBufferInputStream(const RingBuffer& buffer, size_t offset, size_t limit);
+        ~RingBufferInputStream() override = default;
+
+    public:
+        // public 함수
+        bool Next(const void** data, int* size) override;
+        void BackUp(int count) override;
+        bool Skip(int count) override;
+        int64_t ByteCount() const override { return static_cast<int64_t>(mPosition); }
+    };
+
+    // RingBuffer의 쓸 수 있는 공간에 복사 없이 쓰는 스트림
+    // 쓰기 위치는 옮기지 않으므로 다 쓴 뒤 호출자가 ByteCount()만큼 CommitWrite
+    class RingBufferOutputStream : public google::protobuf::io::ZeroCopyOutputStream, public NonCopyable
+    {
+    public:
+        // public 멤버변수 (없음)
+
+    private:
+        // private 멤버변수
+        uint8_t* mSegments[2];
+        size_t mSizes[2];
+        size_t mLimit;
+        size_t mPosition;
+
+    public:
+        // 생성자, 파괴자
+        explicit RingBufferOutputStream(RingBuffer& buffer);
+        ~RingBufferOutputStream() override = default;
+
+    public:
+        // public 함수
+        bool Next(void** data, int* size) override;
+        void BackUp(int count) override;
+        int64_t ByteCount() const override { return static_cast<int64_t>(mPosition); }
+    };
+
+    // 디코딩한 메시지를 담는 스레드별 아레나
+    // 메시지마다 힙 할당/해제하는 대신 아레나에서 잘라 쓰고, 수신 콜백 한 번이 끝나면 Reset으로 한꺼번에 반환
+    // 첫 블록은 아레나가 소유한 고정 블록이라 Reset 후에도 재사용됨 (보통 크기의 메시지는 malloc 없음)
+    class ProtobufArena : public NonCopyable
+    {
+    public:
+        // public 멤버변수
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    private:
+        // private 멤버변수
+        std::unique_ptr<char[]> mInitialBlock;  // mArena보다 먼저 생성되어야 함
+        google::protobuf::Arena mArena;
+
+    public:
+        // 생성자, 파괴자
+        explicit ProtobufArena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+        ~ProtobufArena() = default;
+
+    public:
+        // public 함수
+        // 아레나에 메시지 생성 (Reset 전까지 유효, delete 하면 안 됨)
+        template<typename TMessage>
+        TMessage* Create() { return google::protobuf::Arena::CreateMessage<TMessage>(&mArena); }
+
+        // 이 아레나에서 만든 메시지를 모두 해제 (첫 블록은 남겨 재사용)
+        void Reset() { mArena.Reset(); }
+
+        uint64_t GetSpaceUsed() const { return mArena.SpaceUsed(); }
+        google::protobuf::Arena* GetArena() { return &mArena; }
+
+        // 호출 스레드(I/O 스레드 또는 태스크 워커) 전용 아레나
+        static ProtobufArena& GetThreadArena();
+
+    private:
+        // private 함수
+        static google::protobuf::ArenaOptions MakeOptions(char* block, size_t blockSize);
+    };
+
+    // 메시지 디코딩 결과
+    enum class DecodeResult : uint8_t
+    {
+        Decoded = 0,        // 메시지 하나를 읽고 프레임만큼 소비
+        Incomplete,         // 프레임이 아직 다 오지 않음 (소비하지 않음)
+        TooLarge,           // 길이가 한도를 넘음 (소비하지 않음, 보통 연결 종료)
+        ParseError          // 길이 접두사나 본문이 잘못됨 (본문 오류면 프레임만큼 소비)
+    };
+
+    // 길이 접두사(varint32) 프레이밍 Protobuf 코덱
+    // 프레임 형식은 protobuf의 SerializeDelimitedTo*/ParseDelimitedFrom*과 같음 ([varint 길이][메시지])
+    //
+    // 수신: OnReceive 데이터를 세션 수신 버퍼(session->GetRecvBuffer())에 쌓고, 프레임이 완성될 때마다
+    //       아레나 메시지로 디코딩 (연속 구간이면 ParseFromArray, 감싸진 프레임은 RingBufferInputStream으로 복사 없이)
+    // 송신: Send는 세션 송신 버퍼에 바로 직렬화 (NetworkEngine::SendInPlace, 지원하지 않는 모델은 PacketBuffer로 대체)
+    class ProtobufCodec
+    {
+    public:
+        // public 멤버변수
+        static constexpr size_t MAX_PREFIX_SIZE = 5;
+
+    public:
+        // public 함수
+        // 프레임 하나 디코딩
+        // maxMessageSize: 본문 최대 크기 (0이면 버퍼에 들어갈 수 있는 크기)
+        static DecodeResult Decode(RingBuffer& buffer, google::protobuf::MessageLite& message, size_t maxMessageSize = 0);
+
+        // 프레임 하나를 버퍼 끝에 직렬화
+        // 반환값: 쓴 바이트 (공간이 부족하면 0이며 아무것도 쓰지 않음)
+        static size_t Encode(RingBuffer& buffer, const google::protobuf::MessageLite& message);
+
+        // 프레임 하나를 PacketBuffer 끝에 직렬화 (브로드캐스트는 한 번 만들어 SharedPacketBuffer로 공유)
+        static bool Encode(const google::protobuf::MessageLite& message, PacketBuffer& buffer);
+
+        // 세션에 메시지 전송 (송신 버퍼에 직접 직렬화, 실패하면 PacketBuffer를 거쳐 Send)
+        template<typename TEngine>
+        static bool Send(TEngine& engine, Session* session, const google::protobuf::MessageLite& message)
+        {
+            if (engine.SendInPlace(session, [&message](RingBuffer& buffer) { return Encode(buffer, message); }))
+            {
+                return true;
+            }
+
+            PacketBuffer packet;
+            return Encode(message, packet) && engine.Send(session, packet);
+        }
+
+    private:
+        // private 함수
+        // 길이 접두사 읽기 (반환값: 접두사 바이트, 0이면 아직 다 오지 않음, -1이면 잘못된 접두사)
+        static int ReadPrefix(const RingBuffer& buffer, uint32_t& length);
+    };
+
+} // namespace KanchoNet
+
+#endif // KANCHONET_HAS_PROTOBUF
@@ -1,17 +1,43 @@
 #include "Session.h"
+#include <cstddef>
 
 namespace KanchoNet
 {
-    Session::Session(SessionID id, SocketHandle socket, const SessionConfig& config)
-        : mID(id)
+    Session::Session(SessionID id, SocketHandle socket, const SessionConfig& config, HugePageArena* arena)
+        : mState(SessionState::Idle)
+        , mIsSending(false)
+        , mRefCount(1)
         , mSocket(socket)
-        , mState(SessionState::Idle)
-        , mSendBuffer(config.mMaxPacketSize * 2)  // 송신 버퍼
-        , mRecvBuffer(config.mMaxPacketSize * 2)  // 수신 버퍼
+        , mID(id)
         , mUserData(nullptr)
-        , mIsSending(false)
+        , mSendQueuedTime(0)
+        , mPendingEvents(0)
+        , mDispatching(false)
+        , mReadBacklogged(false)
+        , mReadRound(0)
+        , mReadRoundBytes(0)
+        , mReadRoundCount(0)
+        , mReadPaused(false)
+        , mPriority(SessionPriority::Normal)
         , mConfig(config)
+        , mSendBuffer(config.mMaxPacketSize * 2, arena)  // 송신 버퍼
+        , mRecvBuffer(config.mMaxPacketSize * 2, arena)  // 수신 버퍼
+        , mSendChain(config.mMaxSendQueueSize)    // 세그먼트 송신 큐
     {
+        // 핫 데이터는 첫 캐시 라인 안에 있어야 함 (필드를 추가하면 콜드 영역으로 옮기거나 다른 필드를 줄일 것)
+        // 락 통계를 켜면 SpinLock이 카운터만큼 커져 넘치므로 검사하지 않음 (진단용 빌드)
+        // Strand 때문에 표준 레이아웃이 아니지만 핫 필드는 앞쪽 단순 멤버라 offsetof가 정확함
+    #ifndef KANCHONET_SPINLOCK_STATS
+        #if defined(__GNUC__)
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Winvalid-offsetof"
+        #endif
+        static_assert(offsetof(Session, mPriority) + sizeof(mPriority) <= CACHE_LINE_SIZE,
+                      "Session hot fields must fit in the first cache line");
+        #if defined(__GNUC__)
+            #pragma GCC diagnostic pop
+        #endif
+    #endif
     }
 
     Session::~Session()
@@ -19,14 +45,25 @@ namespace KanchoNet
     }
 
     Session::Session(Session&& other) noexcept
-        : mID(other.mID)
+        : mState(other.mState.load())
+        , mIsSending(other.mIsSending.load())
+        , mRefCount(1)
         , mSocket(other.mSocket)
-        , mState(other.mState.load())
-        , mSendBuffer(std::move(other.mSendBuffer))
-        , mRecvBuffer(std::move(other.mRecvBuffer))
+        , mID(other.mID)
         , mUserData(other.mUserData)
-        , mIsSending(other.mIsSending.load())
+        , mSendQueuedTime(other.mSendQueuedTime)
+        , mPendingEvents(0)
+        , mDispatching(false)
+        , mReadBacklogged(false)
+        , mReadRound(0)
+        , mReadRoundBytes(0)
+        , mReadRoundCount(0)
+        , mReadPaused(false)
+        , mPriority(SessionPriority::Normal)
         , mConfig(other.mConfig)
+        , mSendBuffer(std::move(other.mSendBuffer))
+        , mRecvBuffer(std::move(other.mRecvBuffer))
+        , mSendChain(std::move(other.mSendChain))
     {
         other.mID = INVALID_SESSION_ID;
         other.mSocket = INVALID_SOCKET_HANDLE;
@@ -42,7 +79,9 @@ namespace KanchoNet
             mState.store(other.mState.load());
             mSendBuffer = std::move(other.mSendBuffer);
             mRecvBuffer = std::move(other.mRecvBuffer);
+            mSendChain = std::move(other.mSendChain);
             mUserData = other.mUserData;
+            mSendQueuedTime = other.mSendQueuedTime;
             mIsSending.store(other.mIsSending.load());
             mConfig = other.mConfig;
 
@@ -53,5 +92,82 @@ namespace KanchoNet
         return *this;
     }
 
+    void Session::Reset(SessionID id, SocketHandle socket, const SessionConfig& config)
+    {
+        mState.store(SessionState::Idle, std::memory_order_relaxed);
+        mIsSending.store(false, std::memory_order_relaxed);
+        mRefCount.store(1, std::memory_order_relaxed);
+        mSocket = socket;
+        mID = id;
+        mUserData = nullptr;
+        mSendQueuedTime = 0;
+        mPendingEvents = 0;
+        mDispatching = false;
+        mReadBacklogged = false;
+        mReadRound = 0;
+        mReadRoundBytes = 0;
+        mReadRoundCount = 0;
+        mReadPaused.store(false, std::memory_order_relaxed);
+        mPriority.store(SessionPriority::Normal, std::memory_order_relaxed);
+        mByteBucket = TokenBucket();
+        mMessageBucket = TokenBucket();
+
+        // 버퍼 크기가 같으면 기존 메모리를 그대로 재사용
+        if (config.mMaxPacketSize != mConfig.mMaxPacketSize)
+        {
+            // 기존 버퍼를 먼저 반환해야 아레나에서 같은 크기 블록을 바로 재사용할 수 있음
+            HugePageArena* arena = mSendBuffer.GetArena();
+            mSendBuffer = RingBuffer(0);
+            mRecvBuffer = RingBuffer(0);
+            mSendBuffer = RingBuffer(config.mMaxPacketSize * 2, arena);
+            mRecvBuffer = RingBuffer(config.mMaxPacketSize * 2, arena);
+        }
+        else
+        {
+            mSendBuffer.Clear();
+            mRecvBuffer.Clear();
+        }
+
+        mSendChain.Clear();
+        mSendChain.SetMaxBytes(config.mMaxSendQueueSize);
+        mStrand.Clear();
+        mConfig = config;
+    }
+
+    bool Session::ConsumeReadBudget(uint32_t round, size_t bytes, uint32_t maxBytes, uint32_t maxCount)
+    {
+        if (mReadRound != round)
+        {
+            mReadRound = round;
+            mReadRoundBytes = 0;
+            mReadRoundCount = 0;
+        }
+
+        mReadRoundBytes += static_cast<uint32_t>(bytes);
+        ++mReadRoundCount;
+
+        return (maxBytes != 0 && mReadRoundBytes >= maxBytes) ||
+               (maxCount != 0 && mReadRoundCount >= maxCount);
+    }
+
+    bool Session::ConsumeReceiveRate(size_t bytes, int64_t now, RateLimitAction action)
+    {
+        if (action == RateLimitAction::Drop)
+        {
+            // 횟수를 먼저 확인해 버린 수신이 바이트 버킷을 소비하지 않게 함
+            return mMessageBucket.TryConsume(1, now) && mByteBucket.TryConsume(bytes, now);
+        }
+
+        const bool bytesWithin = mByteBucket.Consume(bytes, now);
+        const bool messagesWithin = mMessageBucket.Consume(1, now);
+        return bytesWithin && messagesWithin;
+    }
+
+    int64_t Session::GetReadResumeTime() const
+    {
+        return std::max(mByteBucket.IsEnabled() ? mByteBucket.GetResumeTime() : 0,
+                        mMessageBucket.IsEnabled() ? mMessageBucket.GetResumeTime() : 0);
+    }
+
 } // namespace KanchoNet
 
@@ -3,7 +3,10 @@
 #include "../Types.h"
 #include "../Buffer/RingBuffer.h"
 #include "../Buffer/PacketBuffer.h"
+#include "../Buffer/SendChain.h"
 #include "../Utils/SpinLock.h"
+#include "../Utils/RateLimiter.h"
+#include "../Task/Strand.h"
 #include "SessionConfig.h"
 #include <memory>
 #include <atomic>
@@ -11,29 +14,48 @@
 namespace KanchoNet
 {
     // 클라이언트 세션을 나타내는 클래스
-    class Session
+    // 리액터가 매 이벤트마다 접근하는 데이터(상태, 락, 소켓)를 첫 캐시 라인에 모으고
+    // 버퍼와 설정 같은 콜드 데이터는 다음 캐시 라인부터 배치 (세션 간/필드 간 False Sharing 방지)
+    class alignas(CACHE_LINE_SIZE) Session
     {
     public:
         // public 멤버변수 (없음)
         
     private:
         // private 멤버변수
-        SessionID mID;
-        SocketHandle mSocket;
+        // 핫 데이터 (첫 번째 캐시 라인)
         std::atomic<SessionState> mState;
+        std::atomic<bool> mIsSending;
+        std::atomic<uint32_t> mRefCount;    // 세션 매니저 1 + 실행 예약된 스트랜드 1 (0이 되면 풀로 반환)
+        SpinLock mLock;
+        SocketHandle mSocket;
+        SessionID mID;
+        void* mUserData;
+        int64_t mSendQueuedTime;    // 송신 큐가 비어있다가 데이터가 들어온 시각 (메트릭용, ns)
+        uint32_t mPendingEvents;    // 디스패치 중에 다른 스레드가 받은 I/O 이벤트 (세션 락을 잡고 접근)
+        bool mDispatching;          // 한 스레드가 이 세션의 I/O 이벤트를 처리 중 (세션 락을 잡고 접근)
+        bool mReadBacklogged;       // 읽기 예산을 다 써서 모델의 읽기 대기 목록에 있음 (목록 락을 잡고 접근)
+        uint32_t mReadRound;        // 읽기 예산을 마지막으로 사용한 처리 회차 (I/O 스레드 전용)
+        uint32_t mReadRoundBytes;   // 그 회차에 읽은 바이트 수
+        uint32_t mReadRoundCount;   // 그 회차에 처리한 수신 횟수
+        std::atomic<bool> mReadPaused;  // 수신 속도 제한/과부하 제한으로 읽기를 멈춤 (바꿀 때는 세션 락을 잡고 관심 이벤트와 함께 갱신)
+        std::atomic<SessionPriority> mPriority; // 과부하 중 수신 제한 순서 (어플리케이션이 아무 스레드에서나 변경)
+        
+        // 수신 속도 제한 (I/O 스레드 전용, 수락할 때 EngineConfig 한도로 초기화)
+        alignas(CACHE_LINE_SIZE) TokenBucket mByteBucket;
+        TokenBucket mMessageBucket;
         
+        // 콜드 데이터
+        alignas(CACHE_LINE_SIZE) SessionConfig mConfig;
         RingBuffer mSendBuffer;
         RingBuffer mRecvBuffer;
-        
-        void* mUserData;
-        std::atomic<bool> mIsSending;
-        
-        SessionConfig mConfig;
-        SpinLock mLock;
+        SendChain mSendChain;  // 세그먼트 송신 큐 (EngineConfig::mUseSendChain 사용 시)
+        Strand mStrand;        // 콜백/작업 직렬 실행 큐
         
     public:
         // 생성자, 파괴자
-        Session(SessionID id, SocketHandle socket, const SessionConfig& config);
+        // arena를 지정하면 송수신 버퍼를 아레나에서 할당
+        Session(SessionID id, SocketHandle socket, const SessionConfig& config, HugePageArena* arena = nullptr);
         ~Session();
 
         // 복사 불가, 이동 가능
@@ -44,6 +66,9 @@ namespace KanchoNet
         
     public:
         // public 함수
+        // 세션 재사용 (SessionPool에서 슬롯을 재활용할 때 호출, 버퍼 메모리는 유지)
+        void Reset(SessionID id, SocketHandle socket, const SessionConfig& config);
+
         // 세션 정보
         SessionID GetID() const { return mID; }
         SocketHandle GetSocket() const { return mSocket; }
@@ -59,6 +84,8 @@ namespace KanchoNet
         RingBuffer& GetRecvBuffer() { return mRecvBuffer; }
         const RingBuffer& GetSendBuffer() const { return mSendBuffer; }
         const RingBuffer& GetRecvBuffer() const { return mRecvBuffer; }
+        SendChain& GetSendChain() { return mSendChain; }
+        const SendChain& GetSendChain() const { return mSendChain; }
 
         // 사용자 데이터 (어플리케이션에서 자유롭게 사용)
         void SetUserData(void* data) { mUserData = data; }
@@ -74,9 +101,52 @@ namespace KanchoNet
         bool IsSending() const { return mIsSending.load(std::memory_order_acquire); }
         void SetSending(bool sending) { mIsSending.store(sending, std::memory_order_release); }
 
+        // 송신 큐 체류 시간 측정용 시각 (세션 락을 잡은 상태에서 접근)
+        void SetSendQueuedTime(int64_t time) { mSendQueuedTime = time; }
+        int64_t GetSendQueuedTime() const { return mSendQueuedTime; }
+
+        // I/O 이벤트 디스패치 상태 (epoll EPOLLONESHOT 모드, 세션 락을 잡은 상태에서 접근)
+        // 디스패치 중에 도착한 이벤트는 mPendingEvents에 모아 두고 디스패치하는 스레드가 이어서 처리
+        bool IsDispatching() const { return mDispatching; }
+        void SetDispatching(bool dispatching) { mDispatching = dispatching; }
+        void AddPendingEvents(uint32_t events) { mPendingEvents |= events; }
+        uint32_t TakePendingEvents() { uint32_t events = mPendingEvents; mPendingEvents = 0; return events; }
+
+        // 수신 공정성 (EngineConfig::mReadBudgetBytes/mReadBudgetCount)
+        // round가 바뀌면 예산을 새로 채우고 이번 수신을 반영 (0 = 무제한)
+        // 반환값: 이번 회차의 예산을 다 썼는지
+        bool ConsumeReadBudget(uint32_t round, size_t bytes, uint32_t maxBytes, uint32_t maxCount);
+        bool IsReadBacklogged() const { return mReadBacklogged; }
+        void SetReadBacklogged(bool backlogged) { mReadBacklogged = backlogged; }
+
+        // 수신 속도 제한 (EngineConfig::mRateLimit*, I/O 스레드 전용)
+        // 수락할 때 모델이 한도를 설정한 버킷을 복사해 넣음
+        void SetRateLimit(const TokenBucket& bytes, const TokenBucket& messages) { mByteBucket = bytes; mMessageBucket = messages; }
+
+        // 이번 수신을 바이트/횟수 버킷에 반영. Drop은 한도를 넘으면 반영하지 않고, 그 외에는 빚으로 남김
+        // 반환값: 한도 안인지
+        bool ConsumeReceiveRate(size_t bytes, int64_t now, RateLimitAction action);
+
+        // 한도를 넘어 멈춘 읽기를 다시 시작해도 되는 시각 (ns)
+        int64_t GetReadResumeTime() const;
+
+        bool IsReadPaused() const { return mReadPaused.load(std::memory_order_acquire); }
+        void SetReadPaused(bool paused) { mReadPaused.store(paused, std::memory_order_release); }
+
+        // 우선순위 (과부하 중에는 EngineConfig::mOverloadShedBelow보다 낮은 세션부터 수신 제한, 기본값 Normal)
+        SessionPriority GetPriority() const { return mPriority.load(std::memory_order_relaxed); }
+        void SetPriority(SessionPriority priority) { mPriority.store(priority, std::memory_order_relaxed); }
+
         // 락 (세션 데이터 동기화용)
         SpinLock& GetLock() { return mLock; }
 
+        // 스트랜드 (이 세션의 콜백과 Post한 작업이 순서대로 하나씩 실행됨)
+        Strand& GetStrand() { return mStrand; }
+
+        // 참조 카운트 (세션 매니저에서 제거된 뒤에도 실행 대기 중인 작업이 있으면 슬롯 반환을 늦춤)
+        void AddRef() { mRefCount.fetch_add(1, std::memory_order_relaxed); }
+        bool ReleaseRef() { return mRefCount.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+
         // 설정
         const SessionConfig& GetConfig() const { return mConfig; }
     };
@@ -15,6 +15,7 @@ namespace KanchoNet
         
         // 버퍼 설정
         size_t mMaxPacketSize = 1024 * 1024;     // 최대 패킷 크기 (기본 1MB)
+        size_t mMaxSendQueueSize = 16 * 1024 * 1024; // 세그먼트 송신 큐 최대 대기 크기 (기본 16MB, 0 = 무제한)
         
     public:
         // 생성자, 파괴자
@@ -3,10 +3,17 @@
 
 namespace KanchoNet
 {
-    SessionManager::SessionManager(uint32_t maxSessions)
+    SessionManager::SessionManager(uint32_t maxSessions, size_t arenaSize, bool useHugePages)
         : mMaxSessions(maxSessions)
         , mNextSessionID(1) // 0은 INVALID_SESSION_ID
+        , mArena(arenaSize > 0 ? std::make_unique<HugePageArena>(arenaSize, useHugePages) : nullptr)
+        , mSessionPool(maxSessions, (mArena && mArena->IsValid()) ? mArena.get() : nullptr)
     {
+        if (mArena && !mArena->IsValid())
+        {
+            mArena.reset();
+        }
+
         mSessions.reserve(maxSessions);
     }
 
@@ -26,10 +33,14 @@ namespace KanchoNet
         }
 
         SessionID id = GenerateSessionID();
-        auto session = std::make_unique<Session>(id, socket, config);
-        Session* sessionPtr = session.get();
+        Session* sessionPtr = mSessionPool.Acquire(id, socket, config);
+        if (sessionPtr == nullptr)
+        {
+            LOG_WARNING("Session pool exhausted. Max: %u", mMaxSessions);
+            return nullptr;
+        }
         
-        mSessions[id] = std::move(session);
+        mSessions[id] = sessionPtr;
         
         LOG_DEBUG("Session added. ID: %llu, Socket: %llu, Total: %zu", 
                   id, socket, mSessions.size());
@@ -37,6 +48,36 @@ namespace KanchoNet
         return sessionPtr;
     }
 
+    size_t SessionManager::AddSessions(const SocketHandle* sockets, size_t count, const SessionConfig& config, Session** outSessions)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        size_t added = 0;
+        while (added < count)
+        {
+            if (mSessions.size() >= mMaxSessions)
+            {
+                LOG_WARNING("Session limit reached. Max: %u", mMaxSessions);
+                break;
+            }
+
+            SessionID id = GenerateSessionID();
+            Session* sessionPtr = mSessionPool.Acquire(id, sockets[added], config);
+            if (sessionPtr == nullptr)
+            {
+                LOG_WARNING("Session pool exhausted. Max: %u", mMaxSessions);
+                break;
+            }
+
+            mSessions[id] = sessionPtr;
+            outSessions[added++] = sessionPtr;
+        }
+
+        LOG_DEBUG("Sessions added. Count: %zu/%zu, Total: %zu", added, count, mSessions.size());
+
+        return added;
+    }
+
     bool SessionManager::RemoveSession(SessionID sessionID)
     {
         std::lock_guard<std::mutex> lock(mMutex);
@@ -47,7 +88,13 @@ namespace KanchoNet
             return false;
         }
 
+        Session* session = it->second;
         mSessions.erase(it);
+
+        if (session->ReleaseRef())
+        {
+            mSessionPool.Release(session);
+        }
         
         LOG_DEBUG("Session removed. ID: %llu, Remaining: %zu", 
                   sessionID, mSessions.size());
@@ -55,6 +102,15 @@ namespace KanchoNet
         return true;
     }
 
+    void SessionManager::ReleaseSession(Session* session)
+    {
+        if (session && session->ReleaseRef())
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mSessionPool.Release(session);
+        }
+    }
+
     Session* SessionManager::GetSession(SessionID sessionID)
     {
         std::lock_guard<std::mutex> lock(mMutex);
@@ -65,7 +121,7 @@ namespace KanchoNet
             return nullptr;
         }
 
-        return it->second.get();
+        return it->second;
     }
 
     const Session* SessionManager::GetSession(SessionID sessionID) const
@@ -78,7 +134,7 @@ namespace KanchoNet
             return nullptr;
         }
 
-        return it->second.get();
+        return it->second;
     }
 
     bool SessionManager::HasSession(SessionID sessionID) const
@@ -93,7 +149,7 @@ namespace KanchoNet
 
         for (auto& pair : mSessions)
         {
-            callback(pair.second.get());
+            callback(pair.second);
         }
     }
 
@@ -106,6 +162,10 @@ namespace KanchoNet
     void SessionManager::Clear()
     {
         std::lock_guard<std::mutex> lock(mMutex);
+        for (auto& pair : mSessions)
+        {
+            mSessionPool.Release(pair.second);
+        }
         mSessions.clear();
         LOG_INFO("All sessions cleared");
     }
@@ -2,6 +2,8 @@
 
 #include "../Types.h"
 #include "Session.h"
+#include "SessionPool.h"
+#include "../Buffer/HugePageArena.h"
 #include "../Utils/NonCopyable.h"
 #include <memory>
 #include <unordered_map>
@@ -23,21 +25,32 @@ namespace KanchoNet
         uint32_t mMaxSessions;
         std::atomic<SessionID> mNextSessionID;
         
-        std::unordered_map<SessionID, std::unique_ptr<Session>> mSessions;
+        std::unique_ptr<HugePageArena> mArena;  // 세션 슬랩/송수신 버퍼 아레나 (세션 풀보다 먼저 생성, 나중에 파괴)
+        SessionPool mSessionPool;  // 세션 객체 슬랩 (maxSessions 크기로 미리 확보)
+        std::unordered_map<SessionID, Session*> mSessions;
         mutable std::mutex mMutex;
         
     public:
         // 생성자, 파괴자
-        explicit SessionManager(uint32_t maxSessions);
+        // arenaSize가 0보다 크면 그 크기의 아레나를 예약해 세션 슬랩/송수신 버퍼를 할당
+        explicit SessionManager(uint32_t maxSessions, size_t arenaSize = 0, bool useHugePages = true);
         ~SessionManager();
         
     public:
         // public 함수
         // 세션 추가
         Session* AddSession(SocketHandle socket, const SessionConfig& config);
+
+        // 여러 세션을 한 번의 락으로 추가 (accept 배치용)
+        // 앞에서부터 채우며, 한도에 걸리면 나머지 소켓은 추가하지 않음
+        // 반환값: 추가된 세션 수 (outSessions[0 .. 반환값))
+        size_t AddSessions(const SocketHandle* sockets, size_t count, const SessionConfig& config, Session** outSessions);
         
-        // 세션 제거
+        // 세션 제거 (검색 대상에서 즉시 빠지며, 다른 참조가 남아있으면 마지막 ReleaseSession에서 슬롯 반환)
         bool RemoveSession(SessionID sessionID);
+
+        // Session::AddRef로 잡은 참조 반환
+        void ReleaseSession(Session* session);
         
         // 세션 검색
         Session* GetSession(SessionID sessionID);
@@ -53,6 +66,9 @@ namespace KanchoNet
         size_t GetSessionCount() const;
         size_t GetMaxSessions() const { return mMaxSessions; }
         bool IsFull() const { return GetSessionCount() >= mMaxSessions; }
+
+        // 세션 버퍼 아레나 (사용하지 않으면 nullptr)
+        HugePageArena* GetArena() const { return mArena.get(); }
         
         // 전체 세션 제거
         void Clear();
@@ -0,0 +1,98 @@
+#include "SessionPool.h"
+#include "../Buffer/HugePageArena.h"
+#include "../Utils/Logger.h"
+#include <new>
+
+namespace KanchoNet
+{
+    SessionPool::SessionPool(size_t capacity, HugePageArena* arena)
+        : mSlab(nullptr)
+        , mArena(arena)
+        , mCapacity(capacity)
+        , mConstructedCount(0)
+    {
+        if (mCapacity > 0)
+        {
+            // Session은 alignas(CACHE_LINE_SIZE)이므로 슬롯마다 캐시 라인 경계에서 시작 (아레나 블록도 캐시 라인 정렬)
+            static_assert(alignof(Session) <= HugePageArena::ALIGNMENT, "Arena alignment is too small for Session");
+            if (mArena)
+            {
+                mSlab = static_cast<Session*>(mArena->Allocate(mCapacity * sizeof(Session)));
+            }
+            if (mSlab == nullptr)
+            {
+                mSlab = static_cast<Session*>(::operator new(mCapacity * sizeof(Session),
+                                                             std::align_val_t(alignof(Session))));
+            }
+        }
+
+        mFreeList.reserve(mCapacity);
+    }
+
+    SessionPool::~SessionPool()
+    {
+        // 생성된 슬롯만 파괴
+        for (size_t i = 0; i < mConstructedCount; ++i)
+        {
+            mSlab[i].~Session();
+        }
+
+        if (mSlab != nullptr)
+        {
+            if (mArena && mArena->Owns(mSlab))
+            {
+                mArena->Deallocate(mSlab, mCapacity * sizeof(Session));
+            }
+            else
+            {
+                ::operator delete(mSlab, std::align_val_t(alignof(Session)));
+            }
+            mSlab = nullptr;
+        }
+    }
+
+    Session* SessionPool::Acquire(SessionID id, SocketHandle socket, const SessionConfig& config)
+    {
+        // 반환된 세션 재사용
+        if (!mFreeList.empty())
+        {
+            Session* session = mFreeList.back();
+            mFreeList.pop_back();
+            session->Reset(id, socket, config);
+            return session;
+        }
+
+        // 아직 사용하지 않은 슬롯에 생성 (첫 접속 시점에 지연 생성)
+        if (mConstructedCount < mCapacity)
+        {
+            Session* session = new (&mSlab[mConstructedCount]) Session(id, socket, config, mArena);
+            ++mConstructedCount;
+            return session;
+        }
+
+        return nullptr;
+    }
+
+    void SessionPool::Release(Session* session)
+    {
+        if (session == nullptr)
+            return;
+
+        if (!Owns(session))
+        {
+            LOG_ERROR("Session does not belong to this pool. ID: %llu", session->GetID());
+            return;
+        }
+
+        // 소켓/사용자 데이터 참조 제거 (버퍼 메모리는 유지)
+        session->Reset(INVALID_SESSION_ID, INVALID_SOCKET_HANDLE, session->GetConfig());
+        mFreeList.push_back(session);
+    }
+
+    bool SessionPool::Owns(const Session* session) const
+    {
+        return session >= mSlab && session < mSlab + mConstructedCount;
+    }
+
+} // namespace KanchoNet
+
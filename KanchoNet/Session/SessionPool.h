@@ -0,0 +1,51 @@
+#pragma once
+
+#include "../Types.h"
+#include "../Utils/NonCopyable.h"
+#include "Session.h"
+#include <vector>
+
+namespace KanchoNet
+{
+    // 세션 객체 슬랩 할당자
+    // 최대 세션 수만큼의 연속 메모리를 캐시 라인 정렬로 미리 확보하고 슬롯 단위로 세션을 배치
+    // 한 번 생성된 세션은 파괴하지 않고 프리 리스트에 보관했다가 Reset으로 재사용 (버퍼 재할당 없음)
+    // 아레나를 지정하면 슬랩과 세션 송수신 버퍼를 아레나에서 할당 (부족하면 일반 힙)
+    // 스레드 안전하지 않음 (SessionManager의 뮤텍스로 보호)
+    class SessionPool : public NonCopyable
+    {
+    public:
+        // public 멤버변수 (없음)
+
+    private:
+        // private 멤버변수
+        Session* mSlab;                     // 슬롯 배열 (capacity * sizeof(Session))
+        HugePageArena* mArena;              // 슬랩/세션 버퍼를 할당할 아레나 (nullptr = 일반 힙)
+        size_t mCapacity;                   // 전체 슬롯 수
+        size_t mConstructedCount;           // 한 번이라도 생성된 슬롯 수 (앞에서부터 순서대로 사용)
+        std::vector<Session*> mFreeList;    // 반환된 세션 (LIFO, 최근 사용한 캐시 라인 우선 재사용)
+
+    public:
+        // 생성자, 파괴자
+        explicit SessionPool(size_t capacity, HugePageArena* arena = nullptr);
+        ~SessionPool();
+
+    public:
+        // public 함수
+        // 세션 할당 (슬롯이 모두 사용 중이면 nullptr)
+        Session* Acquire(SessionID id, SocketHandle socket, const SessionConfig& config);
+
+        // 세션 반환
+        void Release(Session* session);
+
+        // 풀 상태
+        size_t GetCapacity() const { return mCapacity; }
+        size_t GetInUseCount() const { return mConstructedCount - mFreeList.size(); }
+        size_t GetFreeCount() const { return mCapacity - GetInUseCount(); }
+
+        // 슬랩 소속 여부
+        bool Owns(const Session* session) const;
+    };
+
+} // namespace KanchoNet
+
@@ -0,0 +1,136 @@
+#include "Strand.h"
+#include "../Utils/SpinLock.h"
+
+namespace KanchoNet
+{
+    Strand::Strand()
+        : mHead(&mStub)
+        , mScheduled(false)
+        , mTail(&mStub)
+    {
+    }
+
+    Strand::~Strand()
+    {
+        Clear();
+    }
+
+    bool Strand::Push(Task* task)
+    {
+        Enqueue(task);
+
+        // 실행자는 mScheduled를 내린 뒤 mHead를 확인하고, 생산자는 mHead를 바꾼 뒤 mScheduled를 확인하므로
+        // 유휴 전환과 겹쳐도 둘 중 하나는 반드시 이 작업을 실행함
+        return !mScheduled.exchange(true, std::memory_order_seq_cst);
+    }
+
+    bool Strand::TryAcquire()
+    {
+        if (mScheduled.load(std::memory_order_relaxed) || !IsEmpty())
+        {
+            return false;
+        }
+
+        return !mScheduled.exchange(true, std::memory_order_acq_rel);
+    }
+
+    bool Strand::Run(size_t maxTasks)
+    {
+        size_t executed = 0;
+        while (executed < maxTasks)
+        {
+            Task* task = Dequeue();
+            if (!task)
+            {
+                if (!IsDrained())
+                {
+                    // 생산자가 노드를 연결하는 중 (exchange와 store 사이), 곧 보이므로 잠시 대기
+                    CpuRelax();
+                    continue;
+                }
+
+                // 유휴 전환 후 그 사이 들어온 작업이 있으면 실행자 자격을 다시 시도
+                // (유휴 전환 뒤에는 다른 실행자가 mTail을 바꿀 수 있으므로 mHead만 확인)
+                mScheduled.store(false, std::memory_order_seq_cst);
+                if (mHead.load(std::memory_order_seq_cst) == &mStub ||
+                    mScheduled.exchange(true, std::memory_order_acq_rel))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            task->mFunction();
+            delete task;
+            ++executed;
+        }
+
+        return true;
+    }
+
+    void Strand::Clear()
+    {
+        while (Task* task = Dequeue())
+        {
+            delete task;
+        }
+
+        mScheduled.store(false, std::memory_order_release);
+    }
+
+    bool Strand::IsDrained() const
+    {
+        // 빈 노드만 남아있어야 비어있음 (mHead만 보면 마지막 노드를 꺼내는 도중의 상태와 구분되지 않음)
+        return mTail == &mStub && mHead.load(std::memory_order_seq_cst) == &mStub;
+    }
+
+    void Strand::Enqueue(Task* task)
+    {
+        task->mNext.store(nullptr, std::memory_order_relaxed);
+        Task* prev = mHead.exchange(task, std::memory_order_seq_cst);
+        prev->mNext.store(task, std::memory_order_release);
+    }
+
+    Task* Strand::Dequeue()
+    {
+        Task* tail = mTail;
+        Task* next = tail->mNext.load(std::memory_order_acquire);
+
+        // 빈 노드는 건너뜀
+        if (tail == &mStub)
+        {
+            if (!next)
+            {
+                return nullptr;
+            }
+
+            mTail = next;
+            tail = next;
+            next = next->mNext.load(std::memory_order_acquire);
+        }
+
+        if (next)
+        {
+            mTail = next;
+            return tail;
+        }
+
+        // tail이 마지막 노드: 생산자가 뒤에 붙이는 중이면 기다림
+        if (tail != mHead.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        // 마지막 노드를 꺼내려면 뒤에 빈 노드를 붙여 자리를 넘겨야 함
+        Enqueue(&mStub);
+        next = tail->mNext.load(std::memory_order_acquire);
+        if (next)
+        {
+            mTail = next;
+            return tail;
+        }
+
+        return nullptr;
+    }
+
+} // namespace KanchoNet
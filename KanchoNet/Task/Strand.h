@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../Types.h"
+#include "../Utils/NonCopyable.h"
+#include "Task.h"
+#include <atomic>
+
+namespace KanchoNet
+{
+    // 직렬 실행 큐 (스트랜드)
+    // 같은 스트랜드에 넣은 작업은 넣은 순서대로, 한 번에 한 스레드에서만 실행됨
+    // 스트랜드 자체는 스레드를 갖지 않으며, Push가 true를 반환하면 호출자가 실행을 맡고(스케줄러에 제출하거나 직접 실행)
+    // 실행자는 Run이 false를 반환할 때까지(큐가 빌 때까지) 반복 호출
+    //
+    // 큐는 Vyukov 침습형 MPSC 큐 (생산자는 exchange 한 번, 소비자는 실행자 한 명)
+    // 실행자 자격은 mScheduled 플래그로 정해지므로 어떤 스레드도 락을 잡고 기다리지 않음
+    class Strand : public NonCopyable
+    {
+    public:
+        // public 멤버변수 (없음)
+
+    private:
+        // private 멤버변수
+        alignas(CACHE_LINE_SIZE) std::atomic<Task*> mHead;  // 생산자가 교체하는 마지막 노드
+        std::atomic<bool> mScheduled;                       // 실행이 예약되었거나 실행 중
+        alignas(CACHE_LINE_SIZE) Task* mTail;               // 다음에 꺼낼 노드 (실행자 전용)
+        Task mStub;                                         // 큐가 비었을 때 자리를 지키는 빈 노드
+
+    public:
+        // 생성자, 파괴자
+        Strand();
+        ~Strand();
+
+    public:
+        // public 함수
+        // 작업 추가 (소유권 이전, 어느 스레드에서나 호출 가능)
+        // 반환값: 유휴 상태였던 스트랜드가 이번 호출로 예약 상태가 되었는지 (true면 호출자가 실행을 맡음)
+        bool Push(Task* task);
+
+        // 큐를 거치지 않고 실행자 자격 획득 (유휴 상태이고 대기 중인 작업이 없을 때만 성공)
+        // 성공하면 호출자가 작업을 직접 실행한 뒤 Run으로 그 사이 쌓인 작업을 마저 처리해야 함
+        bool TryAcquire();
+
+        // 실행자: 최대 maxTasks개 실행
+        // 반환값: 아직 예약 상태인지 (true면 다시 실행해야 함, false면 유휴 상태로 전환됨)
+        bool Run(size_t maxTasks);
+
+        // 실행하지 않은 작업 폐기 (세션 재사용 시, 실행자가 없을 때만 호출)
+        void Clear();
+
+        bool IsScheduled() const { return mScheduled.load(std::memory_order_acquire); }
+        // 대기 중인 작업이 없는지 (다른 스레드에서 읽으면 근사값)
+        bool IsEmpty() const { return mHead.load(std::memory_order_acquire) == &mStub; }
+
+    private:
+        // private 함수
+        void Enqueue(Task* task);
+
+        // 실행자: 꺼낼 작업이 하나도 없는지
+        bool IsDrained() const;
+
+        // 실행자: 가장 오래된 작업 꺼내기
+        // 생산자가 노드를 연결하는 중이면 비어있지 않아도 nullptr를 반환할 수 있음
+        Task* Dequeue();
+    };
+
+} // namespace KanchoNet
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "../Types.h"
+#include <atomic>
+#include <functional>
+
+namespace KanchoNet
+{
+    using TaskFunction = std::function<void()>;
+
+    // 스케줄러/스트랜드가 주고받는 작업 단위
+    // mNext는 스트랜드(락프리 MPSC)와 주입 큐의 침습형 연결 리스트용 (별도 노드 할당 없음)
+    struct Task
+    {
+        TaskFunction mFunction;
+        std::atomic<Task*> mNext{ nullptr };
+
+        Task() = default;
+
+        explicit Task(TaskFunction function)
+            : mFunction(std::move(function))
+        {
+        }
+    };
+
+} // namespace KanchoNet
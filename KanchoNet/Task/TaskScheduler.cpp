@@ -0,0 +1,379 @@
+#include "TaskScheduler.h"
+#include "../Utils/CpuAffinity.h"
+#include "../Utils/Logger.h"
+
+namespace KanchoNet
+{
+    // 현재 스레드가 속한 스케줄러와 워커 (워커 스레드가 아니면 nullptr)
+    static thread_local const TaskScheduler* tCurrentScheduler = nullptr;
+    static thread_local void* tCurrentWorker = nullptr;
+
+    TaskScheduler::TaskScheduler()
+        : mInjectHead(nullptr)
+        , mInjectTail(nullptr)
+        , mQueuedCount(0)
+        , mSleepingCount(0)
+        , mRunning(false)
+        , mStopping(false)
+        , mPinEachWorker(false)
+        , mWorkerNumaNode(-1)
+    {
+    }
+
+    TaskScheduler::~TaskScheduler()
+    {
+        Stop();
+    }
+
+    void TaskScheduler::SetPlacement(const std::vector<uint32_t>& cpus, bool pinEachWorker, int32_t numaNode)
+    {
+        if (mRunning)
+        {
+            return;
+        }
+
+        mWorkerCpus = cpus;
+        mPinEachWorker = pinEachWorker;
+        mWorkerNumaNode = numaNode;
+    }
+
+    bool TaskScheduler::Start(uint32_t workerCount)
+    {
+        if (mRunning || workerCount == 0 || workerCount > MAX_WORKERS)
+        {
+            return false;
+        }
+
+        mStopping.store(false);
+        mWorkers.clear();
+        for (uint32_t i = 0; i < workerCount; ++i)
+        {
+            mWorkers.push_back(std::make_unique<Worker>());
+            mWorkers.back()->mRandomState = 0x9E3779B9u * (i + 1);
+        }
+
+        mRunning.store(true, std::memory_order_release);
+        for (uint32_t i = 0; i < workerCount; ++i)
+        {
+            mWorkers[i]->mThread = std::thread(&TaskScheduler::WorkerLoop, this, i);
+        }
+
+        LOG_INFO("TaskScheduler started. Workers: %u", workerCount);
+        return true;
+    }
+
+    void TaskScheduler::Stop()
+    {
+        if (!mRunning.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mSleepMutex);
+            mStopping.store(true);
+        }
+        mSleepCondition.notify_all();
+
+        for (auto& worker : mWorkers)
+        {
+            if (worker->mThread.joinable())
+            {
+                worker->mThread.join();
+            }
+        }
+
+        // 워커가 끝난 뒤 주입 큐에 남은 작업은 이 스레드에서 실행 (제출에 성공한 작업은 반드시 한 번 실행됨)
+        // 여기서 실행하는 작업이 다시 제출하면 종료 중이라 실패하므로 호출자가 직접 실행함
+        DrainInjected();
+
+        mRunning.store(false, std::memory_order_release);
+        LOG_INFO("TaskScheduler stopped. Executed: %llu, Stolen: %llu",
+                 static_cast<unsigned long long>(GetExecutedCount()),
+                 static_cast<unsigned long long>(GetStolenCount()));
+    }
+
+    bool TaskScheduler::Submit(TaskFunction function)
+    {
+        Task* task = new Task(std::move(function));
+        if (!Submit(task))
+        {
+            delete task;
+            return false;
+        }
+        return true;
+    }
+
+    bool TaskScheduler::Submit(Task* task)
+    {
+        if (!task || !mRunning.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        task->mNext.store(nullptr, std::memory_order_relaxed);
+
+        if (tCurrentScheduler == this)
+        {
+            // 워커 스레드: 종료 중에도 자기 덱에 넣음 (종료 전에 스스로 실행)
+            Worker* self = static_cast<Worker*>(tCurrentWorker);
+            mQueuedCount.fetch_add(1, std::memory_order_seq_cst);
+            self->mDeque.Push(task);
+        }
+        else
+        {
+            // 큐에 넣기 전에 개수부터 올리고 종료 여부를 확인
+            // Stop이 mStopping을 세우기 전에 확인을 통과했다면 워커는 이 작업이 빠질 때까지 끝나지 않고,
+            // 세운 뒤라면 여기서 되돌리고 실패를 반환 (둘 다 seq_cst)
+            mQueuedCount.fetch_add(1, std::memory_order_seq_cst);
+            if (mStopping.load(std::memory_order_seq_cst))
+            {
+                mQueuedCount.fetch_sub(1, std::memory_order_seq_cst);
+                return false;
+            }
+
+            {
+                SpinLockGuard lock(mInjectLock);
+                if (mInjectTail)
+                {
+                    mInjectTail->mNext.store(task, std::memory_order_relaxed);
+                }
+                else
+                {
+                    mInjectHead = task;
+                }
+                mInjectTail = task;
+            }
+        }
+
+        WakeWorker();
+        return true;
+    }
+
+    bool TaskScheduler::IsWorkerThread() const
+    {
+        return tCurrentScheduler == this;
+    }
+
+    uint64_t TaskScheduler::GetExecutedCount() const
+    {
+        uint64_t total = 0;
+        for (const auto& worker : mWorkers)
+        {
+            total += worker->mExecuted.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    uint64_t TaskScheduler::GetStolenCount() const
+    {
+        uint64_t total = 0;
+        for (const auto& worker : mWorkers)
+        {
+            total += worker->mStolen.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void TaskScheduler::WorkerLoop(uint32_t index)
+    {
+        Worker& self = *mWorkers[index];
+        tCurrentScheduler = this;
+        tCurrentWorker = &self;
+
+        // 작업을 실행하기 전에 배치해야 워커가 처음 만지는 메모리가 해당 노드에 할당됨
+        if (!mWorkerCpus.empty())
+        {
+            const bool pinned = mPinEachWorker
+                ? CpuAffinity::PinCurrentThread({ mWorkerCpus[index % mWorkerCpus.size()] })
+                : CpuAffinity::PinCurrentThread(mWorkerCpus);
+            if (!pinned)
+            {
+                LOG_WARNING("Failed to pin task worker %u", index);
+            }
+        }
+
+        if (mWorkerNumaNode >= 0 && !CpuAffinity::SetPreferredNode(mWorkerNumaNode))
+        {
+            LOG_WARNING("Failed to set NUMA node %d for task worker %u", mWorkerNumaNode, index);
+        }
+
+        uint32_t idleCount = 0;
+        while (true)
+        {
+            Task* task = FindTask(self, index);
+            if (task)
+            {
+                mQueuedCount.fetch_sub(1, std::memory_order_seq_cst);
+                task->mFunction();
+                delete task;
+
+                self.mExecuted.fetch_add(1, std::memory_order_relaxed);
+                idleCount = 0;
+                continue;
+            }
+
+            if (mStopping.load(std::memory_order_seq_cst) && mQueuedCount.load(std::memory_order_seq_cst) <= 0)
+            {
+                break;
+            }
+
+            // 바로 잠들면 직후에 들어오는 작업마다 깨우기 비용이 생기므로 잠시 회전
+            if (++idleCount < IDLE_SPIN_COUNT)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // 제출자는 mQueuedCount 증가 후 mSleepingCount를 확인하고,
+            // 워커는 mSleepingCount 증가 후 mQueuedCount를 확인하므로 둘 중 하나는 반드시 상대를 봄
+            std::unique_lock<std::mutex> lock(mSleepMutex);
+            mSleepingCount.fetch_add(1, std::memory_order_seq_cst);
+            mSleepCondition.wait(lock, [this]() {
+                return mQueuedCount.load(std::memory_order_seq_cst) > 0 || mStopping.load(std::memory_order_acquire);
+            });
+            mSleepingCount.fetch_sub(1, std::memory_order_relaxed);
+            idleCount = 0;
+        }
+
+        tCurrentScheduler = nullptr;
+        tCurrentWorker = nullptr;
+    }
+
+    Task* TaskScheduler::FindTask(Worker& self, uint32_t index)
+    {
+        Task* task = nullptr;
+        if (self.mDeque.Pop(task))
+        {
+            return task;
+        }
+
+        task = PopInjected(self);
+        if (task)
+        {
+            return task;
+        }
+
+        return StealFromOthers(self, index);
+    }
+
+    Task* TaskScheduler::PopInjected(Worker& self)
+    {
+        Task* batch;
+        {
+            SpinLockGuard lock(mInjectLock);
+            if (!mInjectHead)
+            {
+                return nullptr;
+            }
+
+            // 최대 INJECT_BATCH개를 한 번에 떼어 와 락 획득 횟수를 줄임
+            batch = mInjectHead;
+            Task* last = batch;
+            for (size_t i = 1; i < INJECT_BATCH && last->mNext.load(std::memory_order_relaxed); ++i)
+            {
+                last = last->mNext.load(std::memory_order_relaxed);
+            }
+
+            mInjectHead = last->mNext.load(std::memory_order_relaxed);
+            if (!mInjectHead)
+            {
+                mInjectTail = nullptr;
+            }
+            last->mNext.store(nullptr, std::memory_order_relaxed);
+        }
+
+        // 첫 작업은 바로 실행, 나머지는 자기 덱에 넣어 다른 워커가 훔칠 수 있게 함
+        // 덱은 LIFO이므로 역순으로 넣어 주입 순서에 가깝게 실행
+        Task* rest[INJECT_BATCH];
+        size_t restCount = 0;
+        for (Task* task = batch->mNext.load(std::memory_order_relaxed); task; task = task->mNext.load(std::memory_order_relaxed))
+        {
+            rest[restCount++] = task;
+        }
+        while (restCount > 0)
+        {
+            self.mDeque.Push(rest[--restCount]);
+        }
+
+        batch->mNext.store(nullptr, std::memory_order_relaxed);
+        return batch;
+    }
+
+    void TaskScheduler::DrainInjected()
+    {
+        while (true)
+        {
+            Task* task;
+            {
+                SpinLockGuard lock(mInjectLock);
+                task = mInjectHead;
+                if (!task)
+                {
+                    mInjectTail = nullptr;
+                    break;
+                }
+
+                mInjectHead = task->mNext.load(std::memory_order_relaxed);
+            }
+
+            mQueuedCount.fetch_sub(1, std::memory_order_seq_cst);
+            task->mNext.store(nullptr, std::memory_order_relaxed);
+            task->mFunction();
+            delete task;
+        }
+
+        // 다음 Start를 위해 초기화 (종료 중 제출은 모두 되돌려졌으므로 0이어야 함)
+        mQueuedCount.store(0, std::memory_order_seq_cst);
+    }
+
+    Task* TaskScheduler::StealFromOthers(Worker& self, uint32_t index)
+    {
+        const uint32_t workerCount = static_cast<uint32_t>(mWorkers.size());
+        if (workerCount <= 1)
+        {
+            return nullptr;
+        }
+
+        // xorshift로 시작 위치를 골라 특정 워커에 훔치기가 몰리지 않게 함
+        uint32_t state = self.mRandomState;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        self.mRandomState = state;
+
+        const uint32_t start = state % workerCount;
+        for (uint32_t i = 0; i < workerCount; ++i)
+        {
+            const uint32_t victim = (start + i) % workerCount;
+            if (victim == index)
+            {
+                continue;
+            }
+
+            Task* task = nullptr;
+            if (mWorkers[victim]->mDeque.Steal(task))
+            {
+                self.mStolen.fetch_add(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void TaskScheduler::WakeWorker()
+    {
+        if (mSleepingCount.load(std::memory_order_seq_cst) == 0)
+        {
+            return;
+        }
+
+        // 대기 조건 확인과 잠들기 사이에 알림이 끼지 않도록 뮤텍스를 거친 뒤 알림
+        {
+            std::lock_guard<std::mutex> lock(mSleepMutex);
+        }
+        mSleepCondition.notify_one();
+    }
+
+} // namespace KanchoNet
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "../Types.h"
+#include "../Utils/NonCopyable.h"
+#include "../Utils/SpinLock.h"
+#include "Task.h"
+#include "WorkStealingDeque.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace KanchoNet
+{
+    // 작업 훔치기 태스크 스케줄러
+    // 워커마다 Chase-Lev 덱을 두고, 워커 스레드에서 제출한 작업은 자기 덱에 (LIFO),
+    // 외부 스레드(I/O 스레드 등)에서 제출한 작업은 공용 주입 큐에 넣음
+    // 워커는 자기 덱 -> 주입 큐 -> 다른 워커의 덱(훔치기) 순으로 작업을 찾고, 없으면 잠시 회전 후 대기
+    class TaskScheduler : public NonCopyable
+    {
+    public:
+        // public 멤버변수
+        static constexpr uint32_t MAX_WORKERS = 256;
+        static constexpr size_t INJECT_BATCH = 16;      // 주입 큐에서 한 번에 가져오는 최대 작업 수
+        static constexpr uint32_t IDLE_SPIN_COUNT = 64; // 대기 전 작업을 다시 찾는 횟수
+
+    private:
+        // private 멤버변수
+        struct alignas(CACHE_LINE_SIZE) Worker
+        {
+            WorkStealingDeque<Task*> mDeque;
+            std::thread mThread;
+            uint32_t mRandomState = 0;                  // 훔칠 대상 선택용 xorshift 상태
+            std::atomic<uint64_t> mExecuted{ 0 };
+            std::atomic<uint64_t> mStolen{ 0 };
+        };
+
+        std::vector<std::unique_ptr<Worker>> mWorkers;
+
+        // 외부 스레드 제출용 주입 큐 (침습형 FIFO)
+        alignas(CACHE_LINE_SIZE) SpinLock mInjectLock;
+        Task* mInjectHead;
+        Task* mInjectTail;
+
+        // 아직 실행을 시작하지 않은 작업 수 (대기 판단용)
+        alignas(CACHE_LINE_SIZE) std::atomic<int64_t> mQueuedCount;
+        std::atomic<uint32_t> mSleepingCount;
+        std::mutex mSleepMutex;
+        std::condition_variable mSleepCondition;
+
+        std::atomic<bool> mRunning;
+        std::atomic<bool> mStopping;
+
+        // 워커 배치 (Start 전에 SetPlacement로 지정)
+        std::vector<uint32_t> mWorkerCpus;  // 워커를 고정할 CPU (비우면 고정 안 함)
+        bool mPinEachWorker;                // true면 i번째 워커를 mWorkerCpus[i % 크기] 하나에, false면 목록 전체에 고정
+        int32_t mWorkerNumaNode;            // 워커가 할당하는 메모리를 둘 NUMA 노드 (-1 = 지정 안 함)
+
+    public:
+        // 생성자, 파괴자
+        TaskScheduler();
+        ~TaskScheduler();
+
+    public:
+        // public 함수
+        // 워커 CPU 고정/NUMA 노드 지정 (Start 전에 호출)
+        void SetPlacement(const std::vector<uint32_t>& cpus, bool pinEachWorker, int32_t numaNode);
+
+        // 워커 스레드 시작
+        bool Start(uint32_t workerCount);
+
+        // 남은 작업을 모두 실행한 뒤 워커 종료 (종료가 시작되면 외부 제출은 실패)
+        void Stop();
+
+        // 작업 제출 (어느 스레드에서나 호출 가능)
+        // 반환값: 제출 여부 (실행 중이 아니면 false, 작업은 호출자가 처리)
+        bool Submit(TaskFunction function);
+        bool Submit(Task* task);
+
+        // 현재 스레드가 이 스케줄러의 워커인지
+        bool IsWorkerThread() const;
+
+        // 상태
+        bool IsRunning() const { return mRunning.load(std::memory_order_acquire); }
+        uint32_t GetWorkerCount() const { return static_cast<uint32_t>(mWorkers.size()); }
+        uint64_t GetExecutedCount() const;
+        uint64_t GetStolenCount() const;
+
+    private:
+        // private 함수
+        void WorkerLoop(uint32_t index);
+
+        // 실행할 작업 찾기 (자기 덱 -> 주입 큐 -> 훔치기)
+        Task* FindTask(Worker& self, uint32_t index);
+        Task* PopInjected(Worker& self);
+        Task* StealFromOthers(Worker& self, uint32_t index);
+
+        // 주입 큐에 남은 작업을 호출 스레드에서 모두 실행 (워커 종료 후 Stop에서 호출)
+        void DrainInjected();
+
+        void WakeWorker();
+    };
+
+} // namespace KanchoNet
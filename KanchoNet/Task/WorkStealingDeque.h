@@ -0,0 +1,162 @@
+#pragma once
+
+#include "../Types.h"
+#include "../Utils/NonCopyable.h"
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace KanchoNet
+{
+    // Chase-Lev 작업 훔치기 덱 (Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models")
+    // 소유 스레드만 아래쪽(bottom)에서 Push/Pop (LIFO, 캐시에 남아있는 최근 작업 우선)
+    // 다른 스레드는 위쪽(top)에서 Steal (FIFO, 오래된 작업부터 가져감)
+    // 가득 차면 두 배로 늘리며, 도둑이 아직 읽고 있을 수 있는 이전 배열은 소멸 시까지 보관
+    template<typename T>
+    class WorkStealingDeque : public NonCopyable
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque element must be trivially copyable");
+
+    public:
+        // public 멤버변수 (없음)
+
+    private:
+        // private 멤버변수
+        struct Array
+        {
+            int64_t mCapacity;  // 2의 거듭제곱
+            int64_t mMask;
+            std::unique_ptr<std::atomic<T>[]> mSlots;
+
+            explicit Array(int64_t capacity)
+                : mCapacity(capacity)
+                , mMask(capacity - 1)
+                , mSlots(new std::atomic<T>[static_cast<size_t>(capacity)])
+            {
+            }
+
+            T Get(int64_t index) const { return mSlots[index & mMask].load(std::memory_order_relaxed); }
+            void Put(int64_t index, T value) { mSlots[index & mMask].store(value, std::memory_order_relaxed); }
+        };
+
+        alignas(CACHE_LINE_SIZE) std::atomic<int64_t> mTop;     // 도둑들이 경쟁하는 위치
+        alignas(CACHE_LINE_SIZE) std::atomic<int64_t> mBottom;  // 소유 스레드 전용 위치
+        std::atomic<Array*> mArray;
+        std::vector<std::unique_ptr<Array>> mArrays;            // 현재 + 이전 배열 (소유 스레드만 수정)
+
+    public:
+        // 생성자, 파괴자
+        explicit WorkStealingDeque(int64_t initialCapacity = 256)
+            : mTop(0)
+            , mBottom(0)
+        {
+            int64_t capacity = 1;
+            while (capacity < initialCapacity)
+            {
+                capacity <<= 1;
+            }
+
+            mArrays.push_back(std::make_unique<Array>(capacity));
+            mArray.store(mArrays.back().get(), std::memory_order_relaxed);
+        }
+
+    public:
+        // public 함수
+        // 소유 스레드: 작업 추가
+        void Push(T value)
+        {
+            const int64_t bottom = mBottom.load(std::memory_order_relaxed);
+            const int64_t top = mTop.load(std::memory_order_acquire);
+            Array* array = mArray.load(std::memory_order_relaxed);
+
+            if (bottom - top > array->mCapacity - 1)
+            {
+                array = Grow(array, top, bottom);
+            }
+
+            array->Put(bottom, value);
+            std::atomic_thread_fence(std::memory_order_release);
+            mBottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        // 소유 스레드: 가장 최근 작업 꺼내기 (비어있으면 false)
+        bool Pop(T& out)
+        {
+            const int64_t bottom = mBottom.load(std::memory_order_relaxed) - 1;
+            Array* array = mArray.load(std::memory_order_relaxed);
+            mBottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = mTop.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                // 비어있음
+                mBottom.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            out = array->Get(bottom);
+            if (top == bottom)
+            {
+                // 마지막 하나는 도둑과 경쟁
+                const bool won = mTop.compare_exchange_strong(top, top + 1,
+                                                              std::memory_order_seq_cst, std::memory_order_relaxed);
+                mBottom.store(bottom + 1, std::memory_order_relaxed);
+                return won;
+            }
+
+            return true;
+        }
+
+        // 다른 스레드: 가장 오래된 작업 훔치기 (비어있거나 경쟁에서 지면 false)
+        bool Steal(T& out)
+        {
+            int64_t top = mTop.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = mBottom.load(std::memory_order_acquire);
+
+            if (top >= bottom)
+            {
+                return false;
+            }
+
+            Array* array = mArray.load(std::memory_order_acquire);
+            T value = array->Get(top);
+            if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            out = value;
+            return true;
+        }
+
+        // 대략적인 크기 (다른 스레드에서 읽으면 근사값)
+        int64_t GetSize() const
+        {
+            const int64_t bottom = mBottom.load(std::memory_order_relaxed);
+            const int64_t top = mTop.load(std::memory_order_relaxed);
+            return bottom > top ? bottom - top : 0;
+        }
+
+        bool IsEmpty() const { return GetSize() == 0; }
+
+    private:
+        // private 함수
+        Array* Grow(Array* array, int64_t top, int64_t bottom)
+        {
+            mArrays.push_back(std::make_unique<Array>(array->mCapacity * 2));
+            Array* grown = mArrays.back().get();
+
+            for (int64_t i = top; i < bottom; ++i)
+            {
+                grown->Put(i, array->Get(i));
+            }
+
+            mArray.store(grown, std::memory_order_release);
+            return grown;
+        }
+    };
+
+} // namespace KanchoNet
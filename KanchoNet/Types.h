@@ -47,6 +47,9 @@ namespace KanchoNet
     constexpr size_t DEFAULT_SEND_BUFFER_SIZE = 65536;     // 64KB
     constexpr size_t DEFAULT_RECV_BUFFER_SIZE = 65536;     // 64KB
 
+    // 캐시 라인 크기 (False Sharing 방지용 정렬 단위)
+    constexpr size_t CACHE_LINE_SIZE = 64;
+
     // 기본 설정값
     constexpr uint16_t DEFAULT_PORT = 9000;
     constexpr uint32_t DEFAULT_MAX_SESSIONS = 10000;
@@ -127,7 +130,8 @@ namespace KanchoNet
         Accept = 0,
         Receive = 1,
         Send = 2,
-        Disconnect = 3
+        Disconnect = 3,
+        Poll = 4            // 준비 상태 통지 (io_uring 메트릭 엔드포인트 소켓)
     };
 
     // 세션 상태
@@ -139,6 +143,22 @@ namespace KanchoNet
         Disconnected = 3    // 연결 해제됨
     };
 
+    // 세션 수신 속도 제한을 넘었을 때의 처리
+    enum class RateLimitAction : uint8_t
+    {
+        Pause = 0,          // 버킷이 다시 찰 때까지 읽기 중지 (데이터는 커널 버퍼에 남고 TCP 흐름 제어로 송신자가 느려짐)
+        Drop = 1,           // 한도를 넘은 수신 데이터를 콜백에 넘기지 않고 버림
+        Disconnect = 2      // 연결 종료
+    };
+
+    // 세션 우선순위 (과부하 중에는 EngineConfig::mOverloadShedBelow보다 낮은 세션부터 수신을 제한)
+    enum class SessionPriority : uint8_t
+    {
+        Low = 0,            // 먼저 제한 (관전자, 인증 전 연결 등)
+        Normal = 1,         // 기본값
+        High = 2            // 제한하지 않음 (운영 도구 등)
+    };
+
     // Forward declarations
     class Session;
     class PacketBuffer;
@@ -0,0 +1,155 @@
+#include "CpuAffinity.h"
+#include <cstdio>
+#include <cstdlib>
+
+#ifdef KANCHONET_PLATFORM_WINDOWS
+    #include <Windows.h>
+#elif defined(KANCHONET_PLATFORM_LINUX)
+    #include <sched.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <linux/mempolicy.h>
+#endif
+
+namespace KanchoNet
+{
+    bool CpuAffinity::PinCurrentThread(const std::vector<uint32_t>& cpus)
+    {
+        if (cpus.empty())
+        {
+            return false;
+        }
+
+        #ifdef KANCHONET_PLATFORM_WINDOWS
+            DWORD_PTR mask = 0;
+            for (uint32_t cpu : cpus)
+            {
+                if (cpu < sizeof(DWORD_PTR) * 8)
+                {
+                    mask |= static_cast<DWORD_PTR>(1) << cpu;
+                }
+            }
+            return mask != 0 && SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+        #elif defined(KANCHONET_PLATFORM_LINUX)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (uint32_t cpu : cpus)
+            {
+                if (cpu < CPU_SETSIZE)
+                {
+                    CPU_SET(cpu, &set);
+                }
+            }
+            return CPU_COUNT(&set) > 0 && sched_setaffinity(0, sizeof(set), &set) == 0;
+        #endif
+    }
+
+    bool CpuAffinity::SetPreferredNode(int32_t node)
+    {
+        #ifdef KANCHONET_PLATFORM_WINDOWS
+            return node < 0;
+        #elif defined(KANCHONET_PLATFORM_LINUX)
+            if (node < 0)
+            {
+                return syscall(SYS_set_mempolicy, MPOL_DEFAULT, nullptr, 0) == 0;
+            }
+
+            if (static_cast<uint32_t>(node) >= MAX_NUMA_NODES)
+            {
+                return false;
+            }
+
+            constexpr size_t BITS_PER_WORD = sizeof(unsigned long) * 8;
+            unsigned long mask[MAX_NUMA_NODES / BITS_PER_WORD] = {};
+            mask[node / BITS_PER_WORD] = 1UL << (node % BITS_PER_WORD);
+
+            // maxnode는 마스크 비트 수 + 1 (커널이 maxnode - 1 비트만 읽음)
+            return syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask, MAX_NUMA_NODES + 1) == 0;
+        #endif
+    }
+
+    bool CpuAffinity::GetNodeCpus(int32_t node, std::vector<uint32_t>& cpus)
+    {
+        cpus.clear();
+
+        #ifdef KANCHONET_PLATFORM_WINDOWS
+            (void)node;
+            return false;
+        #elif defined(KANCHONET_PLATFORM_LINUX)
+            if (node < 0)
+            {
+                return false;
+            }
+
+            char path[128];
+            snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+
+            FILE* file = fopen(path, "r");
+            if (!file)
+            {
+                return false;
+            }
+
+            char text[4096];
+            const bool read = fgets(text, sizeof(text), file) != nullptr;
+            fclose(file);
+
+            return read && ParseCpuList(text, cpus) && !cpus.empty();
+        #endif
+    }
+
+    int32_t CpuAffinity::GetCurrentCpu()
+    {
+        #ifdef KANCHONET_PLATFORM_WINDOWS
+            return static_cast<int32_t>(GetCurrentProcessorNumber());
+        #elif defined(KANCHONET_PLATFORM_LINUX)
+            return sched_getcpu();
+        #endif
+    }
+
+    bool CpuAffinity::ParseCpuList(const std::string& text, std::vector<uint32_t>& cpus)
+    {
+        cpus.clear();
+
+        const char* cursor = text.c_str();
+        while (*cursor != '\0' && *cursor != '\n')
+        {
+            char* end = nullptr;
+            const unsigned long first = strtoul(cursor, &end, 10);
+            if (end == cursor)
+            {
+                return false;
+            }
+
+            unsigned long last = first;
+            cursor = end;
+            if (*cursor == '-')
+            {
+                ++cursor;
+                last = strtoul(cursor, &end, 10);
+                if (end == cursor || last < first)
+                {
+                    return false;
+                }
+                cursor = end;
+            }
+
+            for (unsigned long cpu = first; cpu <= last; ++cpu)
+            {
+                cpus.push_back(static_cast<uint32_t>(cpu));
+            }
+
+            if (*cursor == ',')
+            {
+                ++cursor;
+            }
+            else if (*cursor != '\0' && *cursor != '\n')
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+} // namespace KanchoNet
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "../Platform.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace KanchoNet
+{
+    // 스레드 CPU 고정과 NUMA 메모리 배치
+    // Linux는 sched_setaffinity/set_mempolicy 시스템 콜을 직접 사용 (libnuma 불필요)
+    // Windows는 CPU 고정(64개 이하)만 지원
+    class CpuAffinity
+    {
+    public:
+        // public 멤버변수
+        static constexpr uint32_t MAX_NUMA_NODES = 1024;
+
+    public:
+        // public 함수
+        // 현재 스레드를 CPU 목록 안에서만 실행되도록 고정
+        static bool PinCurrentThread(const std::vector<uint32_t>& cpus);
+
+        // 현재 스레드가 새로 할당하는 메모리 페이지를 NUMA 노드에 우선 배치 (node가 음수면 기본 정책으로 복원)
+        // 이미 할당된 페이지는 옮기지 않으며, 노드 메모리가 부족하면 다른 노드에서 할당
+        static bool SetPreferredNode(int32_t node);
+
+        // NUMA 노드에 속한 CPU 목록 (/sys/devices/system/node/node<N>/cpulist)
+        static bool GetNodeCpus(int32_t node, std::vector<uint32_t>& cpus);
+
+        // 현재 스레드가 실행 중인 CPU (알 수 없으면 -1)
+        static int32_t GetCurrentCpu();
+
+        // "0-3,8,10-11" 형식의 CPU 목록 파싱 (sysfs cpulist, taskset -c 형식)
+        static bool ParseCpuList(const std::string& text, std::vector<uint32_t>& cpus);
+    };
+
+} // namespace KanchoNet
@@ -0,0 +1,83 @@
+#include "LogQueue.h"
+
+namespace KanchoNet
+{
+    static size_t RoundUpToPowerOfTwo(size_t value)
+    {
+        size_t result = 1;
+        while (result < value)
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    LogQueue::LogQueue(size_t capacity)
+        : mCapacity(RoundUpToPowerOfTwo(capacity < 4096 ? 4096 : capacity))
+        , mMask(0)
+        , mWritePos(0)
+        , mCachedReadPos(0)
+        , mReservedPos(0)
+        , mReadPos(0)
+        , mOrphaned(false)
+    {
+        mMask = mCapacity - 1;
+        mBuffer.resize(mCapacity);
+    }
+
+    LogQueue::~LogQueue()
+    {
+    }
+
+    LogRecordHeader* LogQueue::Reserve(size_t maxLength)
+    {
+        const size_t recordSize = AlignRecordSize(sizeof(LogRecordHeader) + maxLength + 1);
+        if (recordSize > mCapacity / 2)
+            return nullptr;
+
+        const uint64_t writePos = mWritePos.load(std::memory_order_relaxed);
+        const size_t offset = static_cast<size_t>(writePos & mMask);
+        const size_t contiguous = mCapacity - offset;
+
+        // 버퍼 끝에 레코드가 연속으로 들어가지 않으면 남은 공간을 패딩으로 건너뜀
+        const size_t padding = (contiguous < recordSize) ? contiguous : 0;
+        const size_t required = padding + recordSize;
+
+        if (mCapacity - (writePos - mCachedReadPos) < required)
+        {
+            mCachedReadPos = mReadPos.load(std::memory_order_acquire);
+            if (mCapacity - (writePos - mCachedReadPos) < required)
+                return nullptr;
+        }
+
+        if (padding > 0)
+        {
+            // 레코드는 8바이트 정렬이므로 남은 공간에 최소한 mSize/mFlags는 기록 가능
+            LogRecordHeader* pad = GetRecordAt(writePos);
+            pad->mSize = static_cast<uint32_t>(padding);
+            pad->mFlags = FLAG_PADDING;
+        }
+
+        mReservedPos = writePos + padding;
+
+        LogRecordHeader* record = GetRecordAt(mReservedPos);
+        record->mFlags = 0;
+        return record;
+    }
+
+    void LogQueue::Commit(LogRecordHeader* record, size_t length)
+    {
+        record->mLength = static_cast<uint16_t>(length);
+        record->mSize = static_cast<uint32_t>(AlignRecordSize(sizeof(LogRecordHeader) + length + 1));
+
+        // 패딩과 레코드를 한 번에 공개
+        mWritePos.store(mReservedPos + record->mSize, std::memory_order_release);
+    }
+
+    bool LogQueue::IsEmpty() const
+    {
+        return mReadPos.load(std::memory_order_acquire) == mWritePos.load(std::memory_order_acquire);
+    }
+
+} // namespace KanchoNet
+
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "../Types.h"
+#include "NonCopyable.h"
+#include <atomic>
+#include <vector>
+
+namespace KanchoNet
+{
+    // 비동기 로거용 바이너리 로그 레코드 헤더
+    // 레코드 = 헤더 + 메시지 바이트, 8바이트 단위로 정렬되어 큐에 연속 배치
+    struct LogRecordHeader
+    {
+        uint32_t mSize;       // 헤더 포함 레코드 전체 크기 (정렬 포함)
+        uint16_t mLength;     // 메시지 길이 (널 문자 제외)
+        uint8_t mLevel;       // LogLevel
+        uint8_t mFlags;       // LogQueue::FLAG_PADDING 등
+        int64_t mTimestamp;   // system_clock 기준 마이크로초
+
+        char* GetText() { return reinterpret_cast<char*>(this + 1); }
+        const char* GetText() const { return reinterpret_cast<const char*>(this + 1); }
+    };
+
+    // 단일 생산자/단일 소비자 락프리 로그 큐
+    // 생산자(로그를 남기는 스레드)는 Reserve로 받은 메모리에 메시지를 직접 기록한 뒤 Commit
+    // 소비자(로거 백그라운드 스레드)는 Drain으로 레코드를 읽고 공간을 반환
+    // 큐가 가득 차면 Reserve가 실패하며 생산자는 대기하지 않음 (호출자가 드롭 처리)
+    class LogQueue : public NonCopyable
+    {
+    public:
+        // public 멤버변수
+        static constexpr uint8_t FLAG_PADDING = 0x01;   // 버퍼 끝 빈 공간 (랩어라운드용)
+        static constexpr size_t RECORD_ALIGNMENT = 8;
+
+    private:
+        // private 멤버변수
+        std::vector<uint8_t> mBuffer;
+        size_t mCapacity;   // 2의 거듭제곱
+        size_t mMask;
+
+        // 생산자 전용
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> mWritePos;
+        uint64_t mCachedReadPos;    // 마지막으로 확인한 소비 위치 (공유 캐시 라인 접근 최소화)
+        uint64_t mReservedPos;      // Reserve로 확보한 레코드 시작 위치 (패딩 이후)
+
+        // 소비자 전용
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> mReadPos;
+
+        // 소유 스레드 종료 여부 (종료 후 비워지면 로거가 큐를 회수)
+        alignas(CACHE_LINE_SIZE) std::atomic<bool> mOrphaned;
+
+    public:
+        // 생성자, 파괴자
+        explicit LogQueue(size_t capacity);
+        ~LogQueue();
+
+    public:
+        // public 함수
+        // 생산자: 메시지 최대 maxLength 바이트를 기록할 공간 확보 (실패 시 nullptr)
+        LogRecordHeader* Reserve(size_t maxLength);
+
+        // 생산자: 실제 기록한 메시지 길이로 레코드 확정 (Reserve 직후 한 번만 호출)
+        void Commit(LogRecordHeader* record, size_t length);
+
+        // 소비자: 쌓인 레코드를 순서대로 콜백에 전달 (반환값: 처리한 레코드 수)
+        template<typename TCallback>
+        size_t Drain(TCallback&& callback);
+
+        // 상태
+        bool IsEmpty() const;
+        size_t GetCapacity() const { return mCapacity; }
+
+        // 소유 스레드 종료 표시
+        void SetOrphaned() { mOrphaned.store(true, std::memory_order_release); }
+        bool IsOrphaned() const { return mOrphaned.load(std::memory_order_acquire); }
+
+    private:
+        // private 함수
+        static size_t AlignRecordSize(size_t size)
+        {
+            return (size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+        }
+
+        LogRecordHeader* GetRecordAt(uint64_t pos)
+        {
+            return reinterpret_cast<LogRecordHeader*>(mBuffer.data() + (pos & mMask));
+        }
+    };
+
+    // 템플릿 구현
+    template<typename TCallback>
+    size_t LogQueue::Drain(TCallback&& callback)
+    {
+        uint64_t readPos = mReadPos.load(std::memory_order_relaxed);
+        const uint64_t writePos = mWritePos.load(std::memory_order_acquire);
+
+        size_t count = 0;
+        while (readPos < writePos)
+        {
+            const LogRecordHeader* record = GetRecordAt(readPos);
+            if ((record->mFlags & FLAG_PADDING) == 0)
+            {
+                callback(*record);
+                ++count;
+            }
+            readPos += record->mSize;
+        }
+
+        mReadPos.store(readPos, std::memory_order_release);
+        return count;
+    }
+
+} // namespace KanchoNet
+
@@ -3,32 +3,143 @@
 #include <cstdarg>
 #include <ctime>
 #include <chrono>
+#include <algorithm>
 
 namespace KanchoNet
 {
-    Logger& Logger::GetInstance()
+    // 플랫폼별 localtime (스레드 안전 버전)
+    static void ToLocalTime(time_t time, struct tm* timeInfo)
     {
-        static Logger instance;
-        return instance;
+    #ifdef KANCHONET_PLATFORM_WINDOWS
+        localtime_s(timeInfo, &time);
+    #else
+        localtime_r(&time, timeInfo);
+    #endif
     }
 
+    // 스레드별 로그 큐 핸들 (스레드 종료 시 큐를 회수 대상으로 표시)
+    struct ThreadLogQueue
+    {
+        std::shared_ptr<LogQueue> mQueue;
+
+        ~ThreadLogQueue()
+        {
+            if (mQueue)
+            {
+                mQueue->SetOrphaned();
+            }
+        }
+    };
+
+    static thread_local ThreadLogQueue tThreadLogQueue;
+
     Logger::Logger()
         : mCurrentLevel(LogLevel::Info)
+        , mOutput(stdout)
+        , mOwnsOutput(false)
+        , mAsync(false)
+        , mRunning(false)
+        , mQueueCapacity(DEFAULT_QUEUE_CAPACITY)
+        , mDroppedCount(0)
+        , mReportedDropCount(0)
+    {
+    }
+
+    Logger::~Logger()
     {
+        StopAsync();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mOwnsOutput && mOutput)
+        {
+            fclose(mOutput);
+        }
+        mOutput = stdout;
+        mOwnsOutput = false;
+    }
+
+    bool Logger::SetOutputFile(const char* filePath)
+    {
+        FILE* file = stdout;
+        if (filePath)
+        {
+        #ifdef KANCHONET_PLATFORM_WINDOWS
+            if (fopen_s(&file, filePath, "a") != 0)
+                file = nullptr;
+        #else
+            file = fopen(filePath, "a");
+        #endif
+            if (!file)
+                return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mOwnsOutput && mOutput)
+        {
+            fclose(mOutput);
+        }
+        mOutput = file;
+        mOwnsOutput = (filePath != nullptr);
+        return true;
+    }
+
+    bool Logger::StartAsync(size_t queueCapacity)
+    {
+        bool expected = false;
+        if (!mRunning.compare_exchange_strong(expected, true))
+            return false;
+
+        mQueueCapacity = queueCapacity;
+        mFlushThread = std::thread(&Logger::FlushThreadMain, this);
+        mAsync.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void Logger::StopAsync()
+    {
+        if (!mRunning.load())
+            return;
+
+        // 새 로그는 동기 모드로 전환한 뒤 백그라운드 스레드가 남은 큐를 비우고 종료
+        mAsync.store(false, std::memory_order_release);
+        mRunning.store(false);
+
+        if (mFlushThread.joinable())
+        {
+            mFlushThread.join();
+        }
     }
 
     void Logger::Log(LogLevel level, const char* format, ...)
     {
-        if (level < mCurrentLevel)
+        va_list args;
+        va_start(args, format);
+        LogV(level, format, args);
+        va_end(args);
+    }
+
+    void Logger::LogV(LogLevel level, const char* format, va_list args)
+    {
+        if (!IsEnabled(level))
             return;
 
-        std::lock_guard<std::mutex> lock(mMutex);
+        if (mAsync.load(std::memory_order_acquire))
+        {
+            Enqueue(level, format, args);
+        }
+        else
+        {
+            WriteSync(level, format, args);
+        }
+    }
 
+    void Logger::WriteSync(LogLevel level, const char* format, va_list args)
+    {
         // 타임스탬프
         auto now = std::chrono::system_clock::now();
         auto timeT = std::chrono::system_clock::to_time_t(now);
         struct tm timeInfo;
-        localtime_s(&timeInfo, &timeT);
+        ToLocalTime(timeT, &timeInfo);
 
         char timeBuffer[64];
         strftime(timeBuffer, sizeof(timeBuffer), "%Y-%m-%d %H:%M:%S", &timeInfo);
@@ -36,75 +147,180 @@ namespace KanchoNet
         // 로그 레벨
         const char* levelStr = GetLogLevelString(level);
 
+        std::lock_guard<std::mutex> lock(mMutex);
+
         // 출력
-        printf("[%s] [%s] ", timeBuffer, levelStr);
+        fprintf(mOutput, "[%s] [%s] ", timeBuffer, levelStr);
+        vfprintf(mOutput, format, args);
+        fputc('\n', mOutput);
+        fflush(mOutput);
+    }
 
-        va_list args;
-        va_start(args, format);
-        vprintf(format, args);
-        va_end(args);
+    void Logger::Enqueue(LogLevel level, const char* format, va_list args)
+    {
+        LogQueue* queue = GetThreadQueue();
+        LogRecordHeader* record = queue ? queue->Reserve(MAX_MESSAGE_LENGTH) : nullptr;
+        if (!record)
+        {
+            // 큐가 가득 참: 대기하지 않고 버림
+            mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // 메시지는 큐 메모리에 직접 포맷 (printf 인자의 수명이 호출 범위로 한정되므로 여기서 문자열화)
+        int written = vsnprintf(record->GetText(), MAX_MESSAGE_LENGTH + 1, format, args);
+        size_t length = (written < 0) ? 0 : (std::min)(static_cast<size_t>(written), MAX_MESSAGE_LENGTH);
+
+        record->mLevel = static_cast<uint8_t>(level);
+        record->mTimestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
 
-        printf("\n");
-        fflush(stdout);
+        queue->Commit(record, length);
     }
 
-    void Logger::LogDebug(const char* format, ...)
+    LogQueue* Logger::GetThreadQueue()
     {
-        if (LogLevel::Debug < mCurrentLevel)
+        if (!tThreadLogQueue.mQueue)
+        {
+            auto queue = std::make_shared<LogQueue>(mQueueCapacity);
+
+            std::lock_guard<std::mutex> lock(mQueuesMutex);
+            mQueues.push_back(queue);
+            tThreadLogQueue.mQueue = std::move(queue);
+        }
+
+        return tThreadLogQueue.mQueue.get();
+    }
+
+    void Logger::FlushThreadMain()
+    {
+        std::string batch;
+        batch.reserve(64 * 1024);
+
+        while (mRunning.load())
+        {
+            if (DrainQueues(batch) == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(FLUSH_INTERVAL_MS));
+            }
+        }
+
+        // 종료 전 남은 로그 출력
+        DrainQueues(batch);
+    }
+
+    size_t Logger::DrainQueues(std::string& batch)
+    {
+        constexpr size_t BATCH_WRITE_SIZE = 64 * 1024;
+        size_t count = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(mQueuesMutex);
+
+            for (auto it = mQueues.begin(); it != mQueues.end(); )
+            {
+                // 소유 스레드가 종료된 큐는 마지막으로 비운 뒤 회수
+                bool orphaned = (*it)->IsOrphaned();
+
+                count += (*it)->Drain([this, &batch](const LogRecordHeader& record) {
+                    AppendRecord(record, batch);
+                    if (batch.size() >= BATCH_WRITE_SIZE)
+                    {
+                        WriteBatch(batch);
+                    }
+                });
+
+                if (orphaned && (*it)->IsEmpty())
+                {
+                    it = mQueues.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        // 드롭 발생 알림
+        uint64_t dropped = mDroppedCount.load(std::memory_order_relaxed);
+        if (dropped != mReportedDropCount)
+        {
+            char line[128];
+            snprintf(line, sizeof(line), "[%s] %llu log messages dropped (queue full)\n",
+                     GetLogLevelString(LogLevel::Warning),
+                     static_cast<unsigned long long>(dropped - mReportedDropCount));
+            batch.append(line);
+            mReportedDropCount = dropped;
+        }
+
+        WriteBatch(batch);
+        return count;
+    }
+
+    void Logger::AppendRecord(const LogRecordHeader& record, std::string& batch)
+    {
+        // 같은 초의 레코드는 포맷된 시간 문자열 재사용
+        static thread_local time_t sLastSecond = 0;
+        static thread_local char sTimeBuffer[64] = {};
+
+        time_t second = static_cast<time_t>(record.mTimestamp / 1000000);
+        if (second != sLastSecond)
+        {
+            struct tm timeInfo;
+            ToLocalTime(second, &timeInfo);
+            strftime(sTimeBuffer, sizeof(sTimeBuffer), "%Y-%m-%d %H:%M:%S", &timeInfo);
+            sLastSecond = second;
+        }
+
+        batch.push_back('[');
+        batch.append(sTimeBuffer);
+        batch.append("] [");
+        batch.append(GetLogLevelString(static_cast<LogLevel>(record.mLevel)));
+        batch.append("] ");
+        batch.append(record.GetText(), record.mLength);
+        batch.push_back('\n');
+    }
+
+    void Logger::WriteBatch(std::string& batch)
+    {
+        if (batch.empty())
             return;
 
+        std::lock_guard<std::mutex> lock(mMutex);
+        fwrite(batch.data(), 1, batch.size(), mOutput);
+        fflush(mOutput);
+        batch.clear();
+    }
+
+    void Logger::LogDebug(const char* format, ...)
+    {
         va_list args;
         va_start(args, format);
-        
-        char buffer[1024];
-        vsnprintf(buffer, sizeof(buffer), format, args);
-        Log(LogLevel::Debug, "%s", buffer);
-        
+        LogV(LogLevel::Debug, format, args);
         va_end(args);
     }
 
     void Logger::LogInfo(const char* format, ...)
     {
-        if (LogLevel::Info < mCurrentLevel)
-            return;
-
         va_list args;
         va_start(args, format);
-        
-        char buffer[1024];
-        vsnprintf(buffer, sizeof(buffer), format, args);
-        Log(LogLevel::Info, "%s", buffer);
-        
+        LogV(LogLevel::Info, format, args);
         va_end(args);
     }
 
     void Logger::LogWarning(const char* format, ...)
     {
-        if (LogLevel::Warning < mCurrentLevel)
-            return;
-
         va_list args;
         va_start(args, format);
-        
-        char buffer[1024];
-        vsnprintf(buffer, sizeof(buffer), format, args);
-        Log(LogLevel::Warning, "%s", buffer);
-        
+        LogV(LogLevel::Warning, format, args);
         va_end(args);
     }
 
     void Logger::LogError(const char* format, ...)
     {
-        if (LogLevel::Error < mCurrentLevel)
-            return;
-
         va_list args;
         va_start(args, format);
-        
-        char buffer[1024];
-        vsnprintf(buffer, sizeof(buffer), format, args);
-        Log(LogLevel::Error, "%s", buffer);
-        
+        LogV(LogLevel::Error, format, args);
         va_end(args);
     }
 
@@ -112,11 +328,7 @@ namespace KanchoNet
     {
         va_list args;
         va_start(args, format);
-        
-        char buffer[1024];
-        vsnprintf(buffer, sizeof(buffer), format, args);
-        Log(LogLevel::Critical, "%s", buffer);
-        
+        LogV(LogLevel::Critical, format, args);
         va_end(args);
     }
 
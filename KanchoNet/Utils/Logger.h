@@ -1,8 +1,33 @@
 #pragma once
 
 #include "../Types.h"
+#include "LogQueue.h"
 #include <string>
 #include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <cstdio>
+#include <cstdarg>
+
+// 로그 레벨 값 (전처리기 비교용, LogLevel과 동일)
+#define KANCHONET_LOG_LEVEL_DEBUG       0
+#define KANCHONET_LOG_LEVEL_INFO        1
+#define KANCHONET_LOG_LEVEL_WARNING     2
+#define KANCHONET_LOG_LEVEL_ERROR       3
+#define KANCHONET_LOG_LEVEL_CRITICAL    4
+
+// 컴파일 타임 최소 로그 레벨
+// 이보다 낮은 레벨의 LOG_* 매크로는 인자 평가를 포함해 코드가 생성되지 않음
+// (기본값: 디버그 빌드 Debug, 릴리즈 빌드 Info)
+#ifndef KANCHONET_MIN_LOG_LEVEL
+    #ifdef KANCHONET_DEBUG
+        #define KANCHONET_MIN_LOG_LEVEL KANCHONET_LOG_LEVEL_DEBUG
+    #else
+        #define KANCHONET_MIN_LOG_LEVEL KANCHONET_LOG_LEVEL_INFO
+    #endif
+#endif
 
 namespace KanchoNet
 {
@@ -17,20 +42,38 @@ namespace KanchoNet
     };
 
     // 간단한 로거 (디버그 및 기본 로깅용)
+    // 기본은 동기 모드 (호출 스레드에서 바로 출력)
+    // StartAsync 호출 시 비동기 모드: 스레드별 락프리 큐에 바이너리 레코드만 기록하고
+    // 타임스탬프 포맷팅과 출력은 백그라운드 스레드가 모아서 처리 (큐가 가득 차면 드롭 후 카운트)
     class Logger
     {
     public:
-        // public 멤버변수 (없음)
+        // public 멤버변수
+        static constexpr size_t MAX_MESSAGE_LENGTH = 1024;              // 로그 한 줄 최대 길이
+        static constexpr size_t DEFAULT_QUEUE_CAPACITY = 256 * 1024;    // 스레드별 큐 크기 (256KB)
+        static constexpr uint32_t FLUSH_INTERVAL_MS = 10;               // 큐가 비었을 때 백그라운드 대기 간격
         
     private:
         // private 멤버변수
-        LogLevel mCurrentLevel;
-        std::mutex mMutex;
+        std::atomic<LogLevel> mCurrentLevel;
+        std::mutex mMutex;          // 출력 대상 보호 (동기 모드 출력, 파일 교체, 배치 쓰기)
+        FILE* mOutput;              // 출력 대상 (기본 stdout)
+        bool mOwnsOutput;           // SetOutputFile로 연 파일인지 여부
+
+        // 비동기 모드
+        std::atomic<bool> mAsync;
+        std::atomic<bool> mRunning;
+        std::thread mFlushThread;
+        size_t mQueueCapacity;
+        std::mutex mQueuesMutex;    // 큐 등록/회수 시에만 사용 (로그 기록 경로에서는 사용 안 함)
+        std::vector<std::shared_ptr<LogQueue>> mQueues;
+        std::atomic<uint64_t> mDroppedCount;
+        uint64_t mReportedDropCount;
         
     public:
         // 생성자, 파괴자
         Logger();
-        ~Logger() = default;
+        ~Logger();
 
         // 복사/이동 불가
         Logger(const Logger&) = delete;
@@ -38,11 +81,28 @@ namespace KanchoNet
         
     public:
         // public 함수
-        static Logger& GetInstance();
+        static Logger& GetInstance()
+        {
+            static Logger instance;
+            return instance;
+        }
 
         // 로그 레벨 설정
-        void SetLogLevel(LogLevel level) { mCurrentLevel = level; }
-        LogLevel GetLogLevel() const { return mCurrentLevel; }
+        // (컴파일 타임 최소 레벨보다 낮게 설정해도 제거된 로그는 출력되지 않음)
+        void SetLogLevel(LogLevel level) { mCurrentLevel.store(level, std::memory_order_relaxed); }
+        LogLevel GetLogLevel() const { return mCurrentLevel.load(std::memory_order_relaxed); }
+        bool IsEnabled(LogLevel level) const { return level >= GetLogLevel(); }
+
+        // 출력 대상 설정 (nullptr이면 stdout, 파일은 이어쓰기 모드)
+        bool SetOutputFile(const char* filePath);
+
+        // 비동기 모드 시작/종료 (종료 시 남은 로그를 모두 출력)
+        bool StartAsync(size_t queueCapacity = DEFAULT_QUEUE_CAPACITY);
+        void StopAsync();
+        bool IsAsync() const { return mAsync.load(std::memory_order_acquire); }
+
+        // 큐가 가득 차서 버려진 로그 수
+        uint64_t GetDroppedCount() const { return mDroppedCount.load(std::memory_order_relaxed); }
 
         // 로그 출력
         void Log(LogLevel level, const char* format, ...);
@@ -59,14 +119,57 @@ namespace KanchoNet
         // private 함수
         const char* GetLogLevelString(LogLevel level) const;
         const char* GetErrorCodeString(ErrorCode errorCode) const;
+
+        // 레벨 확인 후 한 번만 포맷하여 출력 (모든 Log* 함수의 공통 경로)
+        void LogV(LogLevel level, const char* format, va_list args);
+
+        // 동기 출력
+        void WriteSync(LogLevel level, const char* format, va_list args);
+
+        // 비동기 기록 (호출 스레드의 큐에 레코드 추가)
+        void Enqueue(LogLevel level, const char* format, va_list args);
+        LogQueue* GetThreadQueue();
+
+        // 백그라운드 스레드
+        void FlushThreadMain();
+        size_t DrainQueues(std::string& batch);
+        void AppendRecord(const LogRecordHeader& record, std::string& batch);
+        void WriteBatch(std::string& batch);
     };
 
     // 편의 매크로
-    #define LOG_DEBUG(format, ...) KanchoNet::Logger::GetInstance().LogDebug(format, ##__VA_ARGS__)
-    #define LOG_INFO(format, ...) KanchoNet::Logger::GetInstance().LogInfo(format, ##__VA_ARGS__)
-    #define LOG_WARNING(format, ...) KanchoNet::Logger::GetInstance().LogWarning(format, ##__VA_ARGS__)
-    #define LOG_ERROR(format, ...) KanchoNet::Logger::GetInstance().LogError(format, ##__VA_ARGS__)
-    #define LOG_CRITICAL(format, ...) KanchoNet::Logger::GetInstance().LogCritical(format, ##__VA_ARGS__)
+    // 런타임 레벨을 먼저 확인하므로 걸러지는 로그는 인자를 평가하지 않음
+    #define KANCHONET_LOG(level, format, ...) \
+        (KanchoNet::Logger::GetInstance().IsEnabled(level) \
+            ? KanchoNet::Logger::GetInstance().Log(level, format, ##__VA_ARGS__) \
+            : (void)0)
+
+    #if KANCHONET_MIN_LOG_LEVEL <= KANCHONET_LOG_LEVEL_DEBUG
+        #define LOG_DEBUG(format, ...) KANCHONET_LOG(KanchoNet::LogLevel::Debug, format, ##__VA_ARGS__)
+    #else
+        #define LOG_DEBUG(format, ...) ((void)0)
+    #endif
+
+    #if KANCHONET_MIN_LOG_LEVEL <= KANCHONET_LOG_LEVEL_INFO
+        #define LOG_INFO(format, ...) KANCHONET_LOG(KanchoNet::LogLevel::Info, format, ##__VA_ARGS__)
+    #else
+        #define LOG_INFO(format, ...) ((void)0)
+    #endif
+
+    #if KANCHONET_MIN_LOG_LEVEL <= KANCHONET_LOG_LEVEL_WARNING
+        #define LOG_WARNING(format, ...) KANCHONET_LOG(KanchoNet::LogLevel::Warning, format, ##__VA_ARGS__)
+    #else
+        #define LOG_WARNING(format, ...) ((void)0)
+    #endif
+
+    #if KANCHONET_MIN_LOG_LEVEL <= KANCHONET_LOG_LEVEL_ERROR
+        #define LOG_ERROR(format, ...) KANCHONET_LOG(KanchoNet::LogLevel::Error, format, ##__VA_ARGS__)
+    #else
+        #define LOG_ERROR(format, ...) ((void)0)
+    #endif
+
+    // Critical은 항상 유지
+    #define LOG_CRITICAL(format, ...) KANCHONET_LOG(KanchoNet::LogLevel::Critical, format, ##__VA_ARGS__)
 
 } // namespace KanchoNet
 
@@ -0,0 +1,71 @@
+#include "RateLimiter.h"
+
+namespace KanchoNet
+{
+    KeyedRateLimiter::KeyedRateLimiter()
+        : mInterval(0)
+        , mTolerance(0)
+        , mSlotMask(0)
+    {
+    }
+
+    void KeyedRateLimiter::Configure(uint64_t ratePerSec, uint64_t burst, size_t slotCount)
+    {
+        if (ratePerSec == 0)
+        {
+            mInterval = 0;
+            mTolerance = 0;
+            mSlotMask = 0;
+            mSlots.reset();
+            return;
+        }
+
+        size_t count = 1;
+        while (count < slotCount)
+        {
+            count <<= 1;
+        }
+
+        mSlots = std::make_unique<std::atomic<int64_t>[]>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            mSlots[i].store(0, std::memory_order_relaxed);
+        }
+        mSlotMask = count - 1;
+
+        mInterval = std::max<int64_t>(1, static_cast<int64_t>(1000000000ull / ratePerSec));
+        mTolerance = mInterval * static_cast<int64_t>(burst != 0 ? burst : ratePerSec);
+    }
+
+    bool KeyedRateLimiter::TryAcquire(uint64_t key, int64_t now)
+    {
+        if (!IsEnabled())
+        {
+            return true;
+        }
+
+        // 비슷한 주소(같은 대역)가 한 슬롯에 몰리지 않도록 섞음 (splitmix64 마무리 단계)
+        key ^= key >> 30;
+        key *= 0xBF58476D1CE4E5B9ull;
+        key ^= key >> 27;
+        key *= 0x94D049BB133111EBull;
+        key ^= key >> 31;
+
+        std::atomic<int64_t>& slot = mSlots[key & mSlotMask];
+        int64_t tat = slot.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const int64_t next = std::max(tat, now) + mInterval;
+            if (next - now > mTolerance)
+            {
+                return false;
+            }
+
+            if (slot.compare_exchange_weak(tat, next, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+    }
+
+} // namespace KanchoNet
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "../Types.h"
+#include "NonCopyable.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace KanchoNet
+{
+    // 토큰 버킷 (GCRA 방식)
+    // 남은 토큰 수 대신 "버킷이 다시 가득 차는 시각(TAT)" 하나만 저장하므로 갱신이 덧셈/비교 몇 번으로 끝남
+    // 단위 하나를 소비할 때마다 TAT가 1/rate초 뒤로 밀리고, TAT가 현재보다 burst/rate초 이상 앞서면 한도 초과
+    // 한 스레드만 접근해야 함 (세션 수신 경로처럼 세션별로 직렬화된 곳에서 사용, 락 없음)
+    class TokenBucket
+    {
+    public:
+        // public 멤버변수 (없음)
+
+    private:
+        // private 멤버변수
+        double mInterval;       // 단위 하나당 시간 (ns, 0 = 제한 없음)
+        int64_t mTolerance;     // 버스트 허용 폭 (ns, burst 단위만큼의 시간)
+        int64_t mTat;           // 이론적 도착 시각 (ns)
+
+    public:
+        // 생성자, 파괴자
+        TokenBucket() : mInterval(0.0), mTolerance(0), mTat(0) {}
+
+        // ratePerSec: 초당 단위 수 (0 = 제한 없음), burst: 한 번에 몰아서 허용하는 단위 수 (0 = ratePerSec, 즉 1초분)
+        TokenBucket(uint64_t ratePerSec, uint64_t burst) : mInterval(0.0), mTolerance(0), mTat(0)
+        {
+            Configure(ratePerSec, burst);
+        }
+
+    public:
+        // public 함수
+        void Configure(uint64_t ratePerSec, uint64_t burst)
+        {
+            mTat = 0;
+            if (ratePerSec == 0)
+            {
+                mInterval = 0.0;
+                mTolerance = 0;
+                return;
+            }
+
+            mInterval = 1e9 / static_cast<double>(ratePerSec);
+            mTolerance = static_cast<int64_t>(mInterval * static_cast<double>(burst != 0 ? burst : ratePerSec));
+        }
+
+        bool IsEnabled() const { return mInterval > 0.0; }
+
+        // 한도 안이면 소비하고 true, 넘으면 소비하지 않고 false (버림/거부용)
+        bool TryConsume(uint64_t amount, int64_t now)
+        {
+            if (!IsEnabled())
+            {
+                return true;
+            }
+
+            const int64_t tat = std::max(mTat, now) + Cost(amount);
+            if (tat - now > mTolerance)
+            {
+                return false;
+            }
+
+            mTat = tat;
+            return true;
+        }
+
+        // 한도와 관계없이 소비 (이미 읽은 데이터 반영용, 넘은 만큼은 빚으로 남아 GetResumeTime이 뒤로 밀림)
+        // 반환값: 소비한 뒤에도 한도 안인지
+        bool Consume(uint64_t amount, int64_t now)
+        {
+            if (!IsEnabled())
+            {
+                return true;
+            }
+
+            mTat = std::max(mTat, now) + Cost(amount);
+            return mTat - now <= mTolerance;
+        }
+
+        // 한도를 넘은 뒤 다시 받아도 되는 시각 (버스트의 절반이 다시 찼을 때, 바로 다시 멈추지 않도록)
+        int64_t GetResumeTime() const { return mTat - mTolerance / 2; }
+
+    private:
+        // private 함수
+        int64_t Cost(uint64_t amount) const { return static_cast<int64_t>(mInterval * static_cast<double>(amount)); }
+    };
+
+    // 키(출발지 IP 등)별 토큰 버킷 표
+    // 키를 해시해 고정 크기 슬롯에 나누고 슬롯마다 TAT 하나를 CAS로 갱신 (락 없음, 여러 I/O 스레드에서 호출 가능)
+    // 해시가 겹친 키는 같은 버킷을 나눠 쓰므로 한도가 조금 더 엄격해질 수 있음 (느슨해지지는 않음)
+    class KeyedRateLimiter : public NonCopyable
+    {
+    public:
+        // public 멤버변수
+        static constexpr size_t DEFAULT_SLOT_COUNT = 4096;
+
+    private:
+        // private 멤버변수
+        int64_t mInterval;      // 단위 하나당 시간 (ns, 0 = 제한 없음)
+        int64_t mTolerance;     // 버스트 허용 폭 (ns)
+        size_t mSlotMask;
+        std::unique_ptr<std::atomic<int64_t>[]> mSlots;
+
+    public:
+        // 생성자, 파괴자
+        KeyedRateLimiter();
+        ~KeyedRateLimiter() = default;
+
+    public:
+        // public 함수
+        // ratePerSec: 키마다 초당 허용 횟수 (0 = 제한 없음), burst: 0이면 ratePerSec
+        // slotCount는 2의 거듭제곱으로 올림. 호출 중인 스레드가 없을 때 설정
+        void Configure(uint64_t ratePerSec, uint64_t burst, size_t slotCount = DEFAULT_SLOT_COUNT);
+
+        bool IsEnabled() const { return mInterval > 0; }
+
+        // 키의 버킷에서 하나 소비 (한도를 넘으면 소비하지 않고 false)
+        bool TryAcquire(uint64_t key, int64_t now);
+    };
+
+} // namespace KanchoNet
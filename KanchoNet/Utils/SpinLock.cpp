@@ -1,9 +1,107 @@
 #include "SpinLock.h"
 
+#ifdef KANCHONET_PLATFORM_WINDOWS
+    #include <Windows.h>
+    #pragma comment(lib, "Synchronization.lib")
+#elif defined(KANCHONET_PLATFORM_LINUX)
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
 namespace KanchoNet
 {
-    // SpinLock은 헤더에 모든 구현이 포함되어 있음
-    // 이 파일은 프로젝트 구조의 일관성을 위해 유지
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+                  "SpinLock state must be usable as a futex word");
+
+    void SpinLock::LockSlow()
+    {
+        uint64_t spins = 0;
+        uint64_t parks = 0;
+
+        // 1단계: 지수 백오프 스핀 (짧은 임계 구역은 대부분 여기서 획득)
+        for (uint32_t round = 0; round < MAX_SPIN_ROUNDS; ++round)
+        {
+            const uint32_t pauseCount = 1u << round;
+            for (uint32_t i = 0; i < pauseCount; ++i)
+            {
+                CpuRelax();
+            }
+            spins += pauseCount;
+
+            uint32_t expected = UNLOCKED;
+            if (mState.load(std::memory_order_relaxed) == UNLOCKED &&
+                mState.compare_exchange_weak(expected, LOCKED,
+                                             std::memory_order_acquire, std::memory_order_relaxed))
+            {
+            #ifdef KANCHONET_SPINLOCK_STATS
+                mContentions.fetch_add(1, std::memory_order_relaxed);
+                mSpins.fetch_add(spins, std::memory_order_relaxed);
+            #endif
+                return;
+            }
+        }
+
+        // 2단계: 대기자 표시(CONTENDED) 후 커널에서 대기
+        // 이 경로로 획득하면 상태가 CONTENDED로 남으므로 해제 시 다른 대기자를 깨움
+        while (mState.exchange(CONTENDED, std::memory_order_acquire) != UNLOCKED)
+        {
+            ++parks;
+            Park(CONTENDED);
+        }
+
+    #ifdef KANCHONET_SPINLOCK_STATS
+        mContentions.fetch_add(1, std::memory_order_relaxed);
+        mSpins.fetch_add(spins, std::memory_order_relaxed);
+        mParks.fetch_add(parks, std::memory_order_relaxed);
+    #else
+        (void)spins;
+        (void)parks;
+    #endif
+    }
+
+    void SpinLock::Park(uint32_t expected)
+    {
+    #ifdef KANCHONET_PLATFORM_WINDOWS
+        WaitOnAddress(&mState, &expected, sizeof(expected), INFINITE);
+    #elif defined(KANCHONET_PLATFORM_LINUX)
+        // 상태가 expected가 아니면 즉시 반환 (깨우기 누락 없음)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&mState), FUTEX_WAIT_PRIVATE,
+                expected, nullptr, nullptr, 0);
+    #endif
+    }
+
+    void SpinLock::WakeOne()
+    {
+    #ifdef KANCHONET_PLATFORM_WINDOWS
+        WakeByAddressSingle(&mState);
+    #elif defined(KANCHONET_PLATFORM_LINUX)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&mState), FUTEX_WAKE_PRIVATE,
+                1, nullptr, nullptr, 0);
+    #endif
+    }
+
+    SpinLockStats SpinLock::GetStats() const
+    {
+        SpinLockStats stats;
+    #ifdef KANCHONET_SPINLOCK_STATS
+        stats.mAcquisitions = mAcquisitions.load(std::memory_order_relaxed);
+        stats.mContentions = mContentions.load(std::memory_order_relaxed);
+        stats.mSpins = mSpins.load(std::memory_order_relaxed);
+        stats.mParks = mParks.load(std::memory_order_relaxed);
+    #endif
+        return stats;
+    }
+
+    void SpinLock::ResetStats()
+    {
+    #ifdef KANCHONET_SPINLOCK_STATS
+        mAcquisitions.store(0, std::memory_order_relaxed);
+        mContentions.store(0, std::memory_order_relaxed);
+        mSpins.store(0, std::memory_order_relaxed);
+        mParks.store(0, std::memory_order_relaxed);
+    #endif
+    }
 
 } // namespace KanchoNet
 
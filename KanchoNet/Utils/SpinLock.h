@@ -1,23 +1,84 @@
 #pragma once
 
+#include "../Platform.h"
 #include <atomic>
+#include <cstdint>
+
+#if defined(KANCHONET_COMPILER_MSVC)
+    #include <intrin.h>
+#endif
 
 namespace KanchoNet
 {
+    // CPU 스핀 대기 힌트 (x86: pause, ARM: yield)
+    inline void CpuRelax()
+    {
+    #if defined(KANCHONET_ARCH_X64) || defined(KANCHONET_ARCH_X86)
+        #if defined(KANCHONET_COMPILER_MSVC)
+        _mm_pause();
+        #else
+        __builtin_ia32_pause();
+        #endif
+    #elif defined(KANCHONET_ARCH_ARM64) || defined(KANCHONET_ARCH_ARM)
+        #if defined(KANCHONET_COMPILER_MSVC)
+        __yield();
+        #else
+        __asm__ __volatile__("yield" ::: "memory");
+        #endif
+    #else
+        // 알 수 없는 아키텍처: 컴파일러 재배치만 방지
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    #endif
+    }
+
+    // 락 경합 통계 (KANCHONET_SPINLOCK_STATS 정의 시에만 수집, 아니면 항상 0)
+    struct SpinLockStats
+    {
+        uint64_t mAcquisitions = 0;  // 전체 획득 횟수
+        uint64_t mContentions = 0;   // 첫 시도에 실패하고 대기한 횟수
+        uint64_t mSpins = 0;         // 대기 중 실행한 pause 횟수
+        uint64_t mParks = 0;         // 커널 대기(futex/WaitOnAddress) 진입 횟수
+    };
+
     // 스핀락 (Spin Lock)
     // 짧은 시간 동안의 동기화에 적합 (뮤텍스보다 오버헤드가 적음)
+    // 경합 시 지수 백오프로 잠시 스핀한 뒤, 그래도 획득하지 못하면 커널에서 대기(park)
+    // → 락 보유 스레드가 디스케줄된 경우에도 타임슬라이스를 낭비하지 않음
     class SpinLock
     {
     public:
-        // public 멤버변수 (없음)
+        // public 멤버변수
+        // 스핀 단계 수 (단계마다 pause 횟수를 1, 2, 4 ... 2^(n-1)로 증가)
+        static constexpr uint32_t MAX_SPIN_ROUNDS = 8;
         
     private:
         // private 멤버변수
-        std::atomic<bool> mFlag;
+        // 락 상태 (futex 대기 주소로 사용되므로 32비트)
+        static constexpr uint32_t UNLOCKED = 0;
+        static constexpr uint32_t LOCKED = 1;      // 획득됨, 대기자 없음
+        static constexpr uint32_t CONTENDED = 2;   // 획득됨, 대기자가 있을 수 있음 (해제 시 깨워야 함)
+
+        std::atomic<uint32_t> mState;
+
+    #ifdef KANCHONET_SPINLOCK_STATS
+        std::atomic<uint64_t> mAcquisitions;
+        std::atomic<uint64_t> mContentions;
+        std::atomic<uint64_t> mSpins;
+        std::atomic<uint64_t> mParks;
+    #endif
         
     public:
         // 생성자, 파괴자
-        SpinLock() : mFlag(false) {}
+        SpinLock()
+            : mState(UNLOCKED)
+        #ifdef KANCHONET_SPINLOCK_STATS
+            , mAcquisitions(0)
+            , mContentions(0)
+            , mSpins(0)
+            , mParks(0)
+        #endif
+        {
+        }
         ~SpinLock() = default;
 
         // 복사/이동 불가
@@ -31,32 +92,62 @@ namespace KanchoNet
         // 락 획득
         void lock()
         {
-            while (mFlag.exchange(true, std::memory_order_acquire))
+            uint32_t expected = UNLOCKED;
+            if (!mState.compare_exchange_strong(expected, LOCKED,
+                                                std::memory_order_acquire, std::memory_order_relaxed))
             {
-                // 스핀 대기
-                while (mFlag.load(std::memory_order_relaxed))
-                {
-                    // CPU에게 힌트를 주어 성능 향상
-                    #if defined(_MSC_VER)
-                    _mm_pause();
-                    #elif defined(__GNUC__) || defined(__clang__)
-                    __builtin_ia32_pause();
-                    #endif
-                }
+                LockSlow();
             }
+
+        #ifdef KANCHONET_SPINLOCK_STATS
+            mAcquisitions.fetch_add(1, std::memory_order_relaxed);
+        #endif
         }
 
         // 락 해제
         void unlock()
         {
-            mFlag.store(false, std::memory_order_release);
+            // 대기자가 있을 수 있으면 하나만 깨움
+            if (mState.exchange(UNLOCKED, std::memory_order_release) == CONTENDED)
+            {
+                WakeOne();
+            }
         }
 
         // 락 시도 (블로킹하지 않음)
         bool try_lock()
         {
-            return !mFlag.exchange(true, std::memory_order_acquire);
+            uint32_t expected = UNLOCKED;
+            if (!mState.compare_exchange_strong(expected, LOCKED,
+                                                std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+        #ifdef KANCHONET_SPINLOCK_STATS
+            mAcquisitions.fetch_add(1, std::memory_order_relaxed);
+        #endif
+            return true;
         }
+
+        // 경합 통계
+        static constexpr bool IsStatsEnabled()
+        {
+        #ifdef KANCHONET_SPINLOCK_STATS
+            return true;
+        #else
+            return false;
+        #endif
+        }
+
+        SpinLockStats GetStats() const;
+        void ResetStats();
+
+    private:
+        // private 함수
+        void LockSlow();
+        void Park(uint32_t expected);
+        void WakeOne();
     };
 
     // RAII 스타일 락 가드
@@ -35,6 +35,7 @@ echo ""
 echo "Binaries location:"
 echo "  - Library: build/lib/libKanchoNet.a"
 echo "  - Examples: build/bin/"
+echo "  - Benchmarks: build/bin/KanchoBench, build/bin/KanchoNetMicroBench"
 echo ""
 echo "To run example servers:"
 echo "  ./build/bin/EchoServer"